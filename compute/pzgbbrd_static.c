@@ -27,19 +27,6 @@
 
 #define shift 3
 
-#define ss_cond_set(m, n, val)                  \
-    {                                                   \
-        plasma->ss_progress[(m)+plasma->ss_ld*(n)] = (val); \
-    }
-
-
-#define ss_cond_wait(m, n, val) \
-    {                                                           \
-        while (plasma->ss_progress[(m)+plasma->ss_ld*(n)] != (val)) \
-            sched_yield();                                          \
-    }
-
-
 #define AL(m_, n_) (A + nb + lda * (n_) + ((m_)-(n_)))
 #define AU(m_, n_) (A + nb + lda * (n_) + ((m_)-(n_)+nb))
 
@@ -81,7 +68,7 @@ void plasma_pzgbbrd_static (plasma_enum_t uplo, int minmn, int nb, int Vblksiz,
 
     // Initialize static scheduler progress table
     int cores_num;
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma->max_threads)
     {
         cores_num  = omp_get_num_threads();
     }
@@ -98,7 +85,7 @@ void plasma_pzgbbrd_static (plasma_enum_t uplo, int minmn, int nb, int Vblksiz,
     int  thgrnb  = ii*thgrsiz == (minmn-1) ? ii:ii+1;
     allcoresnb = imin( allcoresnb, maxrequiredcores );
     
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma->max_threads)
     {
         int coreid, sweepid, myid, stt, st, ed, stind, edind;
         int blklastind, colpt,  thgrid, thed;
@@ -18,6 +18,8 @@
 #include "plasma_workspace.h"
 #include <plasma_core_blas.h>
 
+#include <omp.h>
+
 #define A(m, n) ((plasma_complex64_t*)plasma_tile_addr(A, m, n))
 
 /******************************************************************************/
@@ -31,7 +33,14 @@ void plasma_pzgbtrf(plasma_desc_t A, int *ipiv,
     // Read parameters from the context.
     plasma_context_t *plasma = plasma_context_self();
     int ib = plasma->ib;
-    int max_panel_threads = plasma->max_panel_threads;
+    int max_panel_threads = imin(plasma->max_panel_threads,
+                                 plasma->max_threads);
+
+    // Prioritize the panels and the updates within the lookahead.
+    int lookahead = plasma->lookahead;
+
+    // The panels draw their buffers from the arena of the context.
+    plasma_arena_t *arena = &plasma->arena;
 
     for (int k = 0; k < imin(A.mt, A.nt); k++) {
         // for band matrix, gm is a multiple of mb,
@@ -55,16 +64,12 @@ void plasma_pzgbtrf(plasma_desc_t A, int *ipiv,
         a00 = A(k, k);
         #pragma omp task depend(inout:a00[0:size_a00]) \
                          depend(out:ipivk[0:size_i]) \
-                         priority(1)
+                         priority(plasma_priority(lookahead, k, k))
         {
-            volatile int *max_idx = (int*)malloc(num_panel_threads*sizeof(int));
-            if (max_idx == NULL)
-                plasma_request_fail(sequence, request, PlasmaErrorOutOfMemory);
-
-            volatile plasma_complex64_t *max_val =
-                (plasma_complex64_t*)malloc(num_panel_threads*sizeof(
-                                            plasma_complex64_t));
-            if (max_val == NULL)
+            int tid = omp_get_thread_num();
+            plasma_pivot_t *pivot = (plasma_pivot_t*)plasma_arena_push(
+                arena, tid, num_panel_threads*sizeof(plasma_pivot_t));
+            if (pivot == NULL)
                 plasma_request_fail(sequence, request, PlasmaErrorOutOfMemory);
 
             volatile int info = 0;
@@ -72,29 +77,40 @@ void plasma_pzgbtrf(plasma_desc_t A, int *ipiv,
             plasma_barrier_t barrier;
             plasma_barrier_init(&barrier);
 
+            plasma_team_t team;
+            plasma_team_init(&team, num_panel_threads, plasma->team_wait);
+
             if (sequence->status == PlasmaSuccess) {
-                for (int rank = 0; rank < num_panel_threads; rank++) {
-                    #pragma omp task shared(barrier) priority(1)
+                // create a view for panel as a "general" submatrix
+                plasma_desc_t view = plasma_desc_view(
+                    A, (A.kut-1)*A.mb, k*A.nb, mak, nvak);
+                view.type = PlasmaGeneral;
+
+                // Only the helpers joining the team take part in the panel.
+                for (int i = 1; i < num_panel_threads; i++) {
+                    #pragma omp task shared(team, barrier, info) \
+                                     priority(lookahead+2)
                     {
-                        // create a view for panel as a "general" submatrix
-                        plasma_desc_t view = plasma_desc_view(
-                            A, (A.kut-1)*A.mb, k*A.nb, mak, nvak);
-                        view.type = PlasmaGeneral;
-
-                        plasma_core_zgetrf(view, &ipiv[k*A.mb], ib,
-                                    rank, num_panel_threads,
-                                    max_idx, max_val, &info,
-                                    &barrier);
-
-                        if (info != 0)
-                            plasma_request_fail(sequence, request, k*A.mb+info);
+                        int rank = plasma_team_join(&team);
+                        if (rank > 0)
+                            plasma_core_zgetrf(view, &ipiv[k*A.mb], ib,
+                                               rank, team.size,
+                                               pivot, &info,
+                                               &barrier);
                     }
                 }
+                int size = plasma_team_close(&team);
+                plasma_core_zgetrf(view, &ipiv[k*A.mb], ib,
+                                   0, size,
+                                   pivot, &info,
+                                   &barrier);
             }
             #pragma omp taskwait
 
-            free((void*)max_idx);
-            free((void*)max_val);
+            if (info != 0)
+                plasma_request_fail(sequence, request, k*A.mb+info);
+
+            plasma_arena_pop(arena, tid, pivot);
         }
         // update
         // TODO: fills are not tracked, see the one in fork
@@ -104,6 +120,7 @@ void plasma_pzgbtrf(plasma_desc_t A, int *ipiv,
             int nvan = plasma_tile_nview(A, n);
             int size_a01 = ldak*nvan;
             int size_a11 = (A.gm-(k+1)*A.mb)*nvan;
+            int prio = plasma_priority(lookahead, k, n);
 
             a01 = A(k, n);
             a11 = A(k+1, n);
@@ -111,7 +128,7 @@ void plasma_pzgbtrf(plasma_desc_t A, int *ipiv,
                              depend(inout:ipivk[0:size_i]) \
                              depend(inout:a01[0:size_a01]) \
                              depend(inout:a11[0:size_a11]) \
-                             priority(n == k+1)
+                             priority(prio)
             {
                 if (sequence->status == PlasmaSuccess) {
                     // geswp
@@ -136,7 +153,7 @@ void plasma_pzgbtrf(plasma_desc_t A, int *ipiv,
                     for (int m = imax(k+1, n-A.kut); m < imin(k+A.klt, A.mt); m++) {
                         int mvam = plasma_tile_mview(A, m);
 
-                        #pragma omp task priority(n == k+1)
+                        #pragma omp task priority(prio)
                         {
                             plasma_core_zgemm(
                                 PlasmaNoTrans, PlasmaNoTrans,
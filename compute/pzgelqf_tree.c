@@ -137,5 +137,5 @@ void plasma_pzgelqf_tree(plasma_desc_t A, plasma_desc_t T,
         }
     }
 
-    free(operations);
+    plasma_tree_free(operations);
 }
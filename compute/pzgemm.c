@@ -24,6 +24,69 @@
 #define B(m, n) (plasma_complex64_t*)plasma_tile_addr(B, m, n)
 #define C(m, n) (plasma_complex64_t*)plasma_tile_addr(C, m, n)
 
+#if defined(PLASMA_USE_OMP_ITERATOR)
+/***************************************************************************//**
+ *  Inserts one task accumulating the products of the tiles k1 <= k < k2
+ *  of the inner dimension into C(m, n), i.e., the part of the k-chain
+ *  of C(m, n) that plasma_core_omp_zgemm() would insert as k2-k1 tasks.
+ ******************************************************************************/
+static void plasma_pzgemm_chain(plasma_enum_t transa, plasma_enum_t transb,
+                                plasma_complex64_t alpha, plasma_desc_t A,
+                                                          plasma_desc_t B,
+                                plasma_complex64_t beta,  plasma_desc_t C,
+                                int m, int n, int k1, int k2,
+                                plasma_sequence_t *sequence,
+                                plasma_request_t *request)
+{
+    int mvcm = plasma_tile_mview(C, m);
+    int nvcn = plasma_tile_nview(C, n);
+    int ldcm = plasma_tile_mmain(C, m);
+    plasma_complex64_t *cmn = C(m, n);
+    int ta = transa == PlasmaNoTrans;
+    int tb = transb == PlasmaNoTrans;
+
+    #pragma omp task depend(iterator(k = k1:k2), \
+                         in:*A(ta ? m : k, ta ? k : m)) \
+                     depend(iterator(k = k1:k2), \
+                         in:*B(tb ? k : n, tb ? n : k)) \
+                     depend(inout:cmn[0:ldcm*nvcn]) \
+                     affinity(cmn[0:ldcm*nvcn])
+    {
+        for (int k = k1; k < k2 && sequence->status == PlasmaSuccess; k++) {
+            plasma_complex64_t zbeta = k == 0 ? beta : 1.0;
+            if (transa == PlasmaNoTrans) {
+                int nvak = plasma_tile_nview(A, k);
+                int ldam = plasma_tile_mmain(A, m);
+                if (transb == PlasmaNoTrans)
+                    plasma_core_zgemm(transa, transb, mvcm, nvcn, nvak,
+                                      alpha, A(m, k), ldam,
+                                             B(k, n), plasma_tile_mmain(B, k),
+                                      zbeta, cmn, ldcm);
+                else
+                    plasma_core_zgemm(transa, transb, mvcm, nvcn, nvak,
+                                      alpha, A(m, k), ldam,
+                                             B(n, k), plasma_tile_mmain(B, n),
+                                      zbeta, cmn, ldcm);
+            }
+            else {
+                int mvak = plasma_tile_mview(A, k);
+                int ldak = plasma_tile_mmain(A, k);
+                if (transb == PlasmaNoTrans)
+                    plasma_core_zgemm(transa, transb, mvcm, nvcn, mvak,
+                                      alpha, A(k, m), ldak,
+                                             B(k, n), plasma_tile_mmain(B, k),
+                                      zbeta, cmn, ldcm);
+                else
+                    plasma_core_zgemm(transa, transb, mvcm, nvcn, mvak,
+                                      alpha, A(k, m), ldak,
+                                             B(n, k), plasma_tile_mmain(B, n),
+                                      zbeta, cmn, ldcm);
+            }
+        }
+    }
+}
+#endif
+
 /***************************************************************************//**
  * Parallel tile matrix-matrix multiplication.
  * @see plasma_omp_zgemm
@@ -32,12 +95,21 @@ void plasma_pzgemm(plasma_enum_t transa, plasma_enum_t transb,
                    plasma_complex64_t alpha, plasma_desc_t A,
                                              plasma_desc_t B,
                    plasma_complex64_t beta,  plasma_desc_t C,
+                   plasma_context_t *plasma,
                    plasma_sequence_t *sequence, plasma_request_t *request)
 {
     // Return if failed sequence.
     if (sequence->status != PlasmaSuccess)
         return;
-    if (A.type == PlasmaGeneral) {
+
+#if defined(PLASMA_USE_OMP_ITERATOR)
+    // With a granularity set, group the k-chain of each tile of C
+    // into tasks of chunk tiles.
+    int kb = transa == PlasmaNoTrans ? A.nb : A.mb;
+    int chunk = plasma_chunk(plasma->granularity, 2.0*C.mb*C.nb*kb);
+#endif
+
+    if (A.type == PlasmaGeneral || A.type == PlasmaGeneralLapack) {
         for (int m = 0; m < C.mt; m++) {
             int mvcm = plasma_tile_mview(C, m);
             int ldcm = plasma_tile_mmain(C, m);
@@ -58,6 +130,16 @@ void plasma_pzgemm(plasma_enum_t transa, plasma_enum_t transb,
                         beta,  C(m, n), ldcm,
                         sequence, request);
                 }
+#if defined(PLASMA_USE_OMP_ITERATOR)
+                else if (chunk > 1) {
+                    int kt = transa == PlasmaNoTrans ? A.nt : A.mt;
+                    for (int k = 0; k < kt; k += chunk)
+                        plasma_pzgemm_chain(transa, transb,
+                                            alpha, A, B, beta, C,
+                                            m, n, k, imin(k+chunk, kt),
+                                            sequence, request);
+                }
+#endif
                 else if (transa == PlasmaNoTrans) {
                     int ldam = plasma_tile_mmain(A, m);
                     //================================
@@ -21,6 +21,72 @@
 #define A(m, n) (plasma_complex64_t*)plasma_tile_addr(A, m, n)
 #define T(m, n) (plasma_complex64_t*)plasma_tile_addr(T, m, n)
 
+/***************************************************************************//**
+ *  Inserts the tasks of the tile QR factorization in a task graph
+ *  of the native runtime.
+ ******************************************************************************/
+static void plasma_pzgeqrf_dag(plasma_desc_t A, plasma_desc_t T,
+                               plasma_workspace_t work,
+                               plasma_dag_t *dag,
+                               plasma_sequence_t *sequence,
+                               plasma_request_t *request)
+{
+    // Set inner blocking from the T tile row-dimension.
+    int ib = T.mb;
+
+    for (int k = 0; k < imin(A.mt, A.nt); k++) {
+        int mvak = plasma_tile_mview(A, k);
+        int nvak = plasma_tile_nview(A, k);
+        int ldak = plasma_tile_mmain(A, k);
+        plasma_core_rt_zgeqrt(
+            dag,
+            mvak, nvak, ib,
+            A(k, k), ldak,
+            T(k, k), T.mb,
+            work,
+            sequence, request);
+
+        for (int n = k+1; n < A.nt; n++) {
+            int nvan = plasma_tile_nview(A, n);
+            plasma_core_rt_zunmqr(
+                dag,
+                PlasmaLeft, Plasma_ConjTrans,
+                mvak, nvan, imin(mvak, nvak), ib,
+                A(k, k), ldak,
+                T(k, k), T.mb,
+                A(k, n), ldak,
+                work,
+                sequence, request);
+        }
+        for (int m = k+1; m < A.mt; m++) {
+            int mvam = plasma_tile_mview(A, m);
+            int ldam = plasma_tile_mmain(A, m);
+            plasma_core_rt_ztsqrt(
+                dag,
+                mvam, nvak, ib,
+                A(k, k), ldak,
+                A(m, k), ldam,
+                T(m, k), T.mb,
+                work,
+                sequence, request);
+
+            for (int n = k+1; n < A.nt; n++) {
+                int nvan = plasma_tile_nview(A, n);
+                plasma_core_rt_ztsmqr(
+                    dag,
+                    PlasmaLeft, Plasma_ConjTrans,
+                    A.mb, nvan, mvam, nvan, nvak, ib,
+                    A(k, n), ldak,
+                    A(m, n), ldam,
+                    A(m, k), ldam,
+                    T(m, k), T.mb,
+                    work,
+                    sequence, request);
+            }
+        }
+    }
+}
+
 /***************************************************************************//**
  *  Parallel tile QR factorization - dynamic scheduling
  * @see plasma_omp_zgeqrf
@@ -33,6 +99,46 @@ void plasma_pzgeqrf(plasma_desc_t A, plasma_desc_t T,
     if (sequence->status != PlasmaSuccess)
         return;
 
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma->runtime == PlasmaRuntimeStatic) {
+        plasma_pzgeqrf_static(A, T, work, plasma, sequence, request);
+        return;
+    }
+
+    // With the native runtime, build the task graph while earlier tasks
+    // complete, or replay the one recorded for this shape, then run it.
+    // The workspaces are per thread and move with the array of them.
+    if (plasma->runtime == PlasmaRuntimeNative) {
+        plasma_dag_t local;
+        plasma_dag_t *dag = NULL;
+        if (plasma->replay == PlasmaEnabled) {
+            const void *base[] = { A.matrix, T.matrix, work.spaces };
+            dag = plasma_graph_lookup(&plasma->graphs, "zgeqrf", T.mb, A,
+                                      3, base);
+            if (dag == NULL) {
+                dag = plasma_graph_record(&plasma->graphs, "zgeqrf", T.mb, A,
+                                          3, base);
+                if (dag != NULL)
+                    plasma_pzgeqrf_dag(A, T, work, dag, sequence, request);
+            }
+        }
+        if (dag == NULL) {
+            dag = &local;
+            plasma_dag_init(dag);
+            plasma_pzgeqrf_dag(A, T, work, dag, sequence, request);
+        }
+
+        #pragma omp taskwait
+        if (sequence->status == PlasmaSuccess)
+            plasma_dag_run(dag, sequence, request);
+
+        if (dag == &local)
+            plasma_dag_destroy(dag);
+        else if (dag->status != PlasmaSuccess)
+            plasma_graph_remove(&plasma->graphs, dag);
+        return;
+    }
+
     // Set inner blocking from the T tile row-dimension.
     int ib = T.mb;
 
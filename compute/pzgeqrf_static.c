@@ -0,0 +1,182 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "plasma_workspace.h"
+#include <plasma_core_blas.h>
+
+#include <string.h>
+
+#include <omp.h>
+
+#define A(m, n) (plasma_complex64_t*)plasma_tile_addr(A, m, n)
+#define T(m, n) (plasma_complex64_t*)plasma_tile_addr(T, m, n)
+
+/******************************************************************************/
+static void plasma_pzgeqrf_static_panel(
+    plasma_context_t *plasma, plasma_desc_t A, plasma_desc_t T, int k,
+    plasma_workspace_t work,
+    plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    if (sequence->status == PlasmaSuccess) {
+        int ib = T.mb;
+        int mvak = plasma_tile_mview(A, k);
+        int nvak = plasma_tile_nview(A, k);
+        int ldak = plasma_tile_mmain(A, k);
+        plasma_complex64_t *tau =
+            (plasma_complex64_t*)work.spaces[omp_get_thread_num()];
+
+        int info = plasma_core_zgeqrt(mvak, nvak, ib,
+                                      A(k, k), ldak,
+                                      T(k, k), T.mb,
+                                      tau, tau+nvak);
+        for (int m = k+1; m < A.mt && info == PlasmaSuccess; m++) {
+            int mvam = plasma_tile_mview(A, m);
+            int ldam = plasma_tile_mmain(A, m);
+            info = plasma_core_ztsqrt(mvam, nvak, ib,
+                                      A(k, k), ldak,
+                                      A(m, k), ldam,
+                                      T(m, k), T.mb,
+                                      tau, tau+nvak);
+        }
+        if (info != PlasmaSuccess) {
+            plasma_error("core_zgeqrt() or core_ztsqrt() failed");
+            plasma_request_fail(sequence, request, PlasmaErrorInternal);
+        }
+    }
+    ss_cond_set(k, 0, 1);
+}
+
+/******************************************************************************/
+static void plasma_pzgeqrf_static_update(
+    plasma_context_t *plasma, plasma_desc_t A, plasma_desc_t T, int k, int n,
+    plasma_workspace_t work,
+    plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    ss_cond_wait(k, 0, 1);
+    if (sequence->status == PlasmaSuccess) {
+        int ib = T.mb;
+        int mvak = plasma_tile_mview(A, k);
+        int nvak = plasma_tile_nview(A, k);
+        int ldak = plasma_tile_mmain(A, k);
+        int nvan = plasma_tile_nview(A, n);
+        plasma_complex64_t *W =
+            (plasma_complex64_t*)work.spaces[omp_get_thread_num()];
+
+        int info = plasma_core_zunmqr(PlasmaLeft, Plasma_ConjTrans,
+                                      mvak, nvan, imin(mvak, nvak), ib,
+                                      A(k, k), ldak,
+                                      T(k, k), T.mb,
+                                      A(k, n), ldak,
+                                      W, nvan);
+        for (int m = k+1; m < A.mt && info == PlasmaSuccess; m++) {
+            int mvam = plasma_tile_mview(A, m);
+            int ldam = plasma_tile_mmain(A, m);
+            info = plasma_core_ztsmqr(PlasmaLeft, Plasma_ConjTrans,
+                                      A.mb, nvan, mvam, nvan, nvak, ib,
+                                      A(k, n), ldak,
+                                      A(m, n), ldam,
+                                      A(m, k), ldam,
+                                      T(m, k), T.mb,
+                                      W, ib);
+        }
+        if (info != PlasmaSuccess) {
+            plasma_error("core_zunmqr() or core_ztsmqr() failed");
+            plasma_request_fail(sequence, request, PlasmaErrorInternal);
+        }
+    }
+}
+
+/***************************************************************************//**
+ *  Executes the columns owned by rank in the global order of the static
+ *  schedule, as in plasma_pzpotrf_static().
+ ******************************************************************************/
+static void plasma_pzgeqrf_static_rank(
+    plasma_context_t *plasma, plasma_desc_t A, plasma_desc_t T,
+    plasma_workspace_t work, int lookahead, int rank, int nthread,
+    plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    int minmtnt = imin(A.mt, A.nt);
+
+    for (int s = 0; s < A.nt; s++) {
+        if (s%nthread == rank) {
+            for (int k = imax(0, s-lookahead); k < imin(s, minmtnt); k++)
+                plasma_pzgeqrf_static_update(plasma, A, T, k, s, work,
+                                             sequence, request);
+
+            if (s < minmtnt)
+                plasma_pzgeqrf_static_panel(plasma, A, T, s, work,
+                                            sequence, request);
+        }
+        int k = s-lookahead;
+        if (k >= 0 && k < minmtnt) {
+            for (int n = s+1; n < A.nt; n++) {
+                if (n%nthread == rank)
+                    plasma_pzgeqrf_static_update(plasma, A, T, k, n, work,
+                                                 sequence, request);
+            }
+        }
+    }
+}
+
+/***************************************************************************//**
+ *  Parallel tile QR factorization - static scheduling.
+ *  Columns of tiles are distributed 1D cyclic over the threads of the team,
+ *  as the flat reduction tree chains all the tiles of a column.
+ *  The threads synchronize through the progress table of the context.
+ *  All the threads of the team must be available to execute the ranks.
+ * @see plasma_omp_zgeqrf
+ **/
+void plasma_pzgeqrf_static(plasma_desc_t A, plasma_desc_t T,
+                           plasma_workspace_t work,
+                           plasma_context_t *plasma,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request)
+{
+    // Return if failed sequence.
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    // Complete the tasks producing A.
+    #pragma omp taskwait
+
+    // Initialize static scheduler progress table, from the memory pool.
+    size_t lprogress = (size_t)A.nt*sizeof(int);
+    plasma->ss_progress =
+        (volatile int*)plasma_pool_alloc(&plasma->pool, lprogress);
+    if (plasma->ss_progress == NULL) {
+        plasma_request_fail(sequence, request, PlasmaErrorOutOfMemory);
+        return;
+    }
+    memset((void*)plasma->ss_progress, 0, lprogress);
+    plasma->ss_ld = A.nt;
+    plasma->ss_abort = 0;
+
+    int nthread = omp_get_num_threads();
+    int lookahead = plasma->lookahead;
+    for (int rank = 1; rank < nthread; rank++) {
+        #pragma omp task firstprivate(rank)
+        plasma_pzgeqrf_static_rank(plasma, A, T, work, lookahead,
+                                   rank, nthread, sequence, request);
+    }
+    plasma_pzgeqrf_static_rank(plasma, A, T, work, lookahead,
+                               0, nthread, sequence, request);
+
+    #pragma omp taskwait
+
+    plasma_pool_free(&plasma->pool, (void*)plasma->ss_progress);
+    plasma->ss_progress = NULL;
+}
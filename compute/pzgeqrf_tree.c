@@ -133,5 +133,5 @@ void plasma_pzgeqrf_tree(plasma_desc_t A, plasma_desc_t T,
         }
     }
 
-    free(operations);
+    plasma_tree_free(operations);
 }
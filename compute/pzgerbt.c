@@ -0,0 +1,143 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+
+
+#include "plasma_async.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include <plasma_core_blas.h>
+
+#define A(m, n) (plasma_complex64_t*)plasma_tile_addr(A, m, n)
+
+/***************************************************************************//**
+ *  Parallel application of a random butterfly transform, a task per tile
+ *  column (side = PlasmaLeft) or per tile row (side = PlasmaRight).
+ * @see plasma_core_zgerbt
+ ******************************************************************************/
+void plasma_pzgerbt(plasma_enum_t side, plasma_enum_t trans, int depth,
+                    const double *u, plasma_desc_t A,
+                    plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    // Return if failed sequence.
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    if (side == PlasmaLeft) {
+        for (int n = 0; n < A.nt; n++) {
+            plasma_complex64_t *a00, *a10;
+
+            a00 = A(0, n);
+            a10 = A(A.mt-1, n);
+
+#if !defined(PLASMA_USE_OMP_ITERATOR)
+            // Multidependency of the whole panel on its individual tiles.
+            for (int m = 1; m < A.mt-1; m++) {
+                plasma_complex64_t *amn = A(m, n);
+                #pragma omp task depend (in:amn[0]) \
+                                 depend (inout:a00[0])
+                {
+                    int l = 1;
+                    l++;
+                }
+            }
+#endif
+
+#if defined(PLASMA_USE_OMP_ITERATOR)
+            // The iterator ties the panel to its individual tiles.
+            #pragma omp task depend (in:u[0:depth*A.m]) \
+                             depend (inout:a00[0]) \
+                             depend (inout:a10[0]) \
+                             depend (iterator(m = 1:A.mt-1), inout:*A(m, n))
+#else
+            #pragma omp task depend (in:u[0:depth*A.m]) \
+                             depend (inout:a00[0]) \
+                             depend (inout:a10[0])
+#endif
+            {
+                if (sequence->status == PlasmaSuccess) {
+                    int nvan = plasma_tile_nview(A, n);
+                    plasma_desc_t view =
+                        plasma_desc_view(A, 0, n*A.nb, A.m, nvan);
+                    plasma_core_zgerbt(side, trans, depth, u, view);
+                }
+            }
+
+#if !defined(PLASMA_USE_OMP_ITERATOR)
+            // Multidependency of individual tiles on the whole panel.
+            for (int m = 1; m < A.mt-1; m++) {
+                plasma_complex64_t *amn = A(m, n);
+                #pragma omp task depend (in:a00[0]) \
+                                 depend (inout:amn[0])
+                {
+                    int l = 1;
+                    l++;
+                }
+            }
+#endif
+        }
+    }
+    else { // PlasmaRight
+        for (int m = 0; m < A.mt; m++) {
+            plasma_complex64_t *a00, *a01;
+
+            a00 = A(m, 0);
+            a01 = A(m, A.nt-1);
+
+#if !defined(PLASMA_USE_OMP_ITERATOR)
+            // Multidependency of the whole (row) panel on its individual tiles.
+            for (int n = 1; n < A.nt-1; n++) {
+                plasma_complex64_t *amn = A(m, n);
+                #pragma omp task depend (in:amn[0]) \
+                                 depend (inout:a00[0])
+                {
+                    int l = 1;
+                    l++;
+                }
+            }
+#endif
+
+#if defined(PLASMA_USE_OMP_ITERATOR)
+            // The iterator ties the (row) panel to its individual tiles.
+            #pragma omp task depend (in:u[0:depth*A.n]) \
+                             depend (inout:a00[0]) \
+                             depend (inout:a01[0]) \
+                             depend (iterator(n = 1:A.nt-1), inout:*A(m, n))
+#else
+            #pragma omp task depend (in:u[0:depth*A.n]) \
+                             depend (inout:a00[0]) \
+                             depend (inout:a01[0])
+#endif
+            {
+                if (sequence->status == PlasmaSuccess) {
+                    int mvam = plasma_tile_mview(A, m);
+                    plasma_desc_t view =
+                        plasma_desc_view(A, m*A.mb, 0, mvam, A.n);
+                    plasma_core_zgerbt(side, trans, depth, u, view);
+                }
+            }
+
+#if !defined(PLASMA_USE_OMP_ITERATOR)
+            // Multidependency of individual tiles on the whole (row) panel.
+            for (int n = 1; n < A.nt-1; n++) {
+                plasma_complex64_t *amn = A(m, n);
+                #pragma omp task depend (in:a00[0]) \
+                                 depend (inout:amn[0])
+                {
+                    int l = 1;
+                    l++;
+                }
+            }
+#endif
+        }
+    }
+}
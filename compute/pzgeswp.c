@@ -34,6 +34,7 @@ void plasma_pzgeswp(plasma_enum_t colrow,
             a00 = A(0, n);
             a10 = A(A.mt-1, n);
 
+#if !defined(PLASMA_USE_OMP_ITERATOR)
             // Multidependency of the whole panel on its individual tiles.
             for (int m = 1; m < A.mt-1; m++) {
                 plasma_complex64_t *amn = A(m, n);
@@ -44,6 +45,7 @@ void plasma_pzgeswp(plasma_enum_t colrow,
                     l++;
                 }
             }
+#endif
 
             int ma00 = (A.mt-1)*A.mb;
             int na00 = plasma_tile_nmain(A, n);
@@ -51,15 +53,24 @@ void plasma_pzgeswp(plasma_enum_t colrow,
             int lda10 = plasma_tile_mmain(A, A.mt-1);
             int nva10 = plasma_tile_nview(A, n);
 
+#if defined(PLASMA_USE_OMP_ITERATOR)
+            // The iterator ties the panel to its individual tiles.
+            #pragma omp task depend (in:ipiv[0:A.m]) \
+                             depend (inout:a00[0:ma00*na00]) \
+                             depend (inout:a10[0:lda10*nva10]) \
+                             depend (iterator(m = 1:A.mt-1), inout:*A(m, n))
+#else
             #pragma omp task depend (in:ipiv[0:A.m]) \
                              depend (inout:a00[0:ma00*na00]) \
                              depend (inout:a10[0:lda10*nva10])
+#endif
             {
                 int nvan = plasma_tile_nview(A, n);
                 plasma_desc_t view = plasma_desc_view(A, 0, n*A.nb, A.m, nvan);
                 plasma_core_zgeswp(colrow, view, 1, A.m, ipiv, incx);
             }
 
+#if !defined(PLASMA_USE_OMP_ITERATOR)
             // Multidependency of individual tiles on the whole panel.
             for (int m = 1; m < A.mt-1; m++) {
                 plasma_complex64_t *amn = A(m, n);
@@ -70,6 +81,7 @@ void plasma_pzgeswp(plasma_enum_t colrow,
                     l++;
                 }
             }
+#endif
         }
     }
     else { // PlasmaColumnwise
@@ -79,6 +91,7 @@ void plasma_pzgeswp(plasma_enum_t colrow,
             a00 = A(m, 0);
             a01 = A(m, A.nt-1);
 
+#if !defined(PLASMA_USE_OMP_ITERATOR)
             // Multidependency of the whole (row) panel on its individual tiles.
             for (int n = 1; n < A.nt-1; n++) {
                 plasma_complex64_t *amn = A(m, n);
@@ -89,16 +102,26 @@ void plasma_pzgeswp(plasma_enum_t colrow,
                     l++;
                 }
             }
+#endif
 
+#if defined(PLASMA_USE_OMP_ITERATOR)
+            // The iterator ties the (row) panel to its individual tiles.
+            #pragma omp task depend (in:ipiv[0:A.n]) \
+                             depend (inout:a00[0]) \
+                             depend (inout:a01[0]) \
+                             depend (iterator(n = 1:A.nt-1), inout:*A(m, n))
+#else
             #pragma omp task depend (in:ipiv[0:A.n]) \
                              depend (inout:a00[0]) \
                              depend (inout:a01[0])
+#endif
             {
                 int mvam = plasma_tile_mview(A, m);
                 plasma_desc_t view = plasma_desc_view(A, m*A.mb, 0, mvam, A.n);
                 plasma_core_zgeswp(colrow, view, 1, A.n, ipiv, incx);
             }
 
+#if !defined(PLASMA_USE_OMP_ITERATOR)
             // Multidependency of individual tiles on the whole (row) panel.
             for (int n = 1; n < A.nt-1; n++) {
                 plasma_complex64_t *amn = A(m, n);
@@ -109,6 +132,7 @@ void plasma_pzgeswp(plasma_enum_t colrow,
                     l++;
                 }
             }
+#endif
         }
     }
 }
@@ -14,12 +14,599 @@
 #include "plasma_context.h"
 #include "plasma_descriptor.h"
 #include "plasma_internal.h"
+#include "plasma_tree.h"
 #include "plasma_types.h"
 #include "plasma_workspace.h"
 #include <plasma_core_blas.h>
+#include "core_lapack.h"
+
+#include <stddef.h>
+#include <string.h>
+
+#include <omp.h>
 
 #define A(m, n) (plasma_complex64_t*)plasma_tile_addr(A, m, n)
 
+/***************************************************************************//**
+ *  Candidate pivot rows held by a node of the tournament: their values
+ *  before the elimination of the panel and their indices in A.
+ ******************************************************************************/
+typedef struct {
+    plasma_complex64_t *W; ///< candidate rows, leading dimension nvak
+    int *rows;             ///< indices of the candidate rows in A
+    int num;               ///< number of candidates
+} plasma_pzgetrf_node_t;
+
+/***************************************************************************//**
+ *  Plays one match of the tournament: factors a copy of the s-by-n stack
+ *  of rows W with partial pivoting and keeps the rows picked as pivots,
+ *  with their values from W, as the candidates of node. On exit, LU holds
+ *  the factors, with leading dimension s. The permutation is drawn from
+ *  the buffer of the thread in arena.
+ ******************************************************************************/
+static int plasma_pzgetrf_tournament_match(
+    plasma_complex64_t *W, int *rows, int s, int n,
+    plasma_complex64_t *LU, plasma_pzgetrf_node_t *node,
+    plasma_arena_t *arena)
+{
+    int minsn = imin(s, n);
+    int tid = omp_get_thread_num();
+    int *perm = (int*)plasma_arena_push(arena, tid,
+                                        (size_t)(s+minsn)*sizeof(int));
+    if (perm == NULL)
+        return PlasmaErrorOutOfMemory;
+    int *piv = &perm[s];
+
+    LAPACKE_zlacpy_work(LAPACK_COL_MAJOR, 'F', s, n, W, s, LU, s);
+    LAPACKE_zgetrf_work(LAPACK_COL_MAJOR, s, n, LU, s, piv);
+
+    for (int i = 0; i < s; i++)
+        perm[i] = i;
+    for (int i = 0; i < minsn; i++) {
+        int tmp = perm[i];
+        perm[i] = perm[piv[i]-1];
+        perm[piv[i]-1] = tmp;
+    }
+
+    for (int i = 0; i < minsn; i++) {
+        node->rows[i] = rows[perm[i]];
+        cblas_zcopy(n, &W[perm[i]], s, &node->W[i], n);
+    }
+    node->num = minsn;
+
+    plasma_arena_pop(arena, tid, perm);
+    return PlasmaSuccess;
+}
+
+/***************************************************************************//**
+ *  Stacks the candidates of node and, optionally, the mvam rows of the
+ *  tile am into W, with leading dimension s, and their indices into rows.
+ ******************************************************************************/
+static void plasma_pzgetrf_tournament_stack(
+    plasma_pzgetrf_node_t *node, plasma_complex64_t *am, int mvam, int ldam,
+    int row0, int n, plasma_complex64_t *W, int *rows, int s, int *offset)
+{
+    if (node != NULL) {
+        LAPACKE_zlacpy_work(LAPACK_COL_MAJOR, 'F', node->num, n,
+                            node->W, n, &W[*offset], s);
+        for (int i = 0; i < node->num; i++)
+            rows[*offset+i] = node->rows[i];
+        *offset += node->num;
+    }
+    if (am != NULL) {
+        LAPACKE_zlacpy_work(LAPACK_COL_MAJOR, 'F', mvam, n,
+                            am, ldam, &W[*offset], s);
+        for (int i = 0; i < mvam; i++)
+            rows[*offset+i] = row0+i;
+        *offset += mvam;
+    }
+}
+
+/***************************************************************************//**
+ *  Factors the panel k of A with tournament pivoting (CALU). Tiles, or
+ *  groups of tiles, pick candidate pivots independently by partial
+ *  pivoting, and the candidates play matches up the reduction tree given
+ *  by the operations of column k, as in tile QR (plasma_tree_operations):
+ *  a GE kernel starts a node from a tile, a TS kernel adds the rows of a
+ *  tile to a node, and a TT kernel merges two nodes. The winners at the
+ *  root are swapped to the top of the panel, whose factors are those of
+ *  the root match, and the rows below are solved with the triangular U.
+ *  On exit, A and ipiv are as after partial pivoting.
+ ******************************************************************************/
+static void plasma_pzgetrf_tournament_panel(
+    plasma_desc_t A, int *ipiv, int k, int *operations, int num_operations,
+    plasma_arena_t *arena,
+    plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    int nvak = plasma_tile_nview(A, k);
+    int ldak = plasma_tile_mmain(A, k);
+    int mp = A.m-k*A.mb;
+    int mtk = A.mt-k;
+
+    int tid = omp_get_thread_num();
+    plasma_pzgetrf_node_t *node = (plasma_pzgetrf_node_t*)plasma_arena_push(
+        arena, tid, (size_t)mtk*sizeof(plasma_pzgetrf_node_t));
+    plasma_complex64_t *W = (plasma_complex64_t*)plasma_arena_push(
+        arena, tid, (size_t)mtk*nvak*nvak*sizeof(plasma_complex64_t));
+    int *rows = (int*)plasma_arena_push(
+        arena, tid, (size_t)(mtk*nvak+2*mp)*sizeof(int));
+    if (node == NULL || W == NULL || rows == NULL) {
+        plasma_request_fail(sequence, request, PlasmaErrorOutOfMemory);
+        plasma_arena_pop(arena, tid, rows);
+        plasma_arena_pop(arena, tid, W);
+        plasma_arena_pop(arena, tid, node);
+        return;
+    }
+    for (int m = 0; m < mtk; m++) {
+        node[m].W = &W[(size_t)m*nvak*nvak];
+        node[m].rows = &rows[m*nvak];
+        node[m].num = 0;
+    }
+
+    //============
+    // tournament
+    //============
+    for (int iop = 0; iop < num_operations; iop++) {
+        int j, m, mpiv;
+        plasma_enum_t kernel;
+        plasma_tree_get_operation(operations, iop, &kernel, &j, &m, &mpiv);
+        if (j != k)
+            continue;
+
+        int M = kernel == PlasmaGeKernel ? m : mpiv;
+
+        #pragma omp task depend(inout:node[M-k]) depend(in:node[m-k])
+        {
+            int mvam = plasma_tile_mview(A, m);
+            int ldam = plasma_tile_mmain(A, m);
+
+            // Stack the contestants.
+            int s = kernel == PlasmaTtKernel ? node[M-k].num+node[m-k].num
+                                             : node[M-k].num+mvam;
+            int tid = omp_get_thread_num();
+            plasma_complex64_t *S = (plasma_complex64_t*)plasma_arena_push(
+                arena, tid, (size_t)2*s*nvak*sizeof(plasma_complex64_t));
+            int *srows = (int*)plasma_arena_push(
+                arena, tid, (size_t)s*sizeof(int));
+            if (S == NULL || srows == NULL) {
+                plasma_request_fail(sequence, request, PlasmaErrorOutOfMemory);
+            }
+            else {
+                int offset = 0;
+                if (kernel == PlasmaGeKernel)
+                    plasma_pzgetrf_tournament_stack(
+                        NULL, A(m, k), mvam, ldam, m*A.mb, nvak,
+                        S, srows, s, &offset);
+                else if (kernel == PlasmaTsKernel)
+                    plasma_pzgetrf_tournament_stack(
+                        &node[M-k], A(m, k), mvam, ldam, m*A.mb, nvak,
+                        S, srows, s, &offset);
+                else {
+                    plasma_pzgetrf_tournament_stack(
+                        &node[M-k], NULL, 0, 0, 0, nvak,
+                        S, srows, s, &offset);
+                    plasma_pzgetrf_tournament_stack(
+                        &node[m-k], NULL, 0, 0, 0, nvak,
+                        S, srows, s, &offset);
+                }
+
+                // Play the match.
+                int retval = plasma_pzgetrf_tournament_match(
+                    S, srows, s, nvak, &S[(size_t)s*nvak], &node[M-k],
+                    arena);
+                if (retval != PlasmaSuccess)
+                    plasma_request_fail(sequence, request, retval);
+            }
+            plasma_arena_pop(arena, tid, srows);
+            plasma_arena_pop(arena, tid, S);
+        }
+    }
+    #pragma omp taskwait
+
+    //======================
+    // final match and swaps
+    //======================
+    int s = node[0].num;
+    plasma_complex64_t *S = (plasma_complex64_t*)plasma_arena_push(
+        arena, tid, (size_t)2*s*nvak*sizeof(plasma_complex64_t));
+    int *srows = (int*)plasma_arena_push(arena, tid, (size_t)s*sizeof(int));
+    if (S == NULL || srows == NULL)
+        plasma_request_fail(sequence, request, PlasmaErrorOutOfMemory);
+
+    plasma_complex64_t *LU = &S[(size_t)s*nvak];
+    if (sequence->status == PlasmaSuccess) {
+        int offset = 0;
+        plasma_pzgetrf_tournament_stack(&node[0], NULL, 0, 0, 0, nvak,
+                                        S, srows, s, &offset);
+        int retval = plasma_pzgetrf_tournament_match(
+            S, srows, s, nvak, LU, &node[0], arena);
+        if (retval != PlasmaSuccess)
+            plasma_request_fail(sequence, request, retval);
+    }
+
+    int kp = node[0].num;
+    if (sequence->status == PlasmaSuccess) {
+        // Turn the winners into the interchanges of LAPACK.
+        int *where = &rows[mtk*nvak];
+        int *at = &where[mp];
+        for (int i = 0; i < mp; i++) {
+            where[i] = i;
+            at[i] = i;
+        }
+        for (int i = 0; i < kp; i++) {
+            int j = where[node[0].rows[i]-k*A.mb];
+            ipiv[k*A.mb+i] = k*A.mb+j+1;
+            int tmp = at[i];
+            at[i] = at[j];
+            at[j] = tmp;
+            where[at[i]] = i;
+            where[at[j]] = j;
+        }
+        plasma_desc_t view = plasma_desc_view(A, 0, k*A.nb, A.m, nvak);
+        plasma_core_zgeswp(PlasmaRowwise, view, k*A.mb+1, k*A.mb+kp, ipiv, 1);
+
+        // The factors of the winners are those of the final match.
+        LAPACKE_zlacpy_work(LAPACK_COL_MAJOR, 'F', kp, nvak,
+                            LU, s, A(k, k), ldak);
+
+        // A zero pivot does not stop the factorization, as in LAPACK.
+        // Record the first one and let the caller decide.
+        int info = 0;
+        for (int i = 0; i < kp && info == 0; i++)
+            if (LU[i+i*s] == 0.0)
+                info = i+1;
+        if (info != 0 && sequence->info == 0)
+            sequence->info = k*A.mb+info;
+
+        //=============================
+        // rows below the winners: L21
+        //=============================
+        for (int m = k; m < A.mt; m++) {
+            int i0 = m == k ? kp : 0;
+            int mvam = plasma_tile_mview(A, m)-i0;
+            int ldam = plasma_tile_mmain(A, m);
+            plasma_complex64_t *am = A(m, k)+i0;
+            if (mvam <= 0)
+                continue;
+
+            #pragma omp task
+            {
+                plasma_complex64_t zone = 1.0;
+                if (info == 0) {
+                    cblas_ztrsm(CblasColMajor,
+                                CblasRight, CblasUpper,
+                                CblasNoTrans, CblasNonUnit,
+                                mvam, kp,
+                                CBLAS_SADDR(zone), LU, s,
+                                                   am, ldam);
+                }
+                else {
+                    // Skip the columns of zero pivots, as LAPACK does.
+                    plasma_complex64_t zmone = -1.0;
+                    for (int j = 0; j < kp; j++) {
+                        cblas_zgemv(CblasColMajor, CblasNoTrans,
+                                    mvam, j,
+                                    CBLAS_SADDR(zmone), am, ldam,
+                                                        &LU[j*s], 1,
+                                    CBLAS_SADDR(zone),  &am[j*ldam], 1);
+                        if (LU[j+j*s] != 0.0) {
+                            plasma_complex64_t scal = 1.0/LU[j+j*s];
+                            cblas_zscal(mvam, CBLAS_SADDR(scal),
+                                        &am[j*ldam], 1);
+                        }
+                    }
+                }
+            }
+        }
+        #pragma omp taskwait
+    }
+
+    plasma_arena_pop(arena, tid, srows);
+    plasma_arena_pop(arena, tid, S);
+    plasma_arena_pop(arena, tid, rows);
+    plasma_arena_pop(arena, tid, W);
+    plasma_arena_pop(arena, tid, node);
+}
+
+#if defined(PLASMA_USE_OMP_ITERATOR)
+/***************************************************************************//**
+ *  Updates the column n of A by step k of the factorization in tiles:
+ *  the row interchanges of the column, the triangular solve of its tile k
+ *  and a gemm per tile below, so that the updates of tall matrices get
+ *  mt*nt tasks rather than nt. The iterator ties the row interchanges,
+ *  which may touch any tile below the panel, to the tiles of the column.
+ ******************************************************************************/
+static void plasma_pzgetrf_tile_update(plasma_desc_t A, int *ipiv,
+                                       int k, int n, int prio,
+                                       plasma_sequence_t *sequence,
+                                       plasma_request_t *request)
+{
+    plasma_complex64_t *akk = A(k, k);
+    plasma_complex64_t *akn = A(k, n);
+
+    int mvak = plasma_tile_mview(A, k);
+    int nvak = plasma_tile_nview(A, k);
+    int ldak = plasma_tile_mmain(A, k);
+    int nvan = plasma_tile_nview(A, n);
+
+    // geswp
+    #pragma omp task depend(in:ipiv[k*A.mb:mvak]) \
+                     depend(iterator(m = k:A.mt), inout:*A(m, n)) \
+                     priority(prio)
+    {
+        if (sequence->status == PlasmaSuccess) {
+            int k1 = k*A.mb+1;
+            int k2 = imin(k*A.mb+A.mb, A.m);
+            plasma_desc_t view = plasma_desc_view(A, 0, n*A.nb, A.m, nvan);
+            plasma_core_zgeswp(PlasmaRowwise, view, k1, k2, ipiv, 1);
+        }
+    }
+
+    // trsm
+    #pragma omp task depend(in:akk[0:ldak*nvak]) \
+                     depend(inout:akn[0:ldak*nvan]) \
+                     priority(prio)
+    {
+        if (sequence->status == PlasmaSuccess)
+            plasma_core_ztrsm(PlasmaLeft, PlasmaLower,
+                              PlasmaNoTrans, PlasmaUnit,
+                              mvak, nvan,
+                              1.0, akk, ldak,
+                                   akn, ldak);
+    }
+
+    // gemm
+    for (int m = k+1; m < A.mt; m++) {
+        plasma_complex64_t *amk = A(m, k);
+        plasma_complex64_t *amn = A(m, n);
+
+        int mvam = plasma_tile_mview(A, m);
+        int ldam = plasma_tile_mmain(A, m);
+
+        #pragma omp task depend(in:amk[0:ldam*nvak]) \
+                         depend(in:akn[0:ldak*nvan]) \
+                         depend(inout:amn[0:ldam*nvan]) \
+                         priority(prio)
+        {
+            if (sequence->status == PlasmaSuccess)
+                plasma_core_zgemm(
+                    PlasmaNoTrans, PlasmaNoTrans,
+                    mvam, nvan, A.nb,
+                    -1.0, amk, ldam,
+                          akn, ldak,
+                    1.0,  amn, ldam);
+        }
+    }
+}
+#endif
+
+/******************************************************************************/
+typedef struct {
+    plasma_desc_t A;
+    int *ipiv;
+    int ib;
+    int k, n;
+} plasma_pzgetrf_rt_args_t;
+
+/***************************************************************************//**
+ *  Task of the native runtime factoring the panel k on one rank,
+ *  as the native runtime cannot run the ranks of a panel together.
+ ******************************************************************************/
+static void plasma_pzgetrf_rt_panel(void *args,
+                                    plasma_sequence_t *sequence,
+                                    plasma_request_t *request)
+{
+    plasma_pzgetrf_rt_args_t *a = (plasma_pzgetrf_rt_args_t*)args;
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    plasma_desc_t A = a->A;
+    int k = a->k;
+    int nvak = plasma_tile_nview(A, k);
+    plasma_desc_t view =
+        plasma_desc_view(A, k*A.mb, k*A.nb, A.m-k*A.mb, nvak);
+
+    plasma_pivot_t pivot;
+    plasma_barrier_t barrier;
+    plasma_barrier_init(&barrier);
+    volatile int info = 0;
+    plasma_core_zgetrf(view, &a->ipiv[k*A.mb], a->ib, 0, 1,
+                       &pivot, &info, &barrier);
+
+    // A zero pivot does not stop the factorization, as in LAPACK.
+    // Record the first one and let the caller decide.
+    if (info != 0 && sequence->info == 0)
+        sequence->info = k*A.mb+info;
+
+    for (int i = k*A.mb+1; i <= imin(A.m, k*A.mb+nvak); i++)
+        a->ipiv[i-1] += k*A.mb;
+}
+
+/***************************************************************************//**
+ *  Task of the native runtime applying the row interchanges of the panel k
+ *  to the column n, to the right of the panel, or to the left if n < k.
+ ******************************************************************************/
+static void plasma_pzgetrf_rt_geswp(void *args,
+                                    plasma_sequence_t *sequence,
+                                    plasma_request_t *request)
+{
+    plasma_pzgetrf_rt_args_t *a = (plasma_pzgetrf_rt_args_t*)args;
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    plasma_desc_t A = a->A;
+    int k = a->k;
+    int n = a->n;
+    plasma_desc_t view =
+        plasma_desc_view(A, 0, n*A.nb, A.m, plasma_tile_nview(A, n));
+    if (n > k)
+        plasma_core_zgeswp(PlasmaRowwise, view,
+                           k*A.mb+1, imin(k*A.mb+A.mb, A.m), a->ipiv, 1);
+    else
+        plasma_core_zgeswp(PlasmaRowwise, view,
+                           k*A.mb+1, imin(A.m, A.n), a->ipiv, 1);
+}
+
+/***************************************************************************//**
+ *  Adds the matrix and the pivot vector in the arguments of a task
+ *  to its dependencies, to be moved when the graph is replayed.
+ ******************************************************************************/
+static void plasma_pzgetrf_rt_reloc(plasma_desc_t A, int *ipiv,
+                                    plasma_dep_t *deps, int *ndeps)
+{
+    deps[(*ndeps)++] = (plasma_dep_t){
+        A.matrix, PlasmaDepNone,
+        offsetof(plasma_pzgetrf_rt_args_t, A)+offsetof(plasma_desc_t, matrix) };
+    deps[(*ndeps)++] = (plasma_dep_t){
+        ipiv, PlasmaDepNone, offsetof(plasma_pzgetrf_rt_args_t, ipiv) };
+}
+
+/***************************************************************************//**
+ *  Inserts the tasks of the LU factorization with partial pivoting in a task
+ *  graph of the native runtime. The panels run on one rank each, and the
+ *  updates are split by tiles as with PlasmaTileUpdate.
+ ******************************************************************************/
+static void plasma_pzgetrf_dag(plasma_desc_t A, int *ipiv, int ib,
+                               plasma_dag_t *dag,
+                               plasma_sequence_t *sequence,
+                               plasma_request_t *request)
+{
+    int minmtnt = imin(A.mt, A.nt);
+
+    // The panels and the row interchanges depend on whole tile columns.
+    plasma_dep_t *deps =
+        (plasma_dep_t*)malloc((size_t)(A.mt+minmtnt+2)*sizeof(plasma_dep_t));
+    if (deps == NULL) {
+        plasma_request_fail(sequence, request, PlasmaErrorOutOfMemory);
+        return;
+    }
+
+    for (int k = 0; k < minmtnt; k++) {
+        int mvak = plasma_tile_mview(A, k);
+        int ldak = plasma_tile_mmain(A, k);
+
+        // panel
+        plasma_pzgetrf_rt_args_t args = { A, ipiv, ib, k, k };
+        int ndeps = 0;
+        plasma_pzgetrf_rt_reloc(A, ipiv, deps, &ndeps);
+        for (int m = k; m < A.mt; m++)
+            deps[ndeps++] = (plasma_dep_t){
+                A(m, k), PlasmaDepInout, PLASMA_DEP_NOARG };
+        deps[ndeps++] = (plasma_dep_t){
+            &ipiv[k*A.mb], PlasmaDepOut, PLASMA_DEP_NOARG };
+        if (plasma_dag_insert(dag, plasma_pzgetrf_rt_panel,
+                              &args, sizeof(args), ndeps, deps) !=
+            PlasmaSuccess)
+            plasma_request_fail(sequence, request, PlasmaErrorOutOfMemory);
+
+        // update
+        for (int n = k+1; n < A.nt; n++) {
+            int nvan = plasma_tile_nview(A, n);
+
+            // geswp
+            args.n = n;
+            ndeps = 0;
+            plasma_pzgetrf_rt_reloc(A, ipiv, deps, &ndeps);
+            for (int m = k; m < A.mt; m++)
+                deps[ndeps++] = (plasma_dep_t){
+                    A(m, n), PlasmaDepInout, PLASMA_DEP_NOARG };
+            deps[ndeps++] = (plasma_dep_t){
+                &ipiv[k*A.mb], PlasmaDepIn, PLASMA_DEP_NOARG };
+            if (plasma_dag_insert(dag, plasma_pzgetrf_rt_geswp,
+                                  &args, sizeof(args), ndeps, deps) !=
+                PlasmaSuccess)
+                plasma_request_fail(sequence, request, PlasmaErrorOutOfMemory);
+
+            // trsm
+            plasma_core_rt_ztrsm(
+                dag,
+                PlasmaLeft, PlasmaLower,
+                PlasmaNoTrans, PlasmaUnit,
+                mvak, nvan,
+                1.0, A(k, k), ldak,
+                     A(k, n), ldak,
+                sequence, request);
+
+            // gemm
+            for (int m = k+1; m < A.mt; m++) {
+                int mvam = plasma_tile_mview(A, m);
+                int ldam = plasma_tile_mmain(A, m);
+                plasma_core_rt_zgemm(
+                    dag,
+                    PlasmaNoTrans, PlasmaNoTrans,
+                    mvam, nvan, A.nb,
+                    -1.0, A(m, k), ldam,
+                          A(k, n), ldak,
+                    1.0,  A(m, n), ldam,
+                    sequence, request);
+            }
+        }
+    }
+
+    // pivoting to the left
+    for (int k = 0; k < minmtnt-1; k++) {
+        plasma_pzgetrf_rt_args_t args = { A, ipiv, ib, k+1, k };
+        int ndeps = 0;
+        plasma_pzgetrf_rt_reloc(A, ipiv, deps, &ndeps);
+        for (int m = k+1; m < A.mt; m++)
+            deps[ndeps++] = (plasma_dep_t){
+                A(m, k), PlasmaDepInout, PLASMA_DEP_NOARG };
+        for (int j = k+1; j < minmtnt; j++)
+            deps[ndeps++] = (plasma_dep_t){
+                &ipiv[j*A.mb], PlasmaDepIn, PLASMA_DEP_NOARG };
+        if (plasma_dag_insert(dag, plasma_pzgetrf_rt_geswp,
+                              &args, sizeof(args), ndeps, deps) !=
+            PlasmaSuccess)
+            plasma_request_fail(sequence, request, PlasmaErrorOutOfMemory);
+    }
+
+    free(deps);
+}
+
+/***************************************************************************//**
+ *  Returns the bytes plasma_pzgetrf() takes from the arena of each thread,
+ *  with the settings of the context: the pivots of a panel or, with
+ *  tournament pivoting, the candidates of a panel and one match.
+ ******************************************************************************/
+size_t plasma_pzgetrf_arena_bytes(plasma_desc_t A, plasma_context_t *plasma)
+{
+    if (plasma->pivoting == PlasmaPartialPivoting &&
+        plasma->runtime != PlasmaRuntimeOpenMP)
+        return 0;
+
+    int minmtnt = imin(A.mt, A.nt);
+    if (plasma->pivoting == PlasmaPartialPivoting) {
+        int num_panel_threads = imin(imin(plasma->max_panel_threads,
+                                          plasma->max_threads),
+                                     minmtnt);
+        return plasma_arena_bytes(num_panel_threads*sizeof(plasma_pivot_t));
+    }
+
+    // A match stacks at most two nodes, or a node and a tile.
+    size_t nb = A.nb;
+    size_t s = imax(2*A.nb, A.nb+A.mb);
+    return plasma_arena_bytes(A.mt*sizeof(plasma_pzgetrf_node_t)) +
+           plasma_arena_bytes(A.mt*nb*nb*sizeof(plasma_complex64_t)) +
+           plasma_arena_bytes((A.mt*nb+2*A.m)*sizeof(int)) +
+           plasma_arena_bytes(2*s*nb*sizeof(plasma_complex64_t)) +
+           plasma_arena_bytes(s*sizeof(int)) +
+           plasma_arena_bytes((s+nb)*sizeof(int));
+}
+
+/***************************************************************************//**
+ *  Returns the bytes plasma_pzgetrf() takes from the memory pool,
+ *  with the settings of the context: the progress table of the static
+ *  scheduler or the reduction trees of tournament pivoting.
+ ******************************************************************************/
+size_t plasma_pzgetrf_pool_bytes(plasma_desc_t A, plasma_context_t *plasma)
+{
+    if (plasma->pivoting == PlasmaTournamentPivoting)
+        return plasma_tree_bytes(A.mt, A.nt);
+    if (plasma->runtime == PlasmaRuntimeStatic)
+        return plasma_pool_bytes(A.nt*sizeof(int));
+    return 0;
+}
+
 /******************************************************************************/
 void plasma_pzgetrf(plasma_desc_t A, int *ipiv,
                     plasma_sequence_t *sequence, plasma_request_t *request)
@@ -30,25 +617,84 @@ void plasma_pzgetrf(plasma_desc_t A, int *ipiv,
 
     // Read parameters from the context.
     plasma_context_t *plasma = plasma_context_self();
+    if (plasma->runtime == PlasmaRuntimeStatic &&
+        plasma->pivoting == PlasmaPartialPivoting) {
+        plasma_pzgetrf_static(A, ipiv, plasma, sequence, request);
+        return;
+    }
 
     // Set tiling parameters.
     int ib = plasma->ib;
 
+    // With the native runtime, build the task graph while earlier tasks
+    // complete, or replay the one recorded for this shape, then run it.
+    if (plasma->runtime == PlasmaRuntimeNative &&
+        plasma->pivoting == PlasmaPartialPivoting) {
+        plasma_dag_t local;
+        plasma_dag_t *dag = NULL;
+        if (plasma->replay == PlasmaEnabled) {
+            const void *base[] = { A.matrix, ipiv };
+            dag = plasma_graph_lookup(&plasma->graphs, "zgetrf", ib, A,
+                                      2, base);
+            if (dag == NULL) {
+                dag = plasma_graph_record(&plasma->graphs, "zgetrf", ib, A,
+                                          2, base);
+                if (dag != NULL)
+                    plasma_pzgetrf_dag(A, ipiv, ib, dag, sequence, request);
+            }
+        }
+        if (dag == NULL) {
+            dag = &local;
+            plasma_dag_init(dag);
+            plasma_pzgetrf_dag(A, ipiv, ib, dag, sequence, request);
+        }
+
+        #pragma omp taskwait
+        if (sequence->status == PlasmaSuccess)
+            plasma_dag_run(dag, sequence, request);
+
+        if (dag == &local)
+            plasma_dag_destroy(dag);
+        else if (dag->status != PlasmaSuccess)
+            plasma_graph_remove(&plasma->graphs, dag);
+        return;
+    }
+
+    // Prioritize the panels and the updates within the lookahead.
+    int lookahead = plasma->lookahead;
+
+    // The panels draw their buffers from the arena of the context.
+    plasma_arena_t *arena = &plasma->arena;
+
     int minmtnt = imin(A.mt, A.nt);
 
+    // Precompute the reduction trees of tournament pivoting.
+    int *operations = NULL;
+    int num_operations = 0;
+    if (plasma->pivoting == PlasmaTournamentPivoting) {
+        plasma_tree_operations(A.mt, A.nt, &operations, &num_operations,
+                               sequence, request);
+        if (sequence->status != PlasmaSuccess) {
+            plasma_tree_free(operations);
+            return;
+        }
+    }
+
     for (int k = 0; k < minmtnt; k++) {
         plasma_complex64_t *a00, *a20;
         a00 = A(k, k);
         a20 = A(A.mt-1, k);
 
+#if !defined(PLASMA_USE_OMP_ITERATOR)
         // Create fake dependencies of the whole panel on its individual tiles.
         // These tasks are inserted to generate a correct DAG rather than
-        // doing any useful work.
+        // doing any useful work. With OpenMP 5 iterators, the panel task
+        // depends on the tiles itself.
         for (int m = k+1; m < A.mt-1; m++) {
             plasma_complex64_t *amk = A(m, k);
             #pragma omp task depend (in:amk[0]) \
                              depend (inout:a00[0]) \
-                             priority(1)
+                             priority(plasma_priority(lookahead, k, k))
             {
                 // Do some funny work here. It appears so that the compiler
                 // might not insert the task if it is completely empty.
@@ -56,6 +702,7 @@ void plasma_pzgetrf(plasma_desc_t A, int *ipiv,
                 l++;
             }
         }
+#endif
 
         int ma00k = (A.mt-k-1)*A.mb;
         int na00k = plasma_tile_nmain(A, k);
@@ -65,63 +712,101 @@ void plasma_pzgetrf(plasma_desc_t A, int *ipiv,
         int mvak = plasma_tile_mview(A, k);
         int ldak = plasma_tile_mmain(A, k);
 
-        int num_panel_threads = imin(plasma->max_panel_threads,
+        int num_panel_threads = imin(imin(plasma->max_panel_threads,
+                                          plasma->max_threads),
                                      minmtnt-k);
         // panel
-        #pragma omp task depend(inout:a00[0:ma00k*na00k]) \
-                         depend(inout:a20[0:lda20*nvak]) \
-                         depend(out:ipiv[k*A.mb:mvak]) \
-                         priority(1)
-        {
-            volatile int *max_idx = (int*)malloc(num_panel_threads*sizeof(int));
-            if (max_idx == NULL)
-                plasma_request_fail(sequence, request, PlasmaErrorOutOfMemory);
+        if (operations != NULL) {
+#if defined(PLASMA_USE_OMP_ITERATOR)
+            #pragma omp task depend(inout:a00[0:ma00k*na00k]) \
+                             depend(inout:a20[0:lda20*nvak]) \
+                             depend(iterator(m = k+1:A.mt-1), \
+                                    inout:*A(m, k)) \
+                             depend(out:ipiv[k*A.mb:mvak]) \
+                             priority(plasma_priority(lookahead, k, k))
+#else
+            #pragma omp task depend(inout:a00[0:ma00k*na00k]) \
+                             depend(inout:a20[0:lda20*nvak]) \
+                             depend(out:ipiv[k*A.mb:mvak]) \
+                             priority(plasma_priority(lookahead, k, k))
+#endif
+            {
+                if (sequence->status == PlasmaSuccess)
+                    plasma_pzgetrf_tournament_panel(A, ipiv, k,
+                                                    operations, num_operations,
+                                                    arena,
+                                                    sequence, request);
+            }
+        }
+        else {
+#if defined(PLASMA_USE_OMP_ITERATOR)
+            #pragma omp task depend(inout:a00[0:ma00k*na00k]) \
+                             depend(inout:a20[0:lda20*nvak]) \
+                             depend(iterator(m = k+1:A.mt-1), \
+                                    inout:*A(m, k)) \
+                             depend(out:ipiv[k*A.mb:mvak]) \
+                             priority(plasma_priority(lookahead, k, k))
+#else
+            #pragma omp task depend(inout:a00[0:ma00k*na00k]) \
+                             depend(inout:a20[0:lda20*nvak]) \
+                             depend(out:ipiv[k*A.mb:mvak]) \
+                             priority(plasma_priority(lookahead, k, k))
+#endif
+            {
+                int tid = omp_get_thread_num();
+                plasma_pivot_t *pivot = (plasma_pivot_t*)plasma_arena_push(
+                    arena, tid, num_panel_threads*sizeof(plasma_pivot_t));
+                if (pivot == NULL)
+                    plasma_request_fail(sequence, request, PlasmaErrorOutOfMemory);
 
-            volatile plasma_complex64_t *max_val =
-                (plasma_complex64_t*)malloc(num_panel_threads*sizeof(
-                                            plasma_complex64_t));
-            if (max_val == NULL)
-                plasma_request_fail(sequence, request, PlasmaErrorOutOfMemory);
+                volatile int info = 0;
 
-            volatile int info = 0;
+                plasma_barrier_t barrier;
+                plasma_barrier_init(&barrier);
 
-            plasma_barrier_t barrier;
-            plasma_barrier_init(&barrier);
+                plasma_team_t team;
+                plasma_team_init(&team, num_panel_threads, plasma->team_wait);
 
-            if (sequence->status == PlasmaSuccess) {
-                // If nesting would not be expensive on architectures such as
-                // KNL, this would resolve the issue with deadlocks caused by
-                // tasks expected to run are in fact not launched.
-                //#pragma omp parallel for shared(barrier)
-                //                         schedule(dynamic,1)
-                //                         num_threads(num_panel_threads)
-                #pragma omp taskloop untied shared(barrier) \
-                                     num_tasks(num_panel_threads) \
-                                     priority(2)
-                for (int rank = 0; rank < num_panel_threads; rank++) {
-                    {
-                        plasma_desc_t view =
-                            plasma_desc_view(A,
-                                             k*A.mb, k*A.nb,
-                                             A.m-k*A.mb, nvak);
-
-                        plasma_core_zgetrf(view, &ipiv[k*A.mb], ib,
-                                    rank, num_panel_threads,
-                                    max_idx, max_val, &info,
-                                    &barrier);
-
-                        if (info != 0)
-                            plasma_request_fail(sequence, request, k*A.mb+info);
+                if (sequence->status == PlasmaSuccess) {
+                    plasma_desc_t view =
+                        plasma_desc_view(A,
+                                         k*A.mb, k*A.nb,
+                                         A.m-k*A.mb, nvak);
+
+                    // The panel runs on the workers idle when it starts:
+                    // only the helpers joining the team before it closes
+                    // take part in it, so that all its ranks are running
+                    // when they reach the barriers.
+                    for (int i = 1; i < num_panel_threads; i++) {
+                        #pragma omp task shared(team, barrier, info) \
+                                         priority(lookahead+2)
+                        {
+                            int rank = plasma_team_join(&team);
+                            if (rank > 0)
+                                plasma_core_zgetrf(view, &ipiv[k*A.mb], ib,
+                                                   rank, team.size,
+                                                   pivot, &info,
+                                                   &barrier);
+                        }
                     }
+                    int size = plasma_team_close(&team);
+                    plasma_core_zgetrf(view, &ipiv[k*A.mb], ib,
+                                       0, size,
+                                       pivot, &info,
+                                       &barrier);
                 }
-            }
-            #pragma omp taskwait
+                #pragma omp taskwait
+
+                // A zero pivot does not stop the factorization, as in LAPACK.
+                // Record the first one and let the caller decide.
+                if (info != 0 && sequence->info == 0)
+                    sequence->info = k*A.mb+info;
 
-            free((void*)max_idx);
-            free((void*)max_val);
+                plasma_arena_pop(arena, tid, pivot);
 
-            for (int i = k*A.mb+1; i <= imin(A.m, k*A.mb+nvak); i++)
-                ipiv[i-1] += k*A.mb;
+                for (int i = k*A.mb+1; i <= imin(A.m, k*A.mb+nvak); i++)
+                    ipiv[i-1] += k*A.mb;
+            }
         }
 
         // update
@@ -136,14 +821,54 @@ void plasma_pzgetrf(plasma_desc_t A, int *ipiv,
             int lda21 = plasma_tile_mmain(A, A.mt-1);
 
             int nvan = plasma_tile_nview(A, n);
+            int prio = plasma_priority(lookahead, k, n);
 
+#if defined(PLASMA_USE_OMP_ITERATOR)
+            if (plasma->update == PlasmaTileUpdate) {
+                plasma_pzgetrf_tile_update(A, ipiv, k, n, prio,
+                                           sequence, request);
+                continue;
+            }
+#endif
+
+#if defined(PLASMA_USE_OMP_ITERATOR)
+            // The iterator orders the update after the earlier tasks on
+            // the middle tiles, e.g., the translation to tile layout.
+            #pragma omp task depend(in:a00[0:ma00k*na00k]) \
+                             depend(in:a20[0:lda20*nvak]) \
+                             depend(in:ipiv[k*A.mb:mvak]) \
+                             depend(inout:a01[0:ldak*nvan]) \
+                             depend(inout:a11[0:ma11k*na11n]) \
+                             depend(inout:a21[0:lda21*nvan]) \
+                             depend(iterator(m = k+2:A.mt-1), \
+                                    inout:*A(m, n)) \
+                             priority(prio)
+#else
+            // Create fake dependencies of the first update of the column
+            // on its middle tiles, which the nested gemms write, so that it
+            // waits for the earlier tasks on them, e.g., the translation
+            // to tile layout. The later updates of the column follow the
+            // first one through its tile k+1 and the taskwait.
+            if (k == 0) {
+                for (int m = k+2; m < A.mt-1; m++) {
+                    plasma_complex64_t *amn = A(m, n);
+                    #pragma omp task depend (in:amn[0]) \
+                                     depend (inout:a11[0]) \
+                                     priority(prio)
+                    {
+                        int l = 1;
+                        l++;
+                    }
+                }
+            }
             #pragma omp task depend(in:a00[0:ma00k*na00k]) \
                              depend(in:a20[0:lda20*nvak]) \
                              depend(in:ipiv[k*A.mb:mvak]) \
                              depend(inout:a01[0:ldak*nvan]) \
                              depend(inout:a11[0:ma11k*na11n]) \
                              depend(inout:a21[0:lda21*nvan]) \
-                             priority(n == k+1)
+                             priority(prio)
+#endif
             {
                 if (sequence->status == PlasmaSuccess) {
                     // geswp
@@ -164,7 +889,7 @@ void plasma_pzgetrf(plasma_desc_t A, int *ipiv,
                         int mvam = plasma_tile_mview(A, m);
                         int ldam = plasma_tile_mmain(A, m);
 
-                        #pragma omp task priority(n == k+1)
+                        #pragma omp task priority(prio)
                         {
                             plasma_core_zgemm(
                                 PlasmaNoTrans, PlasmaNoTrans,
@@ -182,6 +907,16 @@ void plasma_pzgetrf(plasma_desc_t A, int *ipiv,
 
     // Multidependency of the whole ipiv on the individual chunks
     // corresponding to tiles.
+#if defined(PLASMA_USE_OMP_ITERATOR)
+    if (minmtnt > 1) {
+        #pragma omp task depend (iterator(m = 1:minmtnt), in:ipiv[m*A.mb]) \
+                         depend (inout:ipiv[0])
+        {
+            int l = 1;
+            l++;
+        }
+    }
+#else
     for (int m = 0; m < minmtnt; m++) {
         // insert dummy task
         #pragma omp task depend (in:ipiv[m*A.mb]) \
@@ -191,6 +926,7 @@ void plasma_pzgetrf(plasma_desc_t A, int *ipiv,
             l++;
         }
     }
+#endif
 
     // pivoting to the left
     for (int k = 0; k < minmtnt-1; k++) {
@@ -204,9 +940,16 @@ void plasma_pzgetrf(plasma_desc_t A, int *ipiv,
 
         int nvak = plasma_tile_nview(A, k);
 
+#if defined(PLASMA_USE_OMP_ITERATOR)
+        #pragma omp task depend(in:ipiv[0:imin(A.m,A.n)]) \
+                         depend(inout:a10[0:ma10k*na00k]) \
+                         depend(inout:a20[0:lda20*nvak]) \
+                         depend(iterator(m = k+2:A.mt-1), inout:*A(m, k))
+#else
         #pragma omp task depend(in:ipiv[0:imin(A.m,A.n)]) \
                          depend(inout:a10[0:ma10k*na00k]) \
                          depend(inout:a20[0:lda20*nvak])
+#endif
         {
             if (sequence->status == PlasmaSuccess) {
                 plasma_desc_t view =
@@ -217,6 +960,7 @@ void plasma_pzgetrf(plasma_desc_t A, int *ipiv,
             }
         }
 
+#if !defined(PLASMA_USE_OMP_ITERATOR)
         // Multidependency of individual tiles on the whole panel.
         for (int m = k+2; m < A.mt-1; m++) {
             plasma_complex64_t *amk = A(m, k);
@@ -229,5 +973,35 @@ void plasma_pzgetrf(plasma_desc_t A, int *ipiv,
                 l++;
             }
         }
+#endif
+    }
+
+#if !defined(PLASMA_USE_OMP_ITERATOR)
+    // Multidependency of individual tiles on the last panel,
+    // which is not pivoted to the left.
+    if (minmtnt > 0) {
+        int k = minmtnt-1;
+        plasma_complex64_t *a00 = A(k, k);
+        for (int m = k+1; m < A.mt-1; m++) {
+            plasma_complex64_t *amk = A(m, k);
+            #pragma omp task depend (in:a00[0]) \
+                             depend (inout:amk[0])
+            {
+                // Do some funny work here. It appears so that the compiler
+                // might not insert the task if it is completely empty.
+                int l = 1;
+                l++;
+            }
+        }
+    }
+#endif
+
+    // Release the tree once the last panel is factored, as each panel
+    // waits for the one before through the updates.
+    if (operations != NULL) {
+        int k = minmtnt-1;
+        int mvak = plasma_tile_mview(A, k);
+        #pragma omp task depend(in:ipiv[k*A.mb:mvak])
+        plasma_pool_free(&plasma->pool, operations);
     }
 }
@@ -0,0 +1,118 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "plasma_workspace.h"
+#include <plasma_core_blas.h>
+
+#define A(m, n) (plasma_complex64_t*)plasma_tile_addr(A, m, n)
+#define L(m, n) (plasma_complex64_t*)plasma_tile_addr(L, m, n)
+#define IPIV(m, n) &ipiv[A.mb*((m)+A.mt*(n))]
+
+/***************************************************************************//**
+ *  Records the first zero on the diagonal of the k-th tile once all the
+ *  tiles below it have been factored, as a zero pivot can still be
+ *  replaced by a row of a tile below until then.
+ ******************************************************************************/
+static void plasma_pzgetrf_incpiv_info(plasma_complex64_t *akk, int ldak,
+                                       int kk, int iinfo,
+                                       plasma_sequence_t *sequence)
+{
+    #pragma omp task depend(in:akk[0:ldak*kk])
+    {
+        if (sequence->status == PlasmaSuccess) {
+            int info = 0;
+            for (int i = 0; i < kk && info == 0; i++)
+                if (akk[i+i*ldak] == 0.0)
+                    info = iinfo+i+1;
+
+            // The columns complete out of order, so keep the first one.
+            int old = sequence->info;
+            while (info != 0 && (old == 0 || info < old)) {
+                if (__sync_bool_compare_and_swap(&sequence->info, old, info))
+                    break;
+                old = sequence->info;
+            }
+        }
+    }
+}
+
+/***************************************************************************//**
+ *  Parallel tile LU factorization with incremental pivoting - dynamic
+ *  scheduling. Rows are only interchanged within a diagonal tile or
+ *  between the diagonal tile and one tile below it at a time, so that the
+ *  panel is a chain of tile kernels instead of a synchronized panel.
+ *  ipiv holds A.mb entries per tile.
+ * @see plasma_omp_zgetrf_incpiv
+ ******************************************************************************/
+void plasma_pzgetrf_incpiv(plasma_desc_t A, plasma_desc_t L, int *ipiv,
+                           plasma_workspace_t work,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request)
+{
+    // Return if failed sequence.
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    // Set inner blocking from the L tile row-dimension.
+    int ib = L.mb;
+
+    for (int k = 0; k < imin(A.mt, A.nt); k++) {
+        int mvak = plasma_tile_mview(A, k);
+        int nvak = plasma_tile_nview(A, k);
+        int ldak = plasma_tile_mmain(A, k);
+        int kk = imin(mvak, nvak);
+        plasma_core_omp_zgetrf_incpiv(
+            mvak, nvak,
+            A(k, k), ldak, IPIV(k, k),
+            sequence, request);
+
+        for (int n = k+1; n < A.nt; n++) {
+            int nvan = plasma_tile_nview(A, n);
+            plasma_core_omp_zgessm(
+                mvak, nvan, kk,
+                IPIV(k, k),
+                A(k, k), ldak,
+                A(k, n), ldak,
+                sequence, request);
+        }
+        for (int m = k+1; m < A.mt; m++) {
+            int mvam = plasma_tile_mview(A, m);
+            int ldam = plasma_tile_mmain(A, m);
+            plasma_core_omp_ztstrf(
+                mvam, nvak, ib, A.mb,
+                A(k, k), ldak,
+                A(m, k), ldam,
+                L(m, k), L.mb,
+                IPIV(m, k),
+                work,
+                sequence, request);
+
+            for (int n = k+1; n < A.nt; n++) {
+                int nvan = plasma_tile_nview(A, n);
+                plasma_core_omp_zssssm(
+                    A.mb, nvan, mvam, nvan, nvak, ib,
+                    A(k, n), ldak,
+                    A(m, n), ldam,
+                    L(m, k), L.mb,
+                    A(m, k), ldam,
+                    IPIV(m, k),
+                    sequence, request);
+            }
+        }
+        plasma_pzgetrf_incpiv_info(A(k, k), ldak, kk, k*A.mb, sequence);
+    }
+}
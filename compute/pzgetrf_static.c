@@ -0,0 +1,189 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include <plasma_core_blas.h>
+
+#include <string.h>
+
+#include <omp.h>
+
+#define A(m, n) (plasma_complex64_t*)plasma_tile_addr(A, m, n)
+
+/******************************************************************************/
+static void plasma_pzgetrf_static_panel(
+    plasma_context_t *plasma, plasma_desc_t A, int *ipiv, int k,
+    plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    if (sequence->status == PlasmaSuccess) {
+        int nvak = plasma_tile_nview(A, k);
+        plasma_desc_t view =
+            plasma_desc_view(A, k*A.mb, k*A.nb, A.m-k*A.mb, nvak);
+
+        // The owner of the column factors the panel alone.
+        plasma_pivot_t pivot;
+        volatile int info = 0;
+        plasma_barrier_t barrier;
+        plasma_barrier_init(&barrier);
+        plasma_core_zgetrf(view, &ipiv[k*A.mb], plasma->ib,
+                           0, 1, &pivot, &info, &barrier);
+
+        // A zero pivot does not stop the factorization, as in LAPACK.
+        // Record the first one and let the caller decide.
+        if (info != 0 && sequence->info == 0)
+            sequence->info = k*A.mb+info;
+
+        for (int i = k*A.mb+1; i <= imin(A.m, k*A.mb+nvak); i++)
+            ipiv[i-1] += k*A.mb;
+    }
+    ss_cond_set(k, 0, 1);
+}
+
+/******************************************************************************/
+static void plasma_pzgetrf_static_update(
+    plasma_context_t *plasma, plasma_desc_t A, int *ipiv, int k, int n,
+    plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    ss_cond_wait(k, 0, 1);
+    if (sequence->status == PlasmaSuccess) {
+        int mvak = plasma_tile_mview(A, k);
+        int ldak = plasma_tile_mmain(A, k);
+        int nvan = plasma_tile_nview(A, n);
+
+        // geswp
+        int k1 = k*A.mb+1;
+        int k2 = imin(k*A.mb+A.mb, A.m);
+        plasma_desc_t view = plasma_desc_view(A, 0, n*A.nb, A.m, nvan);
+        plasma_core_zgeswp(PlasmaRowwise, view, k1, k2, ipiv, 1);
+
+        // trsm
+        plasma_core_ztrsm(PlasmaLeft, PlasmaLower,
+                          PlasmaNoTrans, PlasmaUnit,
+                          mvak, nvan,
+                          1.0, A(k, k), ldak,
+                               A(k, n), ldak);
+        // gemm
+        for (int m = k+1; m < A.mt; m++) {
+            int mvam = plasma_tile_mview(A, m);
+            int ldam = plasma_tile_mmain(A, m);
+            plasma_core_zgemm(PlasmaNoTrans, PlasmaNoTrans,
+                              mvam, nvan, A.nb,
+                              -1.0, A(m, k), ldam,
+                                    A(k, n), ldak,
+                              1.0,  A(m, n), ldam);
+        }
+    }
+}
+
+/***************************************************************************//**
+ *  Executes the columns owned by rank in the global order of the static
+ *  schedule, as in plasma_pzpotrf_static(), then pivots them to the left
+ *  once all the ranks are done with the factorization.
+ ******************************************************************************/
+static void plasma_pzgetrf_static_rank(
+    plasma_context_t *plasma, plasma_desc_t A, int *ipiv,
+    int lookahead, int rank, int nthread, plasma_barrier_t *barrier,
+    plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    int minmtnt = imin(A.mt, A.nt);
+
+    for (int s = 0; s < A.nt; s++) {
+        if (s%nthread == rank) {
+            for (int k = imax(0, s-lookahead); k < imin(s, minmtnt); k++)
+                plasma_pzgetrf_static_update(plasma, A, ipiv, k, s,
+                                             sequence, request);
+
+            if (s < minmtnt)
+                plasma_pzgetrf_static_panel(plasma, A, ipiv, s,
+                                            sequence, request);
+        }
+        int k = s-lookahead;
+        if (k >= 0 && k < minmtnt) {
+            for (int n = s+1; n < A.nt; n++) {
+                if (n%nthread == rank)
+                    plasma_pzgetrf_static_update(plasma, A, ipiv, k, n,
+                                                 sequence, request);
+            }
+        }
+    }
+
+    // The left columns are read by the updates until the end.
+    plasma_barrier_wait(barrier, rank, nthread);
+
+    // pivoting to the left
+    for (int k = rank; k < minmtnt-1; k += nthread) {
+        if (sequence->status == PlasmaSuccess) {
+            plasma_desc_t view =
+                plasma_desc_view(A, 0, k*A.nb, A.m, A.nb);
+            int k1 = (k+1)*A.mb+1;
+            int k2 = imin(A.m, A.n);
+            plasma_core_zgeswp(PlasmaRowwise, view, k1, k2, ipiv, 1);
+        }
+    }
+}
+
+/***************************************************************************//**
+ *  Parallel tile LU factorization with partial pivoting - static scheduling.
+ *  Columns of tiles are distributed 1D cyclic over the threads of the team,
+ *  as the pivoting of a column involves all its tiles. The threads
+ *  synchronize through the progress table of the context.
+ *  All the threads of the team must be available to execute the ranks.
+ * @see plasma_omp_zgetrf
+ ******************************************************************************/
+void plasma_pzgetrf_static(plasma_desc_t A, int *ipiv,
+                           plasma_context_t *plasma,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request)
+{
+    // Return if failed sequence.
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    // Complete the tasks producing A.
+    #pragma omp taskwait
+
+    // Initialize static scheduler progress table, from the memory pool.
+    size_t lprogress = (size_t)A.nt*sizeof(int);
+    plasma->ss_progress =
+        (volatile int*)plasma_pool_alloc(&plasma->pool, lprogress);
+    if (plasma->ss_progress == NULL) {
+        plasma_request_fail(sequence, request, PlasmaErrorOutOfMemory);
+        return;
+    }
+    memset((void*)plasma->ss_progress, 0, lprogress);
+    plasma->ss_ld = A.nt;
+    plasma->ss_abort = 0;
+
+    int nthread = omp_get_num_threads();
+    plasma_barrier_t barrier;
+    plasma_barrier_init(&barrier);
+
+    int lookahead = plasma->lookahead;
+    for (int rank = 1; rank < nthread; rank++) {
+        #pragma omp task firstprivate(rank) shared(barrier)
+        plasma_pzgetrf_static_rank(plasma, A, ipiv, lookahead,
+                                   rank, nthread, &barrier,
+                                   sequence, request);
+    }
+    plasma_pzgetrf_static_rank(plasma, A, ipiv, lookahead,
+                               0, nthread, &barrier,
+                               sequence, request);
+
+    #pragma omp taskwait
+
+    plasma_pool_free(&plasma->pool, (void*)plasma->ss_progress);
+    plasma->ss_progress = NULL;
+}
@@ -21,6 +21,87 @@
 #define A(m, n) (plasma_complex64_t*)plasma_tile_addr(A, m, n)
 #define C(m, n) (plasma_complex64_t*)plasma_tile_addr(C, m, n)
 
+#if defined(PLASMA_USE_OMP_ITERATOR)
+/***************************************************************************//**
+ *  Inserts one task accumulating the rank updates of the tiles k1 <= k < k2
+ *  of A into the diagonal tile C(n, n).
+ ******************************************************************************/
+static void plasma_pzherk_chain(plasma_enum_t uplo, plasma_enum_t trans,
+                                double alpha, plasma_desc_t A,
+                                double beta,  plasma_desc_t C,
+                                int n, int k1, int k2,
+                                plasma_sequence_t *sequence,
+                                plasma_request_t *request)
+{
+    int nvcn = plasma_tile_nview(C, n);
+    int ldcn = plasma_tile_mmain(C, n);
+    plasma_complex64_t *cnn = C(n, n);
+    int t = trans == PlasmaNoTrans;
+
+    #pragma omp task depend(iterator(k = k1:k2), \
+                         in:*A(t ? n : k, t ? k : n)) \
+                     depend(inout:cnn[0:ldcn*nvcn]) \
+                     affinity(cnn[0:ldcn*nvcn])
+    {
+        for (int k = k1; k < k2 && sequence->status == PlasmaSuccess; k++) {
+            double dbeta = k == 0 ? beta : 1.0;
+            if (trans == PlasmaNoTrans)
+                plasma_core_zherk(uplo, trans,
+                                  nvcn, plasma_tile_nview(A, k),
+                                  alpha, A(n, k), plasma_tile_mmain(A, n),
+                                  dbeta, cnn, ldcn);
+            else
+                plasma_core_zherk(uplo, trans,
+                                  nvcn, plasma_tile_mview(A, k),
+                                  alpha, A(k, n), plasma_tile_mmain(A, k),
+                                  dbeta, cnn, ldcn);
+        }
+    }
+}
+
+/***************************************************************************//**
+ *  Inserts one task accumulating the products of the tiles k1 <= k < k2
+ *  of the rows (columns) i and j of A into the off-diagonal tile C(i, j).
+ ******************************************************************************/
+static void plasma_pzherk_gemm_chain(plasma_enum_t trans,
+                                     double alpha, plasma_desc_t A,
+                                     double beta,  plasma_desc_t C,
+                                     int i, int j, int k1, int k2,
+                                     plasma_sequence_t *sequence,
+                                     plasma_request_t *request)
+{
+    int mvci = plasma_tile_mview(C, i);
+    int nvcj = plasma_tile_nview(C, j);
+    int ldci = plasma_tile_mmain(C, i);
+    plasma_complex64_t *cij = C(i, j);
+    int t = trans == PlasmaNoTrans;
+
+    #pragma omp task depend(iterator(k = k1:k2), \
+                         in:*A(t ? i : k, t ? k : i)) \
+                     depend(iterator(k = k1:k2), \
+                         in:*A(t ? j : k, t ? k : j)) \
+                     depend(inout:cij[0:ldci*nvcj]) \
+                     affinity(cij[0:ldci*nvcj])
+    {
+        for (int k = k1; k < k2 && sequence->status == PlasmaSuccess; k++) {
+            plasma_complex64_t zbeta = k == 0 ? beta : 1.0;
+            if (trans == PlasmaNoTrans)
+                plasma_core_zgemm(trans, PlasmaConjTrans,
+                                  mvci, nvcj, plasma_tile_nview(A, k),
+                                  alpha, A(i, k), plasma_tile_mmain(A, i),
+                                         A(j, k), plasma_tile_mmain(A, j),
+                                  zbeta, cij, ldci);
+            else
+                plasma_core_zgemm(trans, PlasmaNoTrans,
+                                  mvci, nvcj, plasma_tile_mview(A, k),
+                                  alpha, A(k, i), plasma_tile_mmain(A, k),
+                                         A(k, j), plasma_tile_mmain(A, k),
+                                  zbeta, cij, ldci);
+        }
+    }
+}
+#endif
+
 /***************************************************************************//**
  * Parallel tile Hermitian rank k update.
  * @see plasma_omp_zherk
@@ -34,6 +115,33 @@ void plasma_pzherk(plasma_enum_t uplo, plasma_enum_t trans,
     if (sequence->status != PlasmaSuccess)
         return;
 
+#if defined(PLASMA_USE_OMP_ITERATOR)
+    // With a granularity set, group the k-chain of each tile of C
+    // into tasks of chunk tiles.
+    plasma_context_t *plasma = plasma_context_self();
+    int kt = trans == PlasmaNoTrans ? A.nt : A.mt;
+    int kb = trans == PlasmaNoTrans ? A.nb : A.mb;
+    int chunk = plasma_chunk(plasma->granularity, 2.0*C.mb*C.nb*kb);
+    if (chunk > 1) {
+        for (int n = 0; n < C.nt; n++) {
+            for (int k = 0; k < kt; k += chunk)
+                plasma_pzherk_chain(uplo, trans, alpha, A, beta, C,
+                                    n, k, imin(k+chunk, kt),
+                                    sequence, request);
+
+            for (int m = n+1; m < C.mt; m++) {
+                int i = uplo == PlasmaLower ? m : n;
+                int j = uplo == PlasmaLower ? n : m;
+                for (int k = 0; k < kt; k += chunk)
+                    plasma_pzherk_gemm_chain(trans, alpha, A, beta, C,
+                                             i, j, k, imin(k+chunk, kt),
+                                             sequence, request);
+            }
+        }
+        return;
+    }
+#endif
+
     for (int n = 0; n < C.nt; n++) {
         int nvcn = plasma_tile_nview(C, n);
         int ldan = plasma_tile_mmain(A, n);
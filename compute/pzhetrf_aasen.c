@@ -19,6 +19,8 @@
 #include "plasma_workspace.h"
 #include <plasma_core_blas.h>
 
+#include <omp.h>
+
 #define A(m, n) ((plasma_complex64_t*)plasma_tile_addr(A, (m), (n)))
 #define L(m, n) ((plasma_complex64_t*)plasma_tile_addr(A, (m), (n)-1))
 #define U(m, n) ((plasma_complex64_t*)plasma_tile_addr(A, (m)-1, (n)))
@@ -60,6 +62,9 @@ void plasma_pzhetrf_aasen(plasma_enum_t uplo,
     int ib = plasma->ib;
     int wmt = W.mt-(1+4*A.mt);
 
+    // The panels draw their buffers from the arena of the context.
+    plasma_arena_t *arena = &plasma->arena;
+
     // Creaet views for the workspaces
     plasma_desc_t W2
          = plasma_desc_view(W, A.mb,            0,   A.mt*A.mb, A.nb);
@@ -426,23 +431,18 @@ void plasma_pzhetrf_aasen(plasma_enum_t uplo,
                 int k1 = 1+(k+1)*A.nb;
                 int k2 = imin(mlkk, mvak)+(k+1)*A.nb;
 
-                int num_panel_threads = imin(plasma->max_panel_threads,
+                int num_panel_threads = imin(imin(plasma->max_panel_threads,
+                                                  plasma->max_threads),
                                              A.mt-(k+1));
 
                 #pragma omp task depend(inout:a1[0:ma1*na]) \
                                  depend(inout:a2[0:ma2*na]) \
                                  depend(out:ipiv[k1-1:k2])
                 {
-                    volatile int *max_idx =
-                        (int*)malloc(num_panel_threads*sizeof(int));
-                    if (max_idx == NULL)
-                        plasma_request_fail(sequence, request,
-                                            PlasmaErrorOutOfMemory);
-
-                    volatile plasma_complex64_t *max_val =
-                        (plasma_complex64_t*)malloc(num_panel_threads*sizeof(
-                                                    plasma_complex64_t));
-                    if (max_val == NULL)
+                    int tid = omp_get_thread_num();
+                    plasma_pivot_t *pivot = (plasma_pivot_t*)plasma_arena_push(
+                        arena, tid, num_panel_threads*sizeof(plasma_pivot_t));
+                    if (pivot == NULL)
                         plasma_request_fail(sequence, request,
                                             PlasmaErrorOutOfMemory);
 
@@ -451,29 +451,41 @@ void plasma_pzhetrf_aasen(plasma_enum_t uplo,
                     plasma_barrier_t barrier;
                     plasma_barrier_init(&barrier);
 
+                    plasma_team_t team;
+                    plasma_team_init(&team, num_panel_threads,
+                                     plasma->team_wait);
+
                     if (sequence->status == PlasmaSuccess) {
-                        for (int rank = 0; rank < num_panel_threads; rank++) {
-                            #pragma omp task shared(barrier)
+                        plasma_desc_t view =
+                            plasma_desc_view(A,
+                                            (k+1)*A.mb, k*A.nb,
+                                             mlkk, mvak);
+
+                        // Only the helpers joining the team take part
+                        // in the panel.
+                        for (int i = 1; i < num_panel_threads; i++) {
+                            #pragma omp task shared(team, barrier, info)
                             {
-                                plasma_desc_t view =
-                                    plasma_desc_view(A,
-                                                    (k+1)*A.mb, k*A.nb,
-                                                     mlkk, mvak);
-
-                                plasma_core_zgetrf(view, IPIV(k+1), ib,
-                                            rank, num_panel_threads,
-                                            max_idx, max_val, &info,
-                                            &barrier);
-
-                                if (info != 0)
-                                    plasma_request_fail(sequence, request,
-                                                        (k+1)*A.mb+info);
+                                int rank = plasma_team_join(&team);
+                                if (rank > 0)
+                                    plasma_core_zgetrf(view, IPIV(k+1), ib,
+                                                       rank, team.size,
+                                                       pivot, &info,
+                                                       &barrier);
                             }
                         }
+                        int size = plasma_team_close(&team);
+                        plasma_core_zgetrf(view, IPIV(k+1), ib,
+                                           0, size,
+                                           pivot, &info,
+                                           &barrier);
                     }
                     #pragma omp taskwait
-                    free((void*)max_idx);
-                    free((void*)max_val);
+
+                    if (info != 0)
+                        plasma_request_fail(sequence, request,
+                                            (k+1)*A.mb+info);
+                    plasma_arena_pop(arena, tid, pivot);
                     {
                         for (int i = 0; i < imin(mlkk, mvak); i++) {
                             IPIV(k+1)[i] += (k+1)*A.mb;
@@ -547,7 +559,8 @@ void plasma_pzhetrf_aasen(plasma_enum_t uplo,
                     a1 = A(k+1, k+1);
                     a2 = A(A.mt-1, k+1);
 
-                    int num_swap_threads = imin(plasma->max_panel_threads,
+                    int num_swap_threads = imin(imin(plasma->max_panel_threads,
+                                                     plasma->max_threads),
                                                 A.mt-(k+1));
 
                     #pragma omp task depend(in:ipiv[(k1-1):k2]) \
@@ -556,12 +569,26 @@ void plasma_pzhetrf_aasen(plasma_enum_t uplo,
                     {
                         plasma_barrier_t barrier;
                         plasma_barrier_init(&barrier);
-                        for (int rank = 0; rank < num_swap_threads; rank++) {
-                            #pragma omp task shared(barrier)
+
+                        plasma_team_t team;
+                        plasma_team_init(&team, num_swap_threads,
+                                         plasma->team_wait);
+
+                        // Only the helpers joining the team take part
+                        // in the swaps.
+                        for (int i = 1; i < num_swap_threads; i++) {
+                            #pragma omp task shared(team, barrier)
                             {
-                                plasma_core_zheswp(rank, num_swap_threads, PlasmaLower, A, k1, k2, ipiv, 1, &barrier);
+                                int rank = plasma_team_join(&team);
+                                if (rank > 0)
+                                    plasma_core_zheswp(rank, team.size,
+                                                       PlasmaLower, A, k1, k2,
+                                                       ipiv, 1, &barrier);
                             }
                         }
+                        int size = plasma_team_close(&team);
+                        plasma_core_zheswp(0, size, PlasmaLower, A, k1, k2,
+                                           ipiv, 1, &barrier);
                         #pragma omp taskwait
                     }
                 }
@@ -0,0 +1,85 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+
+
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "plasma_workspace.h"
+#include <plasma_core_blas.h>
+
+#define A(m, n) (plasma_complex64_t*)plasma_tile_addr(A, m, n)
+
+/***************************************************************************//**
+ *  Parallel tile LDL^H factorization without pivoting, of the lower
+ *  triangle of A.
+ * @see plasma_omp_zhesv_rbt
+ ******************************************************************************/
+void plasma_pzhetrf_nopiv(plasma_enum_t uplo, plasma_desc_t A,
+                          plasma_workspace_t work,
+                          plasma_sequence_t *sequence,
+                          plasma_request_t *request)
+{
+    // Return if failed sequence.
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    for (int k = 0; k < A.mt; k++) {
+        int mvak = plasma_tile_mview(A, k);
+        int ldak = plasma_tile_mmain(A, k);
+        plasma_complex64_t *Dk = A(k, k);
+        plasma_core_omp_zhetrf_nopiv(
+            PlasmaLower, mvak,
+            A(k, k), ldak,
+            A.mb*k,
+            sequence, request);
+
+        // L(m, k) = A(m, k) * L(k, k)^{-H} * D(k)^{-1}
+        for (int m = k+1; m < A.mt; m++) {
+            int mvam = plasma_tile_mview(A, m);
+            int ldam = plasma_tile_mmain(A, m);
+            plasma_core_omp_ztrsm(
+                PlasmaRight, PlasmaLower,
+                PlasmaConjTrans, PlasmaUnit,
+                mvam, mvak,
+                1.0, A(k, k), ldak,
+                     A(m, k), ldam,
+                sequence, request);
+
+            plasma_core_omp_zlascl_diag(
+                PlasmaRight, mvam, mvak,
+                Dk, ldak+1,
+                A(m, k), ldam,
+                sequence, request);
+        }
+
+        // A(m, n) -= L(m, k) * D(k) * L(n, k)^H
+        for (int m = k+1; m < A.mt; m++) {
+            int mvam = plasma_tile_mview(A, m);
+            int ldam = plasma_tile_mmain(A, m);
+            for (int n = k+1; n <= m; n++) {
+                int mvan = plasma_tile_mview(A, n);
+                int ldan = plasma_tile_mmain(A, n);
+                plasma_core_omp_zgemdm(
+                    mvam, mvan, mvak,
+                    -1.0, A(m, k), ldam,
+                          Dk, ldak+1,
+                          A(n, k), ldan,
+                     1.0, A(m, n), ldam,
+                    work,
+                    sequence, request);
+            }
+        }
+    }
+}
@@ -0,0 +1,60 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+
+
+#include "plasma_async.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include <plasma_core_blas.h>
+
+#define A(m, n) (plasma_complex64_t*)plasma_tile_addr(A, m, n)
+#define B(m, n) (plasma_complex64_t*)plasma_tile_addr(B, m, n)
+
+/***************************************************************************//**
+ *  Parallel solve with the tile LDL^H factorization without pivoting
+ *  of plasma_pzhetrf_nopiv.
+ * @see plasma_omp_zhesv_rbt
+ ******************************************************************************/
+void plasma_pzhetrs_nopiv(plasma_enum_t uplo, plasma_desc_t A,
+                          plasma_desc_t B,
+                          plasma_sequence_t *sequence,
+                          plasma_request_t *request)
+{
+    // Return if failed sequence.
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    plasma_pztrsm(PlasmaLeft, PlasmaLower, PlasmaNoTrans, PlasmaUnit,
+                  1.0, A,
+                       B,
+                  sequence, request);
+
+    for (int k = 0; k < B.mt; k++) {
+        int mvbk = plasma_tile_mview(B, k);
+        int ldak = plasma_tile_mmain(A, k);
+        int ldbk = plasma_tile_mmain(B, k);
+        for (int n = 0; n < B.nt; n++) {
+            int nvbn = plasma_tile_nview(B, n);
+            plasma_core_omp_zlascl_diag(
+                PlasmaLeft, mvbk, nvbn,
+                A(k, k), ldak+1,
+                B(k, n), ldbk,
+                sequence, request);
+        }
+    }
+
+    plasma_pztrsm(PlasmaLeft, PlasmaLower, PlasmaConjTrans, PlasmaUnit,
+                  1.0, A,
+                       B,
+                  sequence, request);
+}
@@ -21,16 +21,14 @@
 #define A(m, n) (plasma_complex64_t*)plasma_tile_addr(A, m, n)
 
 /***************************************************************************//**
- *  Parallel tile Cholesky factorization.
- * @see plasma_omp_zpotrf
+ *  Inserts the tasks of the tile Cholesky factorization in a task graph
+ *  of the native runtime.
  ******************************************************************************/
-void plasma_pzpotrf(plasma_enum_t uplo, plasma_desc_t A,
-                    plasma_sequence_t *sequence, plasma_request_t *request)
+static void plasma_pzpotrf_dag(plasma_enum_t uplo, plasma_desc_t A,
+                               plasma_dag_t *dag,
+                               plasma_sequence_t *sequence,
+                               plasma_request_t *request)
 {
-    // Return if failed sequence.
-    if (sequence->status != PlasmaSuccess)
-        return;
-
     //==============
     // PlasmaLower
     //==============
@@ -38,7 +36,8 @@ void plasma_pzpotrf(plasma_enum_t uplo, plasma_desc_t A,
         for (int k = 0; k < A.mt; k++) {
             int mvak = plasma_tile_mview(A, k);
             int ldak = plasma_tile_mmain(A, k);
-            plasma_core_omp_zpotrf(
+            plasma_core_rt_zpotrf(
+                dag,
                 PlasmaLower, mvak,
                 A(k, k), ldak,
                 A.nb*k,
@@ -47,7 +46,8 @@ void plasma_pzpotrf(plasma_enum_t uplo, plasma_desc_t A,
             for (int m = k+1; m < A.mt; m++) {
                 int mvam = plasma_tile_mview(A, m);
                 int ldam = plasma_tile_mmain(A, m);
-                plasma_core_omp_ztrsm(
+                plasma_core_rt_ztrsm(
+                    dag,
                     PlasmaRight, PlasmaLower,
                     PlasmaConjTrans, PlasmaNonUnit,
                     mvam, A.mb,
@@ -58,7 +58,8 @@ void plasma_pzpotrf(plasma_enum_t uplo, plasma_desc_t A,
             for (int m = k+1; m < A.mt; m++) {
                 int mvam = plasma_tile_mview(A, m);
                 int ldam = plasma_tile_mmain(A, m);
-                plasma_core_omp_zherk(
+                plasma_core_rt_zherk(
+                    dag,
                     PlasmaLower, PlasmaNoTrans,
                     mvam, A.mb,
                     -1.0, A(m, k), ldam,
@@ -67,7 +68,8 @@ void plasma_pzpotrf(plasma_enum_t uplo, plasma_desc_t A,
 
                 for (int n = k+1; n < m; n++) {
                     int ldan = plasma_tile_mmain(A, n);
-                    plasma_core_omp_zgemm(
+                    plasma_core_rt_zgemm(
+                        dag,
                         PlasmaNoTrans, PlasmaConjTrans,
                         mvam, A.mb, A.mb,
                         -1.0, A(m, k), ldam,
@@ -85,7 +87,8 @@ void plasma_pzpotrf(plasma_enum_t uplo, plasma_desc_t A,
         for (int k = 0; k < A.nt; k++) {
             int nvak = plasma_tile_nview(A, k);
             int ldak = plasma_tile_mmain(A, k);
-            plasma_core_omp_zpotrf(
+            plasma_core_rt_zpotrf(
+                dag,
                 PlasmaUpper, nvak,
                 A(k, k), ldak,
                 A.nb*k,
@@ -93,7 +96,8 @@ void plasma_pzpotrf(plasma_enum_t uplo, plasma_desc_t A,
 
             for (int m = k+1; m < A.nt; m++) {
                 int nvam = plasma_tile_nview(A, m);
-                plasma_core_omp_ztrsm(
+                plasma_core_rt_ztrsm(
+                    dag,
                     PlasmaLeft, PlasmaUpper,
                     PlasmaConjTrans, PlasmaNonUnit,
                     A.nb, nvam,
@@ -104,7 +108,8 @@ void plasma_pzpotrf(plasma_enum_t uplo, plasma_desc_t A,
             for (int m = k+1; m < A.nt; m++) {
                 int nvam = plasma_tile_nview(A, m);
                 int ldam = plasma_tile_mmain(A, m);
-                plasma_core_omp_zherk(
+                plasma_core_rt_zherk(
+                    dag,
                     PlasmaUpper, PlasmaConjTrans,
                     nvam, A.mb,
                     -1.0, A(k, m), ldak,
@@ -113,7 +118,8 @@ void plasma_pzpotrf(plasma_enum_t uplo, plasma_desc_t A,
 
                 for (int n = k+1; n < m; n++) {
                     int ldan = plasma_tile_mmain(A, n);
-                    plasma_core_omp_zgemm(
+                    plasma_core_rt_zgemm(
+                        dag,
                         PlasmaConjTrans, PlasmaNoTrans,
                         A.mb, nvam, A.mb,
                         -1.0, A(k, n), ldak,
@@ -125,3 +131,281 @@ void plasma_pzpotrf(plasma_enum_t uplo, plasma_desc_t A,
         }
     }
 }
+
+/***************************************************************************//**
+ *  Parallel tile Cholesky factorization.
+ * @see plasma_omp_zpotrf
+ ******************************************************************************/
+void plasma_pzpotrf(plasma_enum_t uplo, plasma_desc_t A,
+                    plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    // Return if failed sequence.
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma->runtime == PlasmaRuntimeStatic) {
+        plasma_pzpotrf_static(uplo, A, plasma, sequence, request);
+        return;
+    }
+
+    // With the native runtime, build the task graph while earlier tasks
+    // complete, or replay the one recorded for this shape, then run it.
+    if (plasma->runtime == PlasmaRuntimeNative) {
+        plasma_dag_t local;
+        plasma_dag_t *dag = NULL;
+        if (plasma->replay == PlasmaEnabled) {
+            const void *base[] = { A.matrix };
+            dag = plasma_graph_lookup(&plasma->graphs, "zpotrf", uplo, A,
+                                      1, base);
+            if (dag == NULL) {
+                dag = plasma_graph_record(&plasma->graphs, "zpotrf", uplo, A,
+                                          1, base);
+                if (dag != NULL)
+                    plasma_pzpotrf_dag(uplo, A, dag, sequence, request);
+            }
+        }
+        if (dag == NULL) {
+            dag = &local;
+            plasma_dag_init(dag);
+            plasma_pzpotrf_dag(uplo, A, dag, sequence, request);
+        }
+
+        #pragma omp taskwait
+        if (sequence->status == PlasmaSuccess)
+            plasma_dag_run(dag, sequence, request);
+
+        if (dag == &local)
+            plasma_dag_destroy(dag);
+        else if (dag->status != PlasmaSuccess)
+            plasma_graph_remove(&plasma->graphs, dag);
+        return;
+    }
+
+    // The tasks are those of plasma_core_omp_zpotrf(), plasma_core_omp_ztrsm(),
+    // plasma_core_omp_zherk() and plasma_core_omp_zgemm(), prioritized
+    // by the column (row) they update.
+    int lookahead = plasma->lookahead;
+
+    // With a granularity set, the gemm updates of a column (row) in a step
+    // are grouped into tasks of chunk tiles (only with iterator
+    // dependencies).
+    int chunk = 1;
+#if defined(PLASMA_USE_OMP_ITERATOR)
+    chunk = plasma_chunk(plasma->granularity, 2.0*A.mb*A.mb*A.mb);
+#endif
+
+    //==============
+    // PlasmaLower
+    //==============
+    if (uplo == PlasmaLower) {
+        for (int k = 0; k < A.mt; k++) {
+            int mvak = plasma_tile_mview(A, k);
+            int ldak = plasma_tile_mmain(A, k);
+            plasma_complex64_t *akk = A(k, k);
+            #pragma omp task depend(inout:akk[0:ldak*mvak]) \
+                             affinity(akk[0:ldak*mvak]) \
+                             priority(plasma_priority(lookahead, k, k))
+            {
+                if (sequence->status == PlasmaSuccess) {
+                    int info = plasma_core_zpotrf(PlasmaLower, mvak,
+                                                  akk, ldak);
+                    if (info != 0)
+                        plasma_request_fail(sequence, request, A.nb*k+info);
+                }
+            }
+
+            for (int m = k+1; m < A.mt; m++) {
+                int mvam = plasma_tile_mview(A, m);
+                int ldam = plasma_tile_mmain(A, m);
+                plasma_complex64_t *amk = A(m, k);
+                #pragma omp task depend(in:akk[0:ldak*A.mb]) \
+                                 depend(inout:amk[0:ldam*A.mb]) \
+                                 affinity(amk[0:ldam*A.mb]) \
+                                 priority(plasma_priority(lookahead, k, k))
+                {
+                    if (sequence->status == PlasmaSuccess)
+                        plasma_core_ztrsm(
+                            PlasmaRight, PlasmaLower,
+                            PlasmaConjTrans, PlasmaNonUnit,
+                            mvam, A.mb,
+                            1.0, akk, ldak,
+                                 amk, ldam);
+                }
+            }
+            for (int m = k+1; m < A.mt; m++) {
+                int mvam = plasma_tile_mview(A, m);
+                int ldam = plasma_tile_mmain(A, m);
+                plasma_complex64_t *amk = A(m, k);
+                plasma_complex64_t *amm = A(m, m);
+                #pragma omp task depend(in:amk[0:ldam*A.mb]) \
+                                 depend(inout:amm[0:ldam*mvam]) \
+                                 affinity(amm[0:ldam*mvam]) \
+                                 priority(plasma_priority(lookahead, k, m))
+                {
+                    if (sequence->status == PlasmaSuccess)
+                        plasma_core_zherk(
+                            PlasmaLower, PlasmaNoTrans,
+                            mvam, A.mb,
+                            -1.0, amk, ldam,
+                             1.0, amm, ldam);
+                }
+
+                for (int n = k+1; n < m && chunk == 1; n++) {
+                    int ldan = plasma_tile_mmain(A, n);
+                    plasma_complex64_t *ank = A(n, k);
+                    plasma_complex64_t *amn = A(m, n);
+                    #pragma omp task depend(in:amk[0:ldam*A.mb]) \
+                                     depend(in:ank[0:ldan*A.mb]) \
+                                     depend(inout:amn[0:ldam*A.mb]) \
+                                     affinity(amn[0:ldam*A.mb]) \
+                                     priority(plasma_priority(lookahead, k, n))
+                    {
+                        if (sequence->status == PlasmaSuccess)
+                            plasma_core_zgemm(
+                                PlasmaNoTrans, PlasmaConjTrans,
+                                mvam, A.mb, A.mb,
+                                -1.0, amk, ldam,
+                                      ank, ldan,
+                                 1.0, amn, ldam);
+                    }
+                }
+            }
+#if defined(PLASMA_USE_OMP_ITERATOR)
+            for (int n = k+1; n < A.mt && chunk > 1; n++) {
+                int ldan = plasma_tile_mmain(A, n);
+                plasma_complex64_t *ank = A(n, k);
+                int prio = plasma_priority(lookahead, k, n);
+                for (int m1 = n+1; m1 < A.mt; m1 += chunk) {
+                    int m2 = imin(m1+chunk, A.mt);
+                    #pragma omp task depend(in:ank[0:ldan*A.mb]) \
+                                     depend(iterator(m = m1:m2), \
+                                            in:*A(m, k)) \
+                                     depend(iterator(m = m1:m2), \
+                                            inout:*A(m, n)) \
+                                     priority(prio)
+                    {
+                        for (int m = m1; m < m2; m++) {
+                            if (sequence->status != PlasmaSuccess)
+                                break;
+                            int mvam = plasma_tile_mview(A, m);
+                            int ldam = plasma_tile_mmain(A, m);
+                            plasma_core_zgemm(
+                                PlasmaNoTrans, PlasmaConjTrans,
+                                mvam, A.mb, A.mb,
+                                -1.0, A(m, k), ldam,
+                                      ank, ldan,
+                                 1.0, A(m, n), ldam);
+                        }
+                    }
+                }
+            }
+#endif
+        }
+    }
+    //==============
+    // PlasmaUpper
+    //==============
+    else {
+        for (int k = 0; k < A.nt; k++) {
+            int nvak = plasma_tile_nview(A, k);
+            int ldak = plasma_tile_mmain(A, k);
+            plasma_complex64_t *akk = A(k, k);
+            #pragma omp task depend(inout:akk[0:ldak*nvak]) \
+                             affinity(akk[0:ldak*nvak]) \
+                             priority(plasma_priority(lookahead, k, k))
+            {
+                if (sequence->status == PlasmaSuccess) {
+                    int info = plasma_core_zpotrf(PlasmaUpper, nvak,
+                                                  akk, ldak);
+                    if (info != 0)
+                        plasma_request_fail(sequence, request, A.nb*k+info);
+                }
+            }
+
+            for (int m = k+1; m < A.nt; m++) {
+                int nvam = plasma_tile_nview(A, m);
+                plasma_complex64_t *akm = A(k, m);
+                #pragma omp task depend(in:akk[0:ldak*A.nb]) \
+                                 depend(inout:akm[0:ldak*nvam]) \
+                                 affinity(akm[0:ldak*nvam]) \
+                                 priority(plasma_priority(lookahead, k, k))
+                {
+                    if (sequence->status == PlasmaSuccess)
+                        plasma_core_ztrsm(
+                            PlasmaLeft, PlasmaUpper,
+                            PlasmaConjTrans, PlasmaNonUnit,
+                            A.nb, nvam,
+                            1.0, akk, ldak,
+                                 akm, ldak);
+                }
+            }
+            for (int m = k+1; m < A.nt; m++) {
+                int nvam = plasma_tile_nview(A, m);
+                int ldam = plasma_tile_mmain(A, m);
+                plasma_complex64_t *akm = A(k, m);
+                plasma_complex64_t *amm = A(m, m);
+                #pragma omp task depend(in:akm[0:ldak*nvam]) \
+                                 depend(inout:amm[0:ldam*nvam]) \
+                                 affinity(amm[0:ldam*nvam]) \
+                                 priority(plasma_priority(lookahead, k, m))
+                {
+                    if (sequence->status == PlasmaSuccess)
+                        plasma_core_zherk(
+                            PlasmaUpper, PlasmaConjTrans,
+                            nvam, A.mb,
+                            -1.0, akm, ldak,
+                             1.0, amm, ldam);
+                }
+
+                for (int n = k+1; n < m && chunk == 1; n++) {
+                    int ldan = plasma_tile_mmain(A, n);
+                    plasma_complex64_t *akn = A(k, n);
+                    plasma_complex64_t *anm = A(n, m);
+                    #pragma omp task depend(in:akn[0:ldak*A.mb]) \
+                                     depend(in:akm[0:ldak*nvam]) \
+                                     depend(inout:anm[0:ldan*nvam]) \
+                                     affinity(anm[0:ldan*nvam]) \
+                                     priority(plasma_priority(lookahead, k, n))
+                    {
+                        if (sequence->status == PlasmaSuccess)
+                            plasma_core_zgemm(
+                                PlasmaConjTrans, PlasmaNoTrans,
+                                A.mb, nvam, A.mb,
+                                -1.0, akn, ldak,
+                                      akm, ldak,
+                                 1.0, anm, ldan);
+                    }
+                }
+            }
+#if defined(PLASMA_USE_OMP_ITERATOR)
+            for (int n = k+1; n < A.nt && chunk > 1; n++) {
+                int ldan = plasma_tile_mmain(A, n);
+                plasma_complex64_t *akn = A(k, n);
+                int prio = plasma_priority(lookahead, k, n);
+                for (int m1 = n+1; m1 < A.nt; m1 += chunk) {
+                    int m2 = imin(m1+chunk, A.nt);
+                    #pragma omp task depend(in:akn[0:ldak*A.mb]) \
+                                     depend(iterator(m = m1:m2), \
+                                            in:*A(k, m)) \
+                                     depend(iterator(m = m1:m2), \
+                                            inout:*A(n, m)) \
+                                     priority(prio)
+                    {
+                        for (int m = m1; m < m2; m++) {
+                            if (sequence->status != PlasmaSuccess)
+                                break;
+                            plasma_core_zgemm(
+                                PlasmaConjTrans, PlasmaNoTrans,
+                                A.mb, plasma_tile_nview(A, m), A.mb,
+                                -1.0, akn, ldak,
+                                      A(k, m), ldak,
+                                 1.0, A(n, m), ldan);
+                        }
+                    }
+                }
+            }
+#endif
+        }
+    }
+}
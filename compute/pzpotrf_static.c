@@ -0,0 +1,207 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include <plasma_core_blas.h>
+
+#include <math.h>
+#include <string.h>
+#include <omp.h>
+
+#define A(m, n) (plasma_complex64_t*)plasma_tile_addr(A, m, n)
+
+/******************************************************************************/
+// owner of tile (m, n) on the p-by-q thread grid
+static inline int owner(int m, int n, int p, int q)
+{
+    return (m%p)*q + n%q;
+}
+
+/******************************************************************************/
+static void plasma_pzpotrf_static_panel(
+    plasma_context_t *plasma, plasma_enum_t uplo, plasma_desc_t A, int k,
+    int rank, int p, int q,
+    plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    int nvak = plasma_tile_mview(A, k);
+    int ldak = plasma_tile_mmain(A, k);
+    if (owner(k, k, p, q) == rank) {
+        if (sequence->status == PlasmaSuccess) {
+            int info = plasma_core_zpotrf(uplo, nvak, A(k, k), ldak);
+            if (info != 0)
+                plasma_request_fail(sequence, request, A.nb*k+info);
+        }
+        ss_cond_set(k, k, 1);
+    }
+    for (int m = k+1; m < A.mt; m++) {
+        if (owner(m, k, p, q) != rank)
+            continue;
+
+        ss_cond_wait(k, k, 1);
+        if (sequence->status == PlasmaSuccess) {
+            int nvam = plasma_tile_mview(A, m);
+            if (uplo == PlasmaLower) {
+                int ldam = plasma_tile_mmain(A, m);
+                plasma_core_ztrsm(PlasmaRight, PlasmaLower,
+                                  PlasmaConjTrans, PlasmaNonUnit,
+                                  nvam, A.mb,
+                                  1.0, A(k, k), ldak,
+                                       A(m, k), ldam);
+            }
+            else {
+                plasma_core_ztrsm(PlasmaLeft, PlasmaUpper,
+                                  PlasmaConjTrans, PlasmaNonUnit,
+                                  A.nb, nvam,
+                                  1.0, A(k, k), ldak,
+                                       A(k, m), ldak);
+            }
+        }
+        ss_cond_set(m, k, 1);
+    }
+}
+
+/******************************************************************************/
+static void plasma_pzpotrf_static_update(
+    plasma_context_t *plasma, plasma_enum_t uplo, plasma_desc_t A,
+    int k, int n, int rank, int p, int q,
+    plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    int nvan = plasma_tile_mview(A, n);
+    int ldak = plasma_tile_mmain(A, k);
+    int ldan = plasma_tile_mmain(A, n);
+    if (owner(n, n, p, q) == rank) {
+        ss_cond_wait(n, k, 1);
+        if (sequence->status == PlasmaSuccess) {
+            if (uplo == PlasmaLower)
+                plasma_core_zherk(PlasmaLower, PlasmaNoTrans,
+                                  nvan, A.mb,
+                                  -1.0, A(n, k), ldan,
+                                   1.0, A(n, n), ldan);
+            else
+                plasma_core_zherk(PlasmaUpper, PlasmaConjTrans,
+                                  nvan, A.mb,
+                                  -1.0, A(k, n), ldak,
+                                   1.0, A(n, n), ldan);
+        }
+    }
+    for (int m = n+1; m < A.mt; m++) {
+        if (owner(m, n, p, q) != rank)
+            continue;
+
+        ss_cond_wait(n, k, 1);
+        ss_cond_wait(m, k, 1);
+        if (sequence->status == PlasmaSuccess) {
+            int nvam = plasma_tile_mview(A, m);
+            if (uplo == PlasmaLower) {
+                int ldam = plasma_tile_mmain(A, m);
+                plasma_core_zgemm(PlasmaNoTrans, PlasmaConjTrans,
+                                  nvam, A.mb, A.mb,
+                                  -1.0, A(m, k), ldam,
+                                        A(n, k), ldan,
+                                   1.0, A(m, n), ldam);
+            }
+            else {
+                plasma_core_zgemm(PlasmaConjTrans, PlasmaNoTrans,
+                                  A.mb, nvam, A.mb,
+                                  -1.0, A(k, n), ldak,
+                                        A(k, m), ldak,
+                                   1.0, A(n, m), ldan);
+            }
+        }
+    }
+}
+
+/***************************************************************************//**
+ *  Executes the tiles owned by rank in the global order of the static
+ *  schedule. In slot s, the updates of column s by steps within the lookahead
+ *  window come first, then the panel of step s, and then the remaining
+ *  updates of step s-lookahead. Each rank only waits for tiles finished
+ *  earlier in that order, so the schedule is deadlock free.
+ ******************************************************************************/
+static void plasma_pzpotrf_static_rank(
+    plasma_context_t *plasma, plasma_enum_t uplo, plasma_desc_t A,
+    int lookahead, int rank, int p, int q,
+    plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    for (int s = 0; s < A.mt; s++) {
+        for (int k = imax(0, s-lookahead); k < s; k++)
+            plasma_pzpotrf_static_update(plasma, uplo, A, k, s, rank, p, q,
+                                         sequence, request);
+
+        plasma_pzpotrf_static_panel(plasma, uplo, A, s, rank, p, q,
+                                    sequence, request);
+
+        int k = s-lookahead;
+        if (k >= 0) {
+            for (int n = s+1; n < A.mt; n++)
+                plasma_pzpotrf_static_update(plasma, uplo, A, k, n,
+                                             rank, p, q, sequence, request);
+        }
+    }
+}
+
+/***************************************************************************//**
+ *  Parallel tile Cholesky factorization - static scheduling.
+ *  Tiles are distributed 2D block cyclic over the threads of the team,
+ *  which synchronize through the progress table of the context.
+ *  All the threads of the team must be available to execute the ranks.
+ * @see plasma_omp_zpotrf
+ ******************************************************************************/
+void plasma_pzpotrf_static(plasma_enum_t uplo, plasma_desc_t A,
+                           plasma_context_t *plasma,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request)
+{
+    // Return if failed sequence.
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    // Complete the tasks producing A.
+    #pragma omp taskwait
+
+    // Initialize static scheduler progress table, from the memory pool.
+    size_t lprogress = (size_t)A.mt*A.mt*sizeof(int);
+    plasma->ss_progress =
+        (volatile int*)plasma_pool_alloc(&plasma->pool, lprogress);
+    if (plasma->ss_progress == NULL) {
+        plasma_request_fail(sequence, request, PlasmaErrorOutOfMemory);
+        return;
+    }
+    memset((void*)plasma->ss_progress, 0, lprogress);
+    plasma->ss_ld = A.mt;
+    plasma->ss_abort = 0;
+
+    // Arrange the threads in a p-by-q grid, as square as possible.
+    int nthread = omp_get_num_threads();
+    int p = (int)sqrt((double)nthread);
+    while (nthread%p != 0)
+        p--;
+    int q = nthread/p;
+
+    int lookahead = plasma->lookahead;
+    for (int rank = 1; rank < nthread; rank++) {
+        #pragma omp task firstprivate(rank)
+        plasma_pzpotrf_static_rank(plasma, uplo, A, lookahead,
+                                   rank, p, q, sequence, request);
+    }
+    plasma_pzpotrf_static_rank(plasma, uplo, A, lookahead, 0, p, q,
+                               sequence, request);
+
+    #pragma omp taskwait
+
+    plasma_pool_free(&plasma->pool, (void*)plasma->ss_progress);
+    plasma->ss_progress = NULL;
+}
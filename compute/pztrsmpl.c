@@ -0,0 +1,74 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include <plasma_core_blas.h>
+
+#define A(m, n) (plasma_complex64_t*)plasma_tile_addr(A, m, n)
+#define B(m, n) (plasma_complex64_t*)plasma_tile_addr(B, m, n)
+#define L(m, n) (plasma_complex64_t*)plasma_tile_addr(L, m, n)
+#define IPIV(m, n) &ipiv[A.mb*((m)+A.mt*(n))]
+
+/***************************************************************************//**
+ *  Parallel forward substitution with the factors of the LU factorization
+ *  with incremental pivoting, applying the kernels of the factorization
+ *  to B in the same order.
+ * @see plasma_pzgetrf_incpiv
+ ******************************************************************************/
+void plasma_pztrsmpl(plasma_desc_t A, plasma_desc_t B,
+                     plasma_desc_t L, int *ipiv,
+                     plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    // Return if failed sequence.
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    // Set inner blocking from the L tile row-dimension.
+    int ib = L.mb;
+
+    for (int k = 0; k < imin(A.mt, A.nt); k++) {
+        int mvak = plasma_tile_mview(A, k);
+        int nvak = plasma_tile_nview(A, k);
+        int ldak = plasma_tile_mmain(A, k);
+        int ldbk = plasma_tile_mmain(B, k);
+        int kk = imin(mvak, nvak);
+        for (int n = 0; n < B.nt; n++) {
+            int nvbn = plasma_tile_nview(B, n);
+            plasma_core_omp_zgessm(
+                mvak, nvbn, kk,
+                IPIV(k, k),
+                A(k, k), ldak,
+                B(k, n), ldbk,
+                sequence, request);
+        }
+        for (int m = k+1; m < A.mt; m++) {
+            int mvam = plasma_tile_mview(A, m);
+            int ldam = plasma_tile_mmain(A, m);
+            int ldbm = plasma_tile_mmain(B, m);
+            for (int n = 0; n < B.nt; n++) {
+                int nvbn = plasma_tile_nview(B, n);
+                plasma_core_omp_zssssm(
+                    A.mb, nvbn, mvam, nvbn, nvak, ib,
+                    B(k, n), ldbk,
+                    B(m, n), ldbm,
+                    L(m, k), L.mb,
+                    A(m, k), ldam,
+                    IPIV(m, k),
+                    sequence, request);
+            }
+        }
+    }
+}
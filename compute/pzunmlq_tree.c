@@ -223,5 +223,5 @@ void plasma_pzunmlq_tree(plasma_enum_t side, plasma_enum_t trans,
         }
     }
 
-    free(operations);
+    plasma_tree_free(operations);
 }
@@ -216,5 +216,5 @@ void plasma_pzunmqr_tree(plasma_enum_t side, plasma_enum_t trans,
         }
     }
 
-    free(operations);
+    plasma_tree_free(operations);
 }
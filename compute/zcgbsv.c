@@ -246,7 +246,7 @@ int plasma_zcgbsv(int n, int kl, int ku, int nrhs,
     plasma_barrier_init(&plasma->barrier);
 
     // asynchronous block
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma->max_threads)
     #pragma omp master
     {
         // Translate matrices to tile layout.
@@ -446,7 +446,7 @@ void plasma_omp_zcgbsv(plasma_desc_t A,  int *ipiv,
 
     plasma_pzlacpy(PlasmaGeneral, PlasmaNoTrans, B, R, sequence, request);
     plasma_pzgemm(PlasmaNoTrans, PlasmaNoTrans,
-                  zmone, A, X, zone, R, sequence, request);
+                  zmone, A, X, zone, R, plasma, sequence, request);
 
     // Check whether the nrhs normwise backward error satisfies the
     // stopping criterion. If yes, set iter=0 and return.
@@ -487,7 +487,7 @@ void plasma_omp_zcgbsv(plasma_desc_t A,  int *ipiv,
         // Compute R = B - A * X.
         plasma_pzlacpy(PlasmaGeneral, PlasmaNoTrans, B, R, sequence, request);
         plasma_pzgemm(PlasmaNoTrans, PlasmaNoTrans, zmone, A, X, zone, R,
-                      sequence, request);
+                      plasma, sequence, request);
 
         // Check whether nrhs normwise backward error satisfies the
         // stopping criterion. If yes, set iter = iiter > 0 and return.
@@ -228,7 +228,7 @@ int plasma_zcgesv(int n, int nrhs,
     plasma_barrier_init(&plasma->barrier);
 
     // asynchronous block
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma->max_threads)
     #pragma omp master
     {
         // Translate matrices to tile layout.
@@ -255,8 +255,10 @@ int plasma_zcgesv(int n, int nrhs,
     free(Rnorm);
     free(Xnorm);
 
-    // Return status.
+    // Return status, or the index of the first zero pivot.
     int status = sequence.status;
+    if (status == PlasmaSuccess)
+        status = sequence.info;
     return status;
 }
 
@@ -451,7 +453,7 @@ void plasma_omp_zcgesv(plasma_desc_t A,  int *ipiv,
     // Compute R = B - A * X.
     plasma_pzlacpy(PlasmaGeneral, PlasmaNoTrans, B, R, sequence, request);
     plasma_pzgemm(PlasmaNoTrans, PlasmaNoTrans,
-                  zmone, A, X, zone, R, sequence, request);
+                  zmone, A, X, zone, R, plasma, sequence, request);
 
     // Check whether the nrhs normwise backward error satisfies the
     // stopping criterion. If yes, set iter=0 and return.
@@ -462,14 +464,18 @@ void plasma_omp_zcgesv(plasma_desc_t A,  int *ipiv,
     {
         cte = Anorm * eps * sqrt((double)A.n);
 
-        if (conv(Rnorm, Xnorm, R.n, cte)) {
+        if (sequence->info == 0 && conv(Rnorm, Xnorm, R.n, cte)) {
            *iter = 0;
             return;
         }
     }
 
+    // If As is singular, skip the refinement and go to double precision.
+    int refine = sequence->info == 0;
+    sequence->info = 0;
+
     // iterative refinement
-    for (int iiter = 0; iiter < itermax; iiter++) {
+    for (int iiter = 0; refine && iiter < itermax; iiter++) {
         // Convert R from double to single precision, store result in Xs.
         plasma_pzlag2c(R, Xs, sequence, request);
 
@@ -490,7 +496,7 @@ void plasma_omp_zcgesv(plasma_desc_t A,  int *ipiv,
         // Compute R = B - A * X.
         plasma_pzlacpy(PlasmaGeneral, PlasmaNoTrans, B, R, sequence, request);
         plasma_pzgemm(PlasmaNoTrans, PlasmaNoTrans, zmone, A, X, zone, R,
-                      sequence, request);
+                      plasma, sequence, request);
 
         // Check whether nrhs normwise backward error satisfies the
         // stopping criterion. If yes, set iter = iiter > 0 and return.
@@ -517,6 +523,12 @@ void plasma_omp_zcgesv(plasma_desc_t A,  int *ipiv,
     //#pragma omp taskwait
     plasma_pzgetrf(A, ipiv, sequence, request);
 
+    // A zero pivot does not fail the sequence. As in LAPACK, do not solve
+    // with a singular U then.
+    #pragma omp taskwait
+    if (sequence->info != 0)
+        return;
+
     // Solve the system A * X = B.
     plasma_pzlacpy(PlasmaGeneral, PlasmaNoTrans, B, X, sequence, request);
 
@@ -238,7 +238,7 @@ int plasma_zcposv(plasma_enum_t uplo, int n, int nrhs,
     retval = plasma_request_init(&request);
 
     // asynchronous block
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma->max_threads)
     #pragma omp master
     {
         // Translate matrices to tile layout.
@@ -14,6 +14,7 @@
 #include "plasma_async.h"
 #include "plasma_context.h"
 #include "plasma_descriptor.h"
+#include "plasma_inplace.h"
 #include "plasma_internal.h"
 #include "plasma_types.h"
 #include "plasma_workspace.h"
@@ -22,7 +23,8 @@
     @ingroup plasma_ccrb2cm
 
     Convert tiled (CCRB) to column-major (CM) matrix layout.
-    Out-of-place.
+    Out-of-place, or in place if A is the tile layout of pA itself,
+    as initialized by plasma_desc_general_inplace_init().
 */
 void plasma_omp_zdesc2ge(plasma_desc_t A,
                          plasma_complex64_t *pA, int lda,
@@ -63,6 +65,18 @@ void plasma_omp_zdesc2ge(plasma_desc_t A,
     if (A.m == 0 || A.n == 0)
         return;
 
+    // quick return if A is a LAPACK-layout view of pA
+    if (A.type == PlasmaGeneralLapack && A.ld == lda &&
+        (plasma_complex64_t*)A.matrix + A.i + (size_t)A.ld*A.j == pA)
+        return;
+
+    // Translate back in place if A is the tile layout of pA, even in
+    // a failed sequence, for the array to come back.
+    if (A.inplace && A.matrix == pA && A.gm == lda) {
+        plasma_inplace_desc2ge(A, plasma);
+        return;
+    }
+
     // Call the parallel function.
     plasma_pzdesc2ge(A, pA, lda, sequence, request);
 }
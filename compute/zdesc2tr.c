@@ -63,6 +63,11 @@ void plasma_omp_zdesc2tr(plasma_desc_t A,
     if (A.m == 0 || A.n == 0)
         return;
 
+    // quick return if A is a LAPACK-layout view of pA
+    if (A.type == PlasmaGeneralLapack && A.ld == lda &&
+        (plasma_complex64_t*)A.matrix + A.i + (size_t)A.ld*A.j == pA)
+        return;
+
     // Call the parallel function.
     plasma_pzdesc2tr(A, pA, lda, sequence, request);
 }
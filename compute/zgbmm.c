@@ -242,7 +242,7 @@ int plasma_zgbmm(plasma_enum_t transa, plasma_enum_t transb,
     retval = plasma_request_init(&request);
 
     // asynchronous block
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma->max_threads)
     #pragma omp master
     {
         // Translate to tile layout.
@@ -400,5 +400,6 @@ void plasma_omp_zgbmm(plasma_enum_t transa, plasma_enum_t transb,
                   alpha, A,
                          B,
                   beta,  C,
+                  plasma,
                   sequence, request);
 }
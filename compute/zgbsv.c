@@ -142,7 +142,7 @@ int plasma_zgbsv(int n, int kl, int ku, int nrhs,
     plasma_request_t request;
     retval = plasma_request_init(&request);
 
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma->max_threads)
     #pragma omp master
     {
         // Translate to tile layout.
@@ -150,14 +150,14 @@ int plasma_zgbsv(int n, int kl, int ku, int nrhs,
         plasma_omp_zge2desc(pB, ldb, B, &sequence, &request);
     }
 
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma->max_threads)
     #pragma omp master
     {
         // Call the tile async function.
         plasma_omp_zgbsv(AB, ipiv, B, &sequence, &request);
     }
 
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma->max_threads)
     #pragma omp master
     {
         // Translate back to LAPACK layout.
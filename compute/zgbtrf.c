@@ -119,21 +119,21 @@ int plasma_zgbtrf(int m, int n, int kl, int ku,
     plasma_request_t request;
     retval = plasma_request_init(&request);
 
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma->max_threads)
     #pragma omp master
     {
         // Translate to tile layout.
         plasma_omp_zpb2desc(pAB, ldab, AB, &sequence, &request);
     }
 
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma->max_threads)
     #pragma omp master
     {
         // Call the tile async function.
         plasma_omp_zgbtrf(AB, ipiv, &sequence, &request);
     }
 
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma->max_threads)
     #pragma omp master
     {
         // Translate back to LAPACK layout.
@@ -166,7 +166,7 @@ int plasma_zgbtrs(plasma_enum_t trans, int n, int kl, int ku, int nrhs,
     retval = plasma_request_init(&request);
 
     // asynchronous block
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma->max_threads)
     #pragma omp master
     {
         // Translate to tile layout.
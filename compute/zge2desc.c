@@ -14,6 +14,7 @@
 #include "plasma_async.h"
 #include "plasma_context.h"
 #include "plasma_descriptor.h"
+#include "plasma_inplace.h"
 #include "plasma_internal.h"
 #include "plasma_types.h"
 #include "plasma_workspace.h"
@@ -22,7 +23,8 @@
     @ingroup plasma_cm2ccrb
 
     Convert column-major (CM) to tiled (CCRB) matrix layout.
-    Out-of-place.
+    Out-of-place, or in place if A is the tile layout of pA itself,
+    as initialized by plasma_desc_general_inplace_init().
 */
 void plasma_omp_zge2desc(plasma_complex64_t *pA, int lda,
                          plasma_desc_t A,
@@ -63,6 +65,18 @@ void plasma_omp_zge2desc(plasma_complex64_t *pA, int lda,
     if (A.m == 0 || A.n == 0)
         return;
 
+    // quick return if A is a LAPACK-layout view of pA
+    if (A.type == PlasmaGeneralLapack && A.ld == lda &&
+        (plasma_complex64_t*)A.matrix + A.i + (size_t)A.ld*A.j == pA)
+        return;
+
+    // Translate in place if A is the tile layout of pA, even in a failed
+    // sequence, as plasma_omp_zdesc2ge() always translates back.
+    if (A.inplace && A.matrix == pA && A.gm == lda) {
+        plasma_inplace_ge2desc(A, plasma);
+        return;
+    }
+
     // Call the parallel function.
     plasma_pzge2desc(pA, lda, A, sequence, request);
 }
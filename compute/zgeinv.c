@@ -123,7 +123,7 @@ int plasma_zgeinv(int m, int n, plasma_complex64_t *pA, int lda, int *ipiv)
     plasma_request_t request;
     retval = plasma_request_init(&request);
 
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma->max_threads)
     #pragma omp master
     {
         // Translate to tile layout.
@@ -139,8 +139,10 @@ int plasma_zgeinv(int m, int n, plasma_complex64_t *pA, int lda, int *ipiv)
     // Free matrix A in tile layout.
     plasma_desc_destroy(&A);
 
-    // Return status.
+    // Return status, or the index of the first zero pivot.
     int status = sequence.status;
+    if (status == PlasmaSuccess)
+        status = sequence.info;
     return status;
 }
 
@@ -225,6 +227,12 @@ void plasma_omp_zgeinv(plasma_desc_t A, int *ipiv, plasma_desc_t W,
     // Factorize A.
     plasma_pzgetrf(A, ipiv, sequence, request);
 
+    // A zero pivot does not fail the sequence. As in LAPACK, leave the
+    // factors in A then, rather than invert a singular U.
+    #pragma omp taskwait
+    if (sequence->info != 0)
+        return;
+
     // Invert triangular part.
     plasma_pztrtri(PlasmaUpper, PlasmaNonUnit, A, sequence, request);
 
@@ -14,11 +14,15 @@
 #include "plasma_async.h"
 #include "plasma_context.h"
 #include "plasma_descriptor.h"
+#include "plasma_inplace.h"
 #include "plasma_internal.h"
+#include "plasma_tree.h"
 #include "plasma_tuning.h"
 #include "plasma_types.h"
 #include "plasma_workspace.h"
 
+#include <stdint.h>
+
 /***************************************************************************//**
  *
  * @ingroup plasma_gels
@@ -178,16 +182,25 @@ int plasma_zgels(plasma_enum_t trans,
     plasma_desc_t A;
     plasma_desc_t B;
     int retval;
-    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
-                                        m, n, 0, 0, m, n, &A);
+    if (plasma->inplace_outplace == PlasmaInplace)
+        retval = plasma_desc_general_inplace_init(PlasmaComplexDouble, pA, nb, nb,
+                                                  lda, n, 0, 0, m, n, &A);
+    else
+        retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
+                                            m, n, 0, 0, m, n, &A);
     if (retval != PlasmaSuccess) {
         plasma_error("plasma_desc_general_create() failed");
         return retval;
     }
 
-    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
-                                        imax(m, n), nrhs, 0, 0, imax(m, n),
-                                        nrhs, &B);
+    if (plasma->inplace_outplace == PlasmaInplace)
+        retval = plasma_desc_general_inplace_init(PlasmaComplexDouble, pB, nb, nb,
+                                                  ldb, nrhs, 0, 0, imax(m, n),
+                                                  nrhs, &B);
+    else
+        retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
+                                            imax(m, n), nrhs, 0, 0, imax(m, n),
+                                            nrhs, &B);
     if (retval != PlasmaSuccess) {
         plasma_error("plasma_desc_general_create() failed");
         plasma_desc_destroy(&A);
@@ -219,7 +232,7 @@ int plasma_zgels(plasma_enum_t trans,
     retval = plasma_request_init(&request);
 
     // asynchronous block
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma->max_threads)
     #pragma omp master
     {
         // Translate to tile layout.
@@ -249,6 +262,200 @@ int plasma_zgels(plasma_enum_t trans,
     return status;
 }
 
+/***************************************************************************//**
+ *
+ * @ingroup plasma_gels
+ *
+ *  Returns the bytes of the caller buffer of plasma_zgels_buffer() for an
+ *  m-by-n matrix and nrhs right hand sides, with the current settings of
+ *  the context: the tile matrices of A and B, or the scratch of their
+ *  in-place translation with PlasmaInplace, the matrix of T, the
+ *  workspaces of the threads and the panel trees or the progress table of
+ *  the static scheduler.
+ *
+ *******************************************************************************
+ *
+ * @param[in] trans
+ *          - PlasmaNoTrans:    the linear system involves A
+ *          - Plasma_ConjTrans: the linear system involves A^H
+ *
+ * @param[in] m
+ *          The number of rows of the matrix A. m >= 0.
+ *
+ * @param[in] n
+ *          The number of columns of the matrix A. n >= 0.
+ *
+ * @param[in] nrhs
+ *          The number of right hand sides. nrhs >= 0.
+ *
+ * @param[out] size
+ *          On exit, the bytes of the caller buffer.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_zgels_buffer
+ * @sa plasma_cgels_workspace_query
+ * @sa plasma_dgels_workspace_query
+ * @sa plasma_sgels_workspace_query
+ *
+ ******************************************************************************/
+int plasma_zgels_workspace_query(plasma_enum_t trans,
+                                 int m, int n, int nrhs,
+                                 size_t *size)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Check input arguments.
+    if ((trans != PlasmaNoTrans) &&
+        (trans != Plasma_ConjTrans)) {
+        plasma_error("illegal value of trans");
+        return PlasmaErrorIllegalValue;
+    }
+    if (m < 0) {
+        plasma_error("illegal value of m");
+        return -2;
+    }
+    if (n < 0) {
+        plasma_error("illegal value of n");
+        return -3;
+    }
+    if (nrhs < 0) {
+        plasma_error("illegal value of nrhs");
+        return -4;
+    }
+    if (size == NULL) {
+        plasma_error("NULL size");
+        return -5;
+    }
+
+    *size = 0;
+    if (imin(m, imin(n, nrhs)) == 0)
+        return PlasmaSuccess;
+
+    // Tune parameters, as plasma_zgels() does.
+    if (plasma->tuning) {
+        if (m < n)
+            plasma_tune_gelqf(plasma, PlasmaComplexDouble, m, n);
+        else
+            plasma_tune_geqrf(plasma, PlasmaComplexDouble, m, n);
+    }
+
+    int ib = plasma->ib;
+    int nb = plasma->nb;
+
+    plasma_desc_t A;
+    plasma_desc_t B;
+    plasma_desc_t T;
+    plasma_desc_general_init(PlasmaComplexDouble, NULL, nb, nb,
+                             m, n, 0, 0, m, n, &A);
+    plasma_desc_general_init(PlasmaComplexDouble, NULL, nb, nb,
+                             imax(m, n), nrhs, 0, 0, imax(m, n), nrhs, &B);
+    plasma_descT_init(A, ib, plasma->householder_mode, &T);
+    size_t lwork = nb + ib*nb;  // geqrt/gelqt: tau + work
+    if (plasma->inplace_outplace != PlasmaInplace)
+        *size = plasma_pool_bytes(plasma_desc_matrix_size(A)) +
+                plasma_pool_bytes(plasma_desc_matrix_size(B));
+    else
+        *size = 2*plasma_inplace_bytes(A) +  // to and from tile layout
+                2*plasma_inplace_bytes(B);
+    *size += plasma_pool_bytes(plasma_desc_matrix_size(T)) +
+             plasma_workspace_bytes(lwork, PlasmaComplexDouble);
+
+    // Bookkeeping of the trees of the factorization and of the application
+    // of Q, or of the static scheduler.
+    if (plasma->householder_mode == PlasmaTreeHouseholder) {
+        if (m >= n)
+            *size += 2*plasma_tree_bytes(A.mt, A.nt);
+        else
+            *size += 2*plasma_tree_bytes(A.nt, A.mt);
+    }
+    else if (m >= n && plasma->runtime == PlasmaRuntimeStatic) {
+        *size += plasma_pool_bytes((size_t)A.nt*sizeof(int));
+    }
+    return PlasmaSuccess;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_gels
+ *
+ *  Solves overdetermined or underdetermined linear systems as
+ *  plasma_zgels(), with the tile matrices, T and the workspaces carved out
+ *  of a caller buffer instead of allocated. T then lives in the buffer,
+ *  which plasma_desc_destroy() on T leaves alone.
+ *
+ *******************************************************************************
+ *
+ * @param[in] trans
+ * @param[in] m
+ * @param[in] n
+ * @param[in] nrhs
+ * @param[in,out] pA
+ * @param[in] lda
+ * @param[out] T
+ * @param[in,out] pB
+ * @param[in] ldb
+ *          See plasma_zgels().
+ *
+ * @param[in,out] buffer
+ *          The caller buffer, aligned to PLASMA_ALLOCATOR_ALIGN bytes.
+ *
+ * @param[in] size
+ *          The bytes of buffer, at least those returned by
+ *          plasma_zgels_workspace_query().
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_zgels
+ * @sa plasma_zgels_workspace_query
+ *
+ ******************************************************************************/
+int plasma_zgels_buffer(plasma_enum_t trans,
+                        int m, int n, int nrhs,
+                        plasma_complex64_t *pA, int lda,
+                        plasma_desc_t *T,
+                        plasma_complex64_t *pB, int ldb,
+                        void *buffer, size_t size)
+{
+    size_t lbuffer;
+    int retval = plasma_zgels_workspace_query(trans, m, n, nrhs, &lbuffer);
+    if (retval != PlasmaSuccess)
+        return retval;
+
+    if (lbuffer > 0 &&
+        (buffer == NULL || (uintptr_t)buffer%PLASMA_ALLOCATOR_ALIGN != 0)) {
+        plasma_error("illegal value of buffer");
+        return -10;
+    }
+    if (size < lbuffer) {
+        plasma_error("illegal value of size");
+        return -11;
+    }
+
+    // Carve the tile matrices, the workspaces and the bookkeeping out of
+    // the buffer.
+    plasma_context_t *plasma = plasma_context_self();
+    plasma_pool_buffer(&plasma->pool, buffer, size);
+    retval = plasma_zgels(trans, m, n, nrhs, pA, lda, T, pB, ldb);
+    plasma_pool_buffer(&plasma->pool, NULL, 0);
+    return retval;
+}
+
 /***************************************************************************//**
  *
  * @ingroup plasma_gels
@@ -35,6 +35,10 @@
  *  alpha and beta are scalars, and A, B and C are matrices, with op( A )
  *  an m-by-k matrix, op( B ) a k-by-n matrix and C an m-by-n matrix.
  *
+ *  If PlasmaCacheSize is set, the tile-layout copies of A and B are kept
+ *  in the translation cache and reused by later calls with the same arrays.
+ *  Call plasma_cache_invalidate() after modifying a cached array.
+ *
  *******************************************************************************
  *
  * @param[in] transa
@@ -184,30 +188,73 @@ int plasma_zgemm(plasma_enum_t transa, plasma_enum_t transb,
     // Set tiling parameters.
     int nb = plasma->nb;
 
+    // Look up A and B in the translation cache.
+    plasma_cache_entry_t *a_entry = NULL;
+    plasma_cache_entry_t *b_entry = NULL;
+    if (plasma->layout != PlasmaLapackLayout) {
+        a_entry = plasma_cache_acquire(&plasma->cache, PlasmaComplexDouble,
+                                       pA, lda, nb, am, an);
+        b_entry = plasma_cache_acquire(&plasma->cache, PlasmaComplexDouble,
+                                       pB, ldb, nb, bm, bn);
+    }
+    int a_cached = a_entry != NULL && a_entry->valid;
+    int b_cached = b_entry != NULL && b_entry->valid;
+
     // Create tile matrices.
     plasma_desc_t A;
     plasma_desc_t B;
     plasma_desc_t C;
     int retval;
-    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
-                                        am, an, 0, 0, am, an, &A);
+    if (a_entry != NULL) {
+        A = a_entry->A;
+        retval = PlasmaSuccess;
+    }
+    else if (plasma->layout == PlasmaLapackLayout)
+        retval = plasma_desc_general_lapack_init(PlasmaComplexDouble, pA, nb, nb,
+                                                 lda, am, an, 0, 0, am, an, &A);
+    else
+        retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
+                                            am, an, 0, 0, am, an, &A);
     if (retval != PlasmaSuccess) {
         plasma_error("plasma_desc_general_create() failed");
+        plasma_cache_release(&plasma->cache, b_entry, false,
+                             PlasmaErrorOutOfMemory);
         return retval;
     }
-    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
-                                        bm, bn, 0, 0, bm, bn, &B);
+    if (b_entry != NULL) {
+        B = b_entry->A;
+        retval = PlasmaSuccess;
+    }
+    else if (plasma->layout == PlasmaLapackLayout)
+        retval = plasma_desc_general_lapack_init(PlasmaComplexDouble, pB, nb, nb,
+                                                 ldb, bm, bn, 0, 0, bm, bn, &B);
+    else
+        retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
+                                            bm, bn, 0, 0, bm, bn, &B);
     if (retval != PlasmaSuccess) {
         plasma_error("plasma_desc_general_create() failed");
-        plasma_desc_destroy(&A);
+        if (a_entry == NULL)
+            plasma_desc_destroy(&A);
+        plasma_cache_release(&plasma->cache, a_entry, false,
+                             PlasmaErrorOutOfMemory);
         return retval;
     }
-    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
-                                        m, n, 0, 0, m, n, &C);
+    if (plasma->layout == PlasmaLapackLayout)
+        retval = plasma_desc_general_lapack_init(PlasmaComplexDouble, pC, nb, nb,
+                                                 ldc, m, n, 0, 0, m, n, &C);
+    else
+        retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
+                                            m, n, 0, 0, m, n, &C);
     if (retval != PlasmaSuccess) {
         plasma_error("plasma_desc_general_create() failed");
-        plasma_desc_destroy(&A);
-        plasma_desc_destroy(&B);
+        if (a_entry == NULL)
+            plasma_desc_destroy(&A);
+        if (b_entry == NULL)
+            plasma_desc_destroy(&B);
+        plasma_cache_release(&plasma->cache, a_entry, false,
+                             PlasmaErrorOutOfMemory);
+        plasma_cache_release(&plasma->cache, b_entry, false,
+                             PlasmaErrorOutOfMemory);
         return retval;
     }
 
@@ -220,12 +267,14 @@ int plasma_zgemm(plasma_enum_t transa, plasma_enum_t transb,
     retval = plasma_request_init(&request);
 
     // asynchronous block
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma->max_threads)
     #pragma omp master
     {
-        // Translate to tile layout.
-        plasma_omp_zge2desc(pA, lda, A, &sequence, &request);
-        plasma_omp_zge2desc(pB, ldb, B, &sequence, &request);
+        // Translate to tile layout, unless a valid copy is cached.
+        if (! a_cached)
+            plasma_omp_zge2desc(pA, lda, A, &sequence, &request);
+        if (! b_cached)
+            plasma_omp_zge2desc(pB, ldb, B, &sequence, &request);
         plasma_omp_zge2desc(pC, ldc, C, &sequence, &request);
 
         // Call the tile async function.
@@ -240,10 +289,14 @@ int plasma_zgemm(plasma_enum_t transa, plasma_enum_t transb,
     }
     // implicit synchronization
 
-    // Free matrices in tile layout.
-    plasma_desc_destroy(&A);
-    plasma_desc_destroy(&B);
+    // Free matrices in tile layout, keep the cached ones.
+    if (a_entry == NULL)
+        plasma_desc_destroy(&A);
+    if (b_entry == NULL)
+        plasma_desc_destroy(&B);
     plasma_desc_destroy(&C);
+    plasma_cache_release(&plasma->cache, a_entry, ! a_cached, sequence.status);
+    plasma_cache_release(&plasma->cache, b_entry, ! b_cached, sequence.status);
 
     // Return status.
     int status = sequence.status;
@@ -377,5 +430,6 @@ void plasma_omp_zgemm(plasma_enum_t transa, plasma_enum_t transb,
                   alpha, A,
                          B,
                   beta,  C,
+                  plasma,
                   sequence, request);
 }
@@ -14,11 +14,15 @@
 #include "plasma_async.h"
 #include "plasma_context.h"
 #include "plasma_descriptor.h"
+#include "plasma_inplace.h"
 #include "plasma_internal.h"
+#include "plasma_tree.h"
 #include "plasma_tuning.h"
 #include "plasma_types.h"
 #include "plasma_workspace.h"
 
+#include <stdint.h>
+
 /***************************************************************************//**
  *
  * @ingroup plasma_geqrf
@@ -111,8 +115,12 @@ int plasma_zgeqrf(int m, int n,
     // Create tile matrix.
     plasma_desc_t A;
     int retval;
-    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
-                                        m, n, 0, 0, m, n, &A);
+    if (plasma->inplace_outplace == PlasmaInplace)
+        retval = plasma_desc_general_inplace_init(PlasmaComplexDouble, pA, nb, nb,
+                                                  lda, n, 0, 0, m, n, &A);
+    else
+        retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
+                                            m, n, 0, 0, m, n, &A);
     if (retval != PlasmaSuccess) {
         plasma_error("plasma_desc_general_create() failed");
         return retval;
@@ -143,7 +151,7 @@ int plasma_zgeqrf(int m, int n,
     retval = plasma_request_init(&request);
 
     // asynchronous block
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma->max_threads)
     #pragma omp master
     {
         // Translate to tile layout.
@@ -167,6 +175,162 @@ int plasma_zgeqrf(int m, int n,
     return status;
 }
 
+/***************************************************************************//**
+ *
+ * @ingroup plasma_geqrf
+ *
+ *  Returns the bytes of the caller buffer of plasma_zgeqrf_buffer() for an
+ *  m-by-n matrix, with the current settings of the context: the tile
+ *  matrix of A, or the scratch of the in-place translation with
+ *  PlasmaInplace, the matrix of T, the workspaces of the threads and the
+ *  panel trees or the progress table of the static scheduler.
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *          The number of rows of the matrix A.
+ *          m >= 0.
+ *
+ * @param[in] n
+ *          The number of columns of the matrix A.
+ *          n >= 0.
+ *
+ * @param[out] size
+ *          On exit, the bytes of the caller buffer.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_zgeqrf_buffer
+ * @sa plasma_cgeqrf_workspace_query
+ * @sa plasma_dgeqrf_workspace_query
+ * @sa plasma_sgeqrf_workspace_query
+ *
+ ******************************************************************************/
+int plasma_zgeqrf_workspace_query(int m, int n, size_t *size)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Check input arguments.
+    if (m < 0) {
+        plasma_error("illegal value of m");
+        return -1;
+    }
+    if (n < 0) {
+        plasma_error("illegal value of n");
+        return -2;
+    }
+    if (size == NULL) {
+        plasma_error("NULL size");
+        return -3;
+    }
+
+    *size = 0;
+    if (imin(m, n) == 0)
+        return PlasmaSuccess;
+
+    // Tune parameters, as plasma_zgeqrf() does.
+    if (plasma->tuning)
+        plasma_tune_geqrf(plasma, PlasmaComplexDouble, m, n);
+
+    int ib = plasma->ib;
+    int nb = plasma->nb;
+
+    plasma_desc_t A;
+    plasma_desc_t T;
+    plasma_desc_general_init(PlasmaComplexDouble, NULL, nb, nb,
+                             m, n, 0, 0, m, n, &A);
+    plasma_descT_init(A, ib, plasma->householder_mode, &T);
+    size_t lwork = nb + ib*nb;  // geqrt: tau + work
+    if (plasma->inplace_outplace != PlasmaInplace)
+        *size = plasma_pool_bytes(plasma_desc_matrix_size(A));
+    else
+        *size = 2*plasma_inplace_bytes(A);  // to and from tile layout
+    *size += plasma_pool_bytes(plasma_desc_matrix_size(T)) +
+             plasma_workspace_bytes(lwork, PlasmaComplexDouble);
+
+    // Bookkeeping of the panel trees or of the static scheduler.
+    if (plasma->householder_mode == PlasmaTreeHouseholder)
+        *size += plasma_tree_bytes(A.mt, A.nt);
+    else if (plasma->runtime == PlasmaRuntimeStatic)
+        *size += plasma_pool_bytes((size_t)A.nt*sizeof(int));
+    return PlasmaSuccess;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_geqrf
+ *
+ *  Computes a tile QR factorization as plasma_zgeqrf(), with the tile
+ *  matrix, T and the workspaces carved out of a caller buffer instead of
+ *  allocated. T then lives in the buffer, which plasma_desc_destroy() on T
+ *  leaves alone.
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ * @param[in] n
+ * @param[in,out] pA
+ * @param[in] lda
+ * @param[out] T
+ *          See plasma_zgeqrf().
+ *
+ * @param[in,out] buffer
+ *          The caller buffer, aligned to PLASMA_ALLOCATOR_ALIGN bytes.
+ *
+ * @param[in] size
+ *          The bytes of buffer, at least those returned by
+ *          plasma_zgeqrf_workspace_query().
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_zgeqrf
+ * @sa plasma_zgeqrf_workspace_query
+ *
+ ******************************************************************************/
+int plasma_zgeqrf_buffer(int m, int n,
+                         plasma_complex64_t *pA, int lda,
+                         plasma_desc_t *T,
+                         void *buffer, size_t size)
+{
+    size_t lbuffer;
+    int retval = plasma_zgeqrf_workspace_query(m, n, &lbuffer);
+    if (retval != PlasmaSuccess)
+        return retval;
+
+    if (lbuffer > 0 &&
+        (buffer == NULL || (uintptr_t)buffer%PLASMA_ALLOCATOR_ALIGN != 0)) {
+        plasma_error("illegal value of buffer");
+        return -6;
+    }
+    if (size < lbuffer) {
+        plasma_error("illegal value of size");
+        return -7;
+    }
+
+    // Carve the tile matrices, the workspaces and the bookkeeping out of
+    // the buffer.
+    plasma_context_t *plasma = plasma_context_self();
+    plasma_pool_buffer(&plasma->pool, buffer, size);
+    retval = plasma_zgeqrf(m, n, pA, lda, T);
+    plasma_pool_buffer(&plasma->pool, NULL, 0);
+    return retval;
+}
+
 /***************************************************************************//**
  *
  * @ingroup plasma_geqrf
@@ -151,7 +151,7 @@ int plasma_zgeqrs(int m, int n, int nrhs,
     retval = plasma_request_init(&request);
 
     // asynchronous block
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma->max_threads)
     #pragma omp master
     {
         // Translate to tile layout.
@@ -219,7 +219,7 @@ int plasma_zgesdd(plasma_enum_t jobu, plasma_enum_t jobvt,
     retval = plasma_request_init(&request);
 
     // asynchronous block
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma->max_threads)
     #pragma omp master
     {
         // Translate to tile layout.
@@ -231,7 +231,7 @@ int plasma_zgesdd(plasma_enum_t jobu, plasma_enum_t jobvt,
     plasma_omp_zgesdd(jobu, jobvt, A, *T, S, pU, ldu, pVT, ldvt,
                       work, &sequence, &request);
 
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma->max_threads)
     #pragma omp master
     {
         // Translate back to LAPACK layout.
@@ -472,7 +472,7 @@ void plasma_omp_zgesdd(plasma_enum_t jobu, plasma_enum_t jobvt,
     // Reduction to band
     //===================
     plasma_time_t time = omp_get_wtime();
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma->max_threads)
     #pragma omp master
     {
         plasma_pzge2gb(A, T, work, sequence, request);
@@ -672,7 +672,7 @@ void plasma_omp_zgesdd(plasma_enum_t jobu, plasma_enum_t jobvt,
     time = omp_get_wtime();
     if (jobu == PlasmaAllVec || jobu == PlasmaSomeVec) {
         // compute T2
-        #pragma omp parallel
+        #pragma omp parallel num_threads(plasma->max_threads)
         {
             plasma_pzlarft_blgtrd(minmn, nb, vblksiz,
                                   VQ2, TQ2, tauQ2,
@@ -680,7 +680,7 @@ void plasma_omp_zgesdd(plasma_enum_t jobu, plasma_enum_t jobvt,
         }
 
         // apply Q2 from bulge chasing
-        #pragma omp parallel
+        #pragma omp parallel num_threads(plasma->max_threads)
         {
             plasma_pzunmqr_blgtrd(PlasmaLeft, PlasmaNoTrans,
                                   minmn, nb, minmn, vblksiz, wantz,
@@ -692,7 +692,7 @@ void plasma_omp_zgesdd(plasma_enum_t jobu, plasma_enum_t jobvt,
         plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
                                    m, Un, 0, 0, m, Un, &U);
 
-        #pragma omp parallel
+        #pragma omp parallel num_threads(plasma->max_threads)
         #pragma omp master
         {
             // Translate U to tile layout.
@@ -726,7 +726,7 @@ void plasma_omp_zgesdd(plasma_enum_t jobu, plasma_enum_t jobvt,
     //=======================================
     if (jobvt == PlasmaAllVec || jobvt == PlasmaSomeVec) {
         // compute T2
-        #pragma omp parallel
+        #pragma omp parallel num_threads(plasma->max_threads)
         {
             plasma_pzlarft_blgtrd(minmn, nb, vblksiz,
                                   VP2, TP2, tauP2,
@@ -734,7 +734,7 @@ void plasma_omp_zgesdd(plasma_enum_t jobu, plasma_enum_t jobvt,
         }
 
         // apply P2 from bulge chasing
-        #pragma omp parallel
+        #pragma omp parallel num_threads(plasma->max_threads)
         {
             plasma_pzunmqr_blgtrd(PlasmaRight, PlasmaConjTrans,
                                   minmn, nb, minmn, vblksiz, wantz,
@@ -747,7 +747,7 @@ void plasma_omp_zgesdd(plasma_enum_t jobu, plasma_enum_t jobvt,
         plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
                                    VTm, n, 0, 0, VTm, n, &VT);
 
-        #pragma omp parallel
+        #pragma omp parallel num_threads(plasma->max_threads)
         #pragma omp master
         {
             // Translate VT to tile layout.
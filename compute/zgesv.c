@@ -14,11 +14,14 @@
 #include "plasma_async.h"
 #include "plasma_context.h"
 #include "plasma_descriptor.h"
+#include "plasma_inplace.h"
 #include "plasma_internal.h"
 #include "plasma_tuning.h"
 #include "plasma_types.h"
 #include "plasma_workspace.h"
 
+#include <stdint.h>
+
 /***************************************************************************//**
  *
  ******************************************************************************/
@@ -68,14 +71,28 @@ int plasma_zgesv(int n, int nrhs,
     plasma_desc_t A;
     plasma_desc_t B;
     int retval;
-    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
-                                        n, n, 0, 0, n, n, &A);
+    if (plasma->layout == PlasmaLapackLayout)
+        retval = plasma_desc_general_lapack_init(PlasmaComplexDouble, pA, nb, nb,
+                                                 lda, n, n, 0, 0, n, n, &A);
+    else if (plasma->inplace_outplace == PlasmaInplace)
+        retval = plasma_desc_general_inplace_init(PlasmaComplexDouble, pA, nb, nb,
+                                                  lda, n, 0, 0, n, n, &A);
+    else
+        retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
+                                            n, n, 0, 0, n, n, &A);
     if (retval != PlasmaSuccess) {
         plasma_error("plasma_desc_general_create() failed");
         return retval;
     }
-    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
-                                        n, nrhs, 0, 0, n, nrhs, &B);
+    if (plasma->layout == PlasmaLapackLayout)
+        retval = plasma_desc_general_lapack_init(PlasmaComplexDouble, pB, nb, nb,
+                                                 ldb, n, nrhs, 0, 0, n, nrhs, &B);
+    else if (plasma->inplace_outplace == PlasmaInplace)
+        retval = plasma_desc_general_inplace_init(PlasmaComplexDouble, pB, nb, nb,
+                                                  ldb, nrhs, 0, 0, n, nrhs, &B);
+    else
+        retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
+                                            n, nrhs, 0, 0, n, nrhs, &B);
     if (retval != PlasmaSuccess) {
         plasma_error("plasma_desc_general_create() failed");
         return retval;
@@ -89,7 +106,7 @@ int plasma_zgesv(int n, int nrhs,
     plasma_request_t request;
     retval = plasma_request_init(&request);
 
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma->max_threads)
     #pragma omp master
     {
         // Translate to tile layout.
@@ -108,11 +125,133 @@ int plasma_zgesv(int n, int nrhs,
     plasma_desc_destroy(&A);
     plasma_desc_destroy(&B);
 
-    // Return status.
+    // Return status, or the index of the first zero pivot.
     int status = sequence.status;
+    if (status == PlasmaSuccess)
+        status = sequence.info;
     return status;
 }
 
+/******************************************************************************/
+// Returns the bytes of the caller buffer of plasma_zgesv_buffer() going to
+// the memory pool, in pool, and to the arena of the threads, in arena.
+static void plasma_zgesv_bytes(plasma_context_t *plasma, int n, int nrhs,
+                               size_t *pool, size_t *arena)
+{
+    *pool = 0;
+    *arena = 0;
+    if (imin(n, nrhs) == 0)
+        return;
+
+    // Tune parameters, as plasma_zgesv() does.
+    if (plasma->tuning)
+        plasma_tune_getrf(plasma, PlasmaComplexDouble, n, n);
+
+    int nb = plasma->nb;
+
+    plasma_desc_t A;
+    plasma_desc_t B;
+    plasma_desc_general_init(PlasmaComplexDouble, NULL, nb, nb,
+                             n, n, 0, 0, n, n, &A);
+    plasma_desc_general_init(PlasmaComplexDouble, NULL, nb, nb,
+                             n, nrhs, 0, 0, n, nrhs, &B);
+    if (plasma->layout != PlasmaLapackLayout) {
+        if (plasma->inplace_outplace == PlasmaInplace) {
+            // Each array is translated to tile layout and back.
+            *pool += 2*plasma_inplace_bytes(A) + 2*plasma_inplace_bytes(B);
+        }
+        else {
+            *pool += plasma_pool_bytes(plasma_desc_matrix_size(A)) +
+                     plasma_pool_bytes(plasma_desc_matrix_size(B));
+        }
+    }
+    *pool += plasma_pzgetrf_pool_bytes(A, plasma);
+
+    size_t scratch = plasma_pzgetrf_arena_bytes(A, plasma);
+    if (scratch > 0)
+        *arena = plasma_arena_buffer_bytes(scratch, plasma->max_threads);
+}
+
+/***************************************************************************//**
+ *
+ *  Returns in size the bytes of the caller buffer of plasma_zgesv_buffer(),
+ *  with the settings of the context: the tile matrices of A and B, or the
+ *  scratch translating them with PlasmaInplace, the buffers of the panels
+ *  in each thread, the reduction trees of tournament pivoting and
+ *  the progress table of the static scheduler. The task graph of
+ *  PlasmaRuntimeNative is not part of it.
+ *
+ ******************************************************************************/
+int plasma_zgesv_workspace_query(int n, int nrhs, size_t *size)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Check input arguments.
+    if (n < 0) {
+        plasma_error("illegal value of n");
+        return -1;
+    }
+    if (nrhs < 0) {
+        plasma_error("illegal value of nrhs");
+        return -2;
+    }
+    if (size == NULL) {
+        plasma_error("NULL size");
+        return -3;
+    }
+
+    size_t pool, arena;
+    plasma_zgesv_bytes(plasma, n, nrhs, &pool, &arena);
+    *size = pool+arena;
+    return PlasmaSuccess;
+}
+
+/***************************************************************************//**
+ *
+ *  Solves as plasma_zgesv(), with all its memory carved out of the size
+ *  bytes of buffer, aligned to PLASMA_ALLOCATOR_ALIGN, instead of allocated.
+ *
+ ******************************************************************************/
+int plasma_zgesv_buffer(int n, int nrhs,
+                        plasma_complex64_t *pA, int lda, int *ipiv,
+                        plasma_complex64_t *pB, int ldb,
+                        void *buffer, size_t size)
+{
+    size_t lbuffer;
+    int retval = plasma_zgesv_workspace_query(n, nrhs, &lbuffer);
+    if (retval != PlasmaSuccess)
+        return retval;
+
+    if (lbuffer > 0 &&
+        (buffer == NULL || (uintptr_t)buffer%PLASMA_ALLOCATOR_ALIGN != 0)) {
+        plasma_error("illegal value of buffer");
+        return -8;
+    }
+    if (size < lbuffer) {
+        plasma_error("illegal value of size");
+        return -9;
+    }
+
+    // Carve the buffers of the panels out of the head of the buffer,
+    // and the rest out of the tail.
+    plasma_context_t *plasma = plasma_context_self();
+    size_t pool, arena;
+    plasma_zgesv_bytes(plasma, n, nrhs, &pool, &arena);
+    if (arena > 0)
+        plasma_arena_buffer(&plasma->arena, buffer, arena,
+                            plasma->max_threads);
+    plasma_pool_buffer(&plasma->pool, (char*)buffer+arena, size-arena);
+    retval = plasma_zgesv(n, nrhs, pA, lda, ipiv, pB, ldb);
+    plasma_pool_buffer(&plasma->pool, NULL, 0);
+    plasma_arena_buffer(&plasma->arena, NULL, 0, 0);
+    return retval;
+}
+
 /***************************************************************************//**
  *
  ******************************************************************************/
@@ -157,6 +296,12 @@ void plasma_omp_zgesv(plasma_desc_t A, int *ipiv,
     // Call the parallel functions.
     plasma_pzgetrf(A, ipiv, sequence, request);
 
+    // A zero pivot does not fail the sequence. As in LAPACK, leave B
+    // untouched then, rather than solve with a singular U.
+    #pragma omp taskwait
+    if (sequence->info != 0)
+        return;
+
     plasma_pzgeswp(PlasmaRowwise, B, ipiv, 1, sequence, request);
 
     plasma_pztrsm(PlasmaLeft, PlasmaLower, PlasmaNoTrans, PlasmaUnit,
@@ -79,7 +79,7 @@ int plasma_zgeswp(plasma_enum_t colrow,
     retval = plasma_request_init(&request);
 
     // asynchronous block
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma->max_threads)
     #pragma omp master
     {
         // Translate to tile layout.
@@ -20,6 +20,24 @@
 #include "plasma_workspace.h"
 
 /***************************************************************************//**
+ *
+ *  Computes an LU factorization of a general m-by-n matrix A
+ *  using row interchanges: A = P*L*U.
+ *
+ *  By default, the pivots are chosen by partial pivoting, as in LAPACK.
+ *  With PlasmaPivoting set to PlasmaTournamentPivoting, the pivots of
+ *  each panel are chosen by tournament pivoting (CALU): a reduction tree
+ *  of LU factorizations of the tiles, which does not synchronize the
+ *  panel for every column. Tournament pivoting is as stable as partial
+ *  pivoting in practice, but its worst-case growth factor increases with
+ *  the height of the tree, the elements of L may exceed 1 in magnitude,
+ *  and the pivots generally differ from those of LAPACK.
+ *
+ *  By default, the trailing matrix is updated by a task per tile column.
+ *  With PlasmaTrailingUpdate set to PlasmaTileUpdate, the row interchanges,
+ *  the triangular solve and each tile gemm are tasks of their own, which
+ *  exposes more parallelism for tall matrices. This requires OpenMP
+ *  iterators in depend clauses; otherwise, columns are updated as a whole.
  *
  ******************************************************************************/
 int plasma_zgetrf(int m, int n,
@@ -62,8 +80,15 @@ int plasma_zgetrf(int m, int n,
     // Create tile matrix.
     plasma_desc_t A;
     int retval;
-    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
-                                        m, n, 0, 0, m, n, &A);
+    if (plasma->layout == PlasmaLapackLayout)
+        retval = plasma_desc_general_lapack_init(PlasmaComplexDouble, pA, nb, nb,
+                                                 lda, m, n, 0, 0, m, n, &A);
+    else if (plasma->inplace_outplace == PlasmaInplace)
+        retval = plasma_desc_general_inplace_init(PlasmaComplexDouble, pA, nb, nb,
+                                                  lda, n, 0, 0, m, n, &A);
+    else
+        retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
+                                            m, n, 0, 0, m, n, &A);
     if (retval != PlasmaSuccess) {
         plasma_error("plasma_desc_general_create() failed");
         return retval;
@@ -77,7 +102,8 @@ int plasma_zgetrf(int m, int n,
     plasma_request_t request;
     retval = plasma_request_init(&request);
 
-    #pragma omp parallel
+    // asynchronous block
+    #pragma omp parallel num_threads(plasma->max_threads)
     #pragma omp master
     {
         // Translate to tile layout.
@@ -85,27 +111,21 @@ int plasma_zgetrf(int m, int n,
 
         // Call the tile async function.
         plasma_omp_zgetrf(A, ipiv, &sequence, &request);
-    }
-
-    // If status/=0, matrix is singular don't copy back the factored matrix.
-    if (sequence.status == 0) {
 
         // Translate back to LAPACK layout.
-        #pragma omp parallel
-        #pragma omp master
-        {
-            plasma_omp_zdesc2ge(A, pA, lda, &sequence, &request);
-        }
-    }
-    else {
-        plasma_request_fail(&sequence, &request, imin(m,n) + sequence.status);
+        // Each tile is copied back as soon as it is final,
+        // and a singular matrix is copied back as well.
+        plasma_omp_zdesc2ge(A, pA, lda, &sequence, &request);
     }
+    // implicit synchronization
 
     // Free matrix A in tile layout.
     plasma_desc_destroy(&A);
 
-    // Return status.
+    // Return status, or the index of the first zero pivot.
     int status = sequence.status;
+    if (status == PlasmaSuccess)
+        status = sequence.info;
     return status;
 }
 
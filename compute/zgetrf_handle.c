@@ -0,0 +1,286 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+
+#include "plasma.h"
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_factor.h"
+#include "plasma_internal.h"
+#include "plasma_tuning.h"
+#include "plasma_types.h"
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_getrf
+ *
+ *  Computes the LU factorization with partial pivoting of an m-by-n matrix A
+ *  and keeps the factors in tile layout in a handle, for repeated solves
+ *  with plasma_zgetrs_handle().
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *          The number of rows of the matrix A. m >= 0.
+ *
+ * @param[in] n
+ *          The number of columns of the matrix A. n >= 0.
+ *
+ * @param[in] pA
+ *          The m-by-n matrix A to be factored. It is not modified.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A. lda >= max(1,m).
+ *
+ * @param[out] F
+ *          The handle receiving the factors L and U and the pivot indices.
+ *          Release it with plasma_factor_destroy().
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval  < 0 if -i, the i-th argument had an illegal value
+ * @retval  > 0 if i, U(i,i) is exactly zero. The factorization has been
+ *          completed, but U is singular and a solve would divide by zero.
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_zgetrs_handle
+ * @sa plasma_factor_destroy
+ * @sa plasma_cgetrf_handle
+ * @sa plasma_dgetrf_handle
+ * @sa plasma_sgetrf_handle
+ *
+ ******************************************************************************/
+int plasma_zgetrf_handle(int m, int n,
+                         plasma_complex64_t *pA, int lda,
+                         plasma_factor_t *F)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Check input arguments.
+    if (m < 0) {
+        plasma_error("illegal value of m");
+        return -1;
+    }
+    if (n < 0) {
+        plasma_error("illegal value of n");
+        return -2;
+    }
+    if (lda < imax(1, m)) {
+        plasma_error("illegal value of lda");
+        return -4;
+    }
+    if (F == NULL) {
+        plasma_error("NULL F");
+        return -5;
+    }
+
+    // Tune parameters.
+    if (plasma->tuning)
+        plasma_tune_getrf(plasma, PlasmaComplexDouble, m, n);
+
+    // Set tiling parameters.
+    int nb = plasma->nb;
+
+    // Start with an empty handle.
+    F->uplo = PlasmaGeneral;
+    F->ipiv = NULL;
+    plasma_desc_general_init(PlasmaComplexDouble, NULL, nb, nb,
+                             m, n, 0, 0, m, n, &F->A);
+
+    // quick return
+    if (imin(m, n) == 0)
+        return PlasmaSuccess;
+
+    // Initialize barrier.
+    plasma_barrier_init(&plasma->barrier);
+
+    // Create tile matrix kept by the handle.
+    int retval;
+    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
+                                        m, n, 0, 0, m, n, &F->A);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_create() failed");
+        F->A.matrix = NULL;
+        return retval;
+    }
+    F->ipiv = (int*)malloc((size_t)imin(m, n)*sizeof(int));
+    if (F->ipiv == NULL) {
+        plasma_error("malloc() failed");
+        plasma_factor_destroy(F);
+        return PlasmaErrorOutOfMemory;
+    }
+
+    // Initialize sequence.
+    plasma_sequence_t sequence;
+    retval = plasma_sequence_init(&sequence);
+
+    // Initialize request.
+    plasma_request_t request;
+    retval = plasma_request_init(&request);
+
+    // asynchronous block
+    #pragma omp parallel num_threads(plasma->max_threads)
+    #pragma omp master
+    {
+        // Translate to tile layout.
+        plasma_omp_zge2desc(pA, lda, F->A, &sequence, &request);
+
+        // Call the tile async function.
+        plasma_omp_zgetrf(F->A, F->ipiv, &sequence, &request);
+    }
+    // implicit synchronization
+
+    // Keep the factors only if the factorization went through.
+    if (sequence.status != PlasmaSuccess)
+        plasma_factor_destroy(F);
+
+    // Return status, or the index of the first zero pivot.
+    int status = sequence.status;
+    if (status == PlasmaSuccess)
+        status = sequence.info;
+    return status;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_getrs
+ *
+ *  Solves a system of linear equations A * X = B, A^T * X = B or
+ *  A^H * X = B with the LU factors kept by plasma_zgetrf_handle().
+ *  Only the right-hand sides are translated, the factors stay in tile layout.
+ *
+ *******************************************************************************
+ *
+ * @param[in] trans
+ *          - PlasmaNoTrans:   A is not transposed,
+ *          - PlasmaTrans:     A is transposed,
+ *          - PlasmaConjTrans: A is conjugate transposed.
+ *
+ * @param[in] F
+ *          The handle from plasma_zgetrf_handle() of an n-by-n matrix A.
+ *
+ * @param[in] nrhs
+ *          The number of right hand sides, i.e., the number of
+ *          columns of the matrix B. nrhs >= 0.
+ *
+ * @param[in,out] pB
+ *          On entry, the n-by-nrhs right hand side matrix B.
+ *          On exit, if return value = 0, the n-by-nrhs solution matrix X.
+ *
+ * @param[in] ldb
+ *          The leading dimension of the array B. ldb >= max(1,n).
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval  < 0 if -i, the i-th argument had an illegal value
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_zgetrf_handle
+ * @sa plasma_cgetrs_handle
+ * @sa plasma_dgetrs_handle
+ * @sa plasma_sgetrs_handle
+ *
+ ******************************************************************************/
+int plasma_zgetrs_handle(plasma_enum_t trans, plasma_factor_t *F,
+                         int nrhs, plasma_complex64_t *pB, int ldb)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Check input arguments.
+    if ((trans != PlasmaNoTrans) &&
+        (trans != PlasmaTrans) &&
+        (trans != PlasmaConjTrans)) {
+        plasma_error("illegal value of trans");
+        return -1;
+    }
+    if (F == NULL ||
+        F->uplo != PlasmaGeneral ||
+        F->A.precision != PlasmaComplexDouble ||
+        F->A.m != F->A.n) {
+        plasma_error("illegal value of F");
+        return -2;
+    }
+    int n = F->A.n;
+    if (nrhs < 0) {
+        plasma_error("illegal value of nrhs");
+        return -3;
+    }
+    if (ldb < imax(1, n)) {
+        plasma_error("illegal value of ldb");
+        return -5;
+    }
+
+    // quick return
+    if (imin(n, nrhs) == 0)
+        return PlasmaSuccess;
+
+    // Use the tiling of the factors.
+    int nb = F->A.nb;
+
+    // Create tile matrix.
+    plasma_desc_t B;
+    int retval;
+    if (plasma->layout == PlasmaLapackLayout)
+        retval = plasma_desc_general_lapack_init(PlasmaComplexDouble, pB, nb, nb,
+                                                 ldb, n, nrhs, 0, 0, n, nrhs, &B);
+    else
+        retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
+                                            n, nrhs, 0, 0, n, nrhs, &B);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_create() failed");
+        return retval;
+    }
+
+    // Initialize sequence.
+    plasma_sequence_t sequence;
+    retval = plasma_sequence_init(&sequence);
+
+    // Initialize request.
+    plasma_request_t request;
+    retval = plasma_request_init(&request);
+
+    // asynchronous block
+    #pragma omp parallel num_threads(plasma->max_threads)
+    #pragma omp master
+    {
+        // Translate to tile layout.
+        plasma_omp_zge2desc(pB, ldb, B, &sequence, &request);
+
+        // Call the tile async function.
+        plasma_omp_zgetrs(trans, F->A, F->ipiv, B, &sequence, &request);
+
+        // Translate back to LAPACK layout.
+        plasma_omp_zdesc2ge(B, pB, ldb, &sequence, &request);
+    }
+    // implicit synchronization
+
+    // Free matrix B in tile layout.
+    plasma_desc_destroy(&B);
+
+    // Return status.
+    int status = sequence.status;
+    return status;
+}
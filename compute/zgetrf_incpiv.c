@@ -0,0 +1,303 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+
+#include "plasma.h"
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_tuning.h"
+#include "plasma_types.h"
+#include "plasma_workspace.h"
+
+#include <stdlib.h>
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_getrf_incpiv
+ *
+ *  Computes a tile LU factorization of a general m-by-n matrix A
+ *  with incremental pivoting.
+ *  The diagonal tile of a step is factored with partial pivoting,
+ *  then each tile below it is factored together with the upper triangle
+ *  of the diagonal tile, with rows only interchanged within the pair.
+ *  The factorization is thus a DAG of tile kernels, without the
+ *  synchronized panel of plasma_zgetrf(), which pays off for tall
+ *  matrices and many cores. The pivoting is however less stable than
+ *  partial pivoting, the growth factor of which it may exceed, and the
+ *  factors are not those of LAPACK: they are only usable through
+ *  plasma_zgetrs_incpiv().
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *          The number of rows of the matrix A.
+ *          m >= 0.
+ *
+ * @param[in] n
+ *          The number of columns of the matrix A.
+ *          n >= 0.
+ *
+ * @param[in,out] pA
+ *          On entry, pointer to the m-by-n matrix A.
+ *          On exit, the elements on and above the diagonal contain
+ *          the upper trapezoidal factor U; the elements below the
+ *          diagonal contain the factors L of the tiles.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A. lda >= max(1,m).
+ *
+ * @param[out] L
+ *          On exit, the factors L of the rows pivoted between tiles,
+ *          required by plasma_zgetrs_incpiv to solve the system of
+ *          equations.
+ *          Matrix in L is allocated inside this function and needs to be
+ *          destroyed by plasma_desc_destroy.
+ *
+ * @param[out] ipiv
+ *          On exit, the pivot indices of the tiles, required by
+ *          plasma_zgetrs_incpiv.
+ *          The array is allocated inside this function and needs to be
+ *          freed by free.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ * @retval > 0 if i, U(i,i) is exactly zero. The factorization has been
+ *         completed, but the factor U is exactly singular, and division
+ *         by zero will occur if it is used to solve a system of equations.
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_omp_zgetrf_incpiv
+ * @sa plasma_cgetrf_incpiv
+ * @sa plasma_dgetrf_incpiv
+ * @sa plasma_sgetrf_incpiv
+ * @sa plasma_zgetrs_incpiv
+ * @sa plasma_zgetrf
+ *
+ ******************************************************************************/
+int plasma_zgetrf_incpiv(int m, int n,
+                         plasma_complex64_t *pA, int lda,
+                         plasma_desc_t *L, int **ipiv)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Check input arguments.
+    if (m < 0) {
+        plasma_error("illegal value of m");
+        return -1;
+    }
+    if (n < 0) {
+        plasma_error("illegal value of n");
+        return -2;
+    }
+    if (lda < imax(1, m)) {
+        plasma_error("illegal value of lda");
+        return -4;
+    }
+
+    // quick return
+    if (imin(m, n) == 0)
+        return PlasmaSuccess;
+
+    // Tune parameters.
+    if (plasma->tuning)
+        plasma_tune_getrf(plasma, PlasmaComplexDouble, m, n);
+
+    // Set tiling parameters.
+    int ib = plasma->ib;
+    int nb = plasma->nb;
+
+    // Create tile matrix.
+    plasma_desc_t A;
+    int retval;
+    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
+                                        m, n, 0, 0, m, n, &A);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_create() failed");
+        return retval;
+    }
+
+    // Prepare descriptor L, with the tiles of T of the QR factorization.
+    retval = plasma_descT_create(A, ib, PlasmaFlatHouseholder, L);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_descT_create() failed");
+        plasma_desc_destroy(&A);
+        return retval;
+    }
+
+    // Allocate pivots, nb per tile.
+    *ipiv = (int*)malloc((size_t)A.mb*A.mt*A.nt*sizeof(int));
+    if (*ipiv == NULL) {
+        plasma_error("malloc() failed");
+        plasma_desc_destroy(&A);
+        plasma_desc_destroy(L);
+        return PlasmaErrorOutOfMemory;
+    }
+
+    // Allocate workspace.
+    plasma_workspace_t work;
+    size_t lwork = ib*ib;  // tstrf: triangle of a block of U
+    retval = plasma_workspace_create(&work, lwork, PlasmaComplexDouble);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_workspace_create() failed");
+        plasma_desc_destroy(&A);
+        plasma_desc_destroy(L);
+        free(*ipiv);
+        return retval;
+    }
+
+    // Initialize sequence.
+    plasma_sequence_t sequence;
+    retval = plasma_sequence_init(&sequence);
+
+    // Initialize request.
+    plasma_request_t request;
+    retval = plasma_request_init(&request);
+
+    // asynchronous block
+    #pragma omp parallel num_threads(plasma->max_threads)
+    #pragma omp master
+    {
+        // Translate to tile layout.
+        plasma_omp_zge2desc(pA, lda, A, &sequence, &request);
+
+        // Call the tile async function.
+        plasma_omp_zgetrf_incpiv(A, *L, *ipiv, work, &sequence, &request);
+
+        // Translate back to LAPACK layout.
+        plasma_omp_zdesc2ge(A, pA, lda, &sequence, &request);
+    }
+    // implicit synchronization
+
+    plasma_workspace_destroy(&work);
+
+    // Free matrix A in tile layout.
+    plasma_desc_destroy(&A);
+
+    // Return status, or the index of the first zero pivot.
+    int status = sequence.status;
+    if (status == PlasmaSuccess)
+        status = sequence.info;
+    return status;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_getrf_incpiv
+ *
+ *  Computes a tile LU factorization with incremental pivoting.
+ *  Non-blocking tile version of plasma_zgetrf_incpiv().
+ *  May return before the computation is finished.
+ *  Operates on matrices stored by tiles.
+ *  All matrices are passed through descriptors.
+ *  All dimensions are taken from the descriptors.
+ *  Allows for pipelining of operations at runtime.
+ *
+ *******************************************************************************
+ *
+ * @param[in,out] A
+ *          Descriptor of matrix A.
+ *          A is stored in the tile layout.
+ *
+ * @param[out] L
+ *          Descriptor of matrix L, with tiles of ib-by-nb, as created by
+ *          plasma_descT_create.
+ *          On exit, the factors L of the rows pivoted between tiles.
+ *
+ * @param[out] ipiv
+ *          The pivot indices, of length A.mb*A.mt*A.nt.
+ *
+ * @param[in] work
+ *          Workspace for the auxiliary arrays needed by some coreblas kernels.
+ *          For the incremental pivoting, contains preallocated space for
+ *          an ib-by-ib block of U. Allocated by the plasma_workspace_create
+ *          function.
+ *
+ * @param[in] sequence
+ *          Identifies the sequence of function calls that this call belongs to
+ *          (for completion checks and exception handling purposes).
+ *
+ * @param[out] request
+ *          Identifies this function call (for exception handling purposes).
+ *
+ * @retval void
+ *          Errors are returned by setting sequence->status and
+ *          request->status to error values.  The sequence->status and
+ *          request->status should never be set to PlasmaSuccess (the
+ *          initial values) since another async call may be setting a
+ *          failure value at the same time. The first zero pivot is
+ *          returned in sequence->info.
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_zgetrf_incpiv
+ * @sa plasma_omp_cgetrf_incpiv
+ * @sa plasma_omp_dgetrf_incpiv
+ * @sa plasma_omp_sgetrf_incpiv
+ * @sa plasma_omp_zgetrs_incpiv
+ *
+ ******************************************************************************/
+void plasma_omp_zgetrf_incpiv(plasma_desc_t A, plasma_desc_t L, int *ipiv,
+                              plasma_workspace_t work,
+                              plasma_sequence_t *sequence,
+                              plasma_request_t *request)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
+    // Check input arguments.
+    if (plasma_desc_check(A) != PlasmaSuccess) {
+        plasma_error("invalid A");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (plasma_desc_check(L) != PlasmaSuccess) {
+        plasma_error("invalid L");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (ipiv == NULL) {
+        plasma_error("NULL ipiv");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (sequence == NULL) {
+        plasma_fatal_error("NULL sequence");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (request == NULL) {
+        plasma_fatal_error("NULL request");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
+    // quick return
+    if (imin(A.m, A.n) == 0)
+        return;
+
+    // Call the parallel function.
+    plasma_pzgetrf_incpiv(A, L, ipiv, work, sequence, request);
+}
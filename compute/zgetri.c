@@ -111,7 +111,7 @@ int plasma_zgetri(int n, plasma_complex64_t *pA, int lda, int *ipiv)
     retval = plasma_request_init(&request);
 
     // asynchronous block
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma->max_threads)
     #pragma omp master
     {
         // Translate to tile layout.
@@ -103,7 +103,7 @@ int plasma_zgetri_aux(int n, plasma_complex64_t *pA, int lda)
     retval = plasma_request_init(&request);
 
     // asynchronous block
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma->max_threads)
     #pragma omp master
     {
         // Translate to tile layout.
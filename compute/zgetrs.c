@@ -74,14 +74,22 @@ int plasma_zgetrs(plasma_enum_t trans, int n, int nrhs,
     plasma_desc_t A;
     plasma_desc_t B;
     int retval;
-    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
-                                        n, n, 0, 0, n, n, &A);
+    if (plasma->layout == PlasmaLapackLayout)
+        retval = plasma_desc_general_lapack_init(PlasmaComplexDouble, pA, nb, nb,
+                                                 lda, n, n, 0, 0, n, n, &A);
+    else
+        retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
+                                            n, n, 0, 0, n, n, &A);
     if (retval != PlasmaSuccess) {
         plasma_error("plasma_desc_general_create() failed");
         return retval;
     }
-    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
-                                        n, nrhs, 0, 0, n, nrhs, &B);
+    if (plasma->layout == PlasmaLapackLayout)
+        retval = plasma_desc_general_lapack_init(PlasmaComplexDouble, pB, nb, nb,
+                                                 ldb, n, nrhs, 0, 0, n, nrhs, &B);
+    else
+        retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
+                                            n, nrhs, 0, 0, n, nrhs, &B);
     if (retval != PlasmaSuccess) {
         plasma_error("plasma_desc_general_create() failed");
         return retval;
@@ -95,7 +103,7 @@ int plasma_zgetrs(plasma_enum_t trans, int n, int nrhs,
     plasma_request_t request;
     retval = plasma_request_init(&request);
 
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma->max_threads)
     #pragma omp master
     {
         // Translate to tile layout.
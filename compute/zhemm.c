@@ -190,7 +190,7 @@ int plasma_zhemm(plasma_enum_t side, plasma_enum_t uplo,
     retval = plasma_request_init(&request);
 
     // asynchronous block
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma->max_threads)
     #pragma omp master
     {
         // Translate to tile layout.
@@ -200,7 +200,7 @@ int plasma_zhesv(plasma_enum_t uplo, int n, int nrhs,
     for (int i = 0; i < nb; i++) ipiv[i] = 1+i;
 
     // asynchronous block
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma->max_threads)
     #pragma omp master
     {
         // Translate to tile layout.
@@ -210,7 +210,7 @@ int plasma_zhesv(plasma_enum_t uplo, int n, int nrhs,
     }
     // implicit synchronization
 
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma->max_threads)
     #pragma omp master
     {
         // Call the tile async function.
@@ -218,7 +218,7 @@ int plasma_zhesv(plasma_enum_t uplo, int n, int nrhs,
     }
     // implicit synchronization
 
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma->max_threads)
     #pragma omp master
     {
         // Translate back to LAPACK layout.
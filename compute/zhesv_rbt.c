@@ -0,0 +1,565 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee,  US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+
+
+#include "plasma.h"
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_tuning.h"
+#include "plasma_types.h"
+#include "plasma_workspace.h"
+#include "core_lapack.h"
+
+#include <math.h>
+#include <omp.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_hesv
+ *
+ *  Computes the solution to a system of linear equations A * X = B, where A is
+ *  an n-by-n Hermitian indefinite matrix and X and B are n-by-nrhs matrices,
+ *  with a random butterfly transform (RBT) of A instead of pivoting.
+ *
+ *  The matrix A is transformed into the Hermitian matrix Ar = U^T * A * U,
+ *  where U is a recursive random butterfly matrix of depth 2, which with
+ *  probability close to one makes the LDL^H factorization without pivoting
+ *  of Ar stable. Ar is then factored without pivoting, as a pure DAG of
+ *  tile kernels like the Cholesky factorization, and the solution is
+ *  X = U * Ar^{-1} * U^T * B. The transform costs O(n^2) operations and
+ *  is seeded deterministically.
+ *
+ *  Iterative refinement with A is then applied to recover accuracy, with
+ *  the stopping criterion of plasma_zgesv_rbt(), for at most itermax
+ *  iterations. Unlike plasma_zhesv(), there is no fallback to pivoting.
+ *
+ *******************************************************************************
+ *
+ * @param[in] uplo
+ *          - PlasmaUpper: Upper triangle of A is stored;
+ *          - PlasmaLower: Lower triangle of A is stored.
+ *          Only PlasmaLower is supported.
+ *
+ * @param[in] n
+ *          The number of linear equations, i.e., the order of the matrix A.
+ *          n >= 0.
+ *
+ * @param[in] nrhs
+ *          The number of right hand sides, i.e., the number of columns of the
+ *          matrix B. nrhs >= 0.
+ *
+ * @param[in] pA
+ *          The n-by-n Hermitian matrix A, of which the triangle given by uplo
+ *          is referenced.
+ *          This matrix remains unchanged.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A. lda >= max(1,n).
+ *
+ * @param[in] pB
+ *          The n-by-nrhs matrix of right hand side matrix B.
+ *          This matrix remains unchanged.
+ *
+ * @param[in] ldb
+ *          The leading dimension of the array B. ldb >= max(1,n).
+ *
+ * @param[out] pX
+ *          If return value = 0, the n-by-nrhs solution matrix X.
+ *
+ * @param[in] ldx
+ *          The leading dimension of the array X. ldx >= max(1,n).
+ *
+ * @param[in] itermax
+ *          The maximum number of iterations of the iterative refinement.
+ *          If itermax = 0, the solution is not refined. itermax >= 0.
+ *
+ * @param[out] iter
+ *          The number of the iterations in the iterative refinement
+ *          process, needed for the convergence. If failed, it is set
+ *          to be -(1+itermax).
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ * @retval > 0 if i, the i-th pivot of the transformed matrix is exactly
+ *         zero, and the solution has not been computed.
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_omp_zhesv_rbt
+ * @sa plasma_chesv_rbt
+ * @sa plasma_dsysv_rbt
+ * @sa plasma_ssysv_rbt
+ * @sa plasma_zgesv_rbt
+ *
+ ******************************************************************************/
+int plasma_zhesv_rbt(plasma_enum_t uplo, int n, int nrhs,
+                     plasma_complex64_t *pA, int lda,
+                     plasma_complex64_t *pB, int ldb,
+                     plasma_complex64_t *pX, int ldx,
+                     int itermax, int *iter)
+{
+    // Get PLASMA context
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Check input arguments.
+    if (//(uplo != PlasmaUpper) &&
+        (uplo != PlasmaLower)) {
+        plasma_error("illegal value of uplo (Upper not supported, yet)");
+        return -1;
+    }
+    if (n < 0) {
+        plasma_error("illegal value of n");
+        return -2;
+    }
+    if (nrhs < 0) {
+        plasma_error("illegal value of nrhs");
+        return -3;
+    }
+    if (lda < imax(1, n)) {
+        plasma_error("illegal value of lda");
+        return -5;
+    }
+    if (ldb < imax(1, n)) {
+        plasma_error("illegal value of ldb");
+        return -7;
+    }
+    if (ldx < imax(1, n)) {
+        plasma_error("illegal value of ldx");
+        return -9;
+    }
+    if (itermax < 0) {
+        plasma_error("illegal value of itermax");
+        return -10;
+    }
+
+    // quick return
+    *iter = 0;
+    if (imin(n, nrhs) == 0)
+        return PlasmaSuccess;
+
+    // Tune parameters.
+    if (plasma->tuning)
+        plasma_tune_potrf(plasma, PlasmaComplexDouble, n);
+
+    // Set tiling parameters.
+    int nb = plasma->nb;
+
+    // Create tile matrices.
+    plasma_desc_t A;
+    plasma_desc_t B;
+    plasma_desc_t X;
+    int retval;
+    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
+                                        n, n, 0, 0, n, n, &A);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_create() failed");
+        return retval;
+    }
+    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
+                                        n, nrhs, 0, 0, n, nrhs, &B);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_create() failed");
+        plasma_desc_destroy(&A);
+        return retval;
+    }
+    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
+                                        n, nrhs, 0, 0, n, nrhs, &X);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_create() failed");
+        plasma_desc_destroy(&A);
+        plasma_desc_destroy(&B);
+        return retval;
+    }
+
+    // Create additional tile matrices.
+    plasma_desc_t Ar, R;
+    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
+                                        A.m, A.n, 0, 0, A.m, A.n, &Ar);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_create() failed");
+        plasma_desc_destroy(&A);
+        plasma_desc_destroy(&B);
+        plasma_desc_destroy(&X);
+        return retval;
+    }
+    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
+                                        B.m, B.n, 0, 0, B.m, B.n, &R);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_create() failed");
+        plasma_desc_destroy(&A);
+        plasma_desc_destroy(&B);
+        plasma_desc_destroy(&X);
+        plasma_desc_destroy(&Ar);
+        return retval;
+    }
+
+    // Allocate workspace.
+    plasma_workspace_t hwork;
+    size_t lwork = nb*nb;  // gemdm: D * L^H of a tile
+    retval = plasma_workspace_create(&hwork, lwork, PlasmaComplexDouble);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_workspace_create() failed");
+        plasma_desc_destroy(&A);
+        plasma_desc_destroy(&B);
+        plasma_desc_destroy(&X);
+        plasma_desc_destroy(&Ar);
+        plasma_desc_destroy(&R);
+        return retval;
+    }
+
+    // Generate the random butterfly, with entries exp(r/10) for r
+    // uniform in (-1/2, 1/2).
+    const int depth = 2;
+    double *u = (double*)malloc((size_t)depth*n*sizeof(double));
+    int seed[] = {0, 0, 0, 1};
+    LAPACKE_dlarnv_work(1, seed, depth*n, u);
+    for (int i = 0; i < depth*n; i++)
+        u[i] = exp((u[i]-0.5)/10.0);
+
+    // Allocate tiled workspace for Infinity norm calculations.
+    lwork = imax((size_t)A.mt*A.n+A.n, (size_t)X.mt*X.n+(size_t)R.mt*R.n);
+    double *work  = (double*)malloc((lwork)*sizeof(double));
+    double *Rnorm = (double*)malloc(((size_t)R.n)*sizeof(double));
+    double *Xnorm = (double*)malloc(((size_t)X.n)*sizeof(double));
+
+    // Initialize sequence.
+    plasma_sequence_t sequence;
+    retval = plasma_sequence_init(&sequence);
+
+    // Initialize request.
+    plasma_request_t request;
+    retval = plasma_request_init(&request);
+
+    // asynchronous block
+    #pragma omp parallel num_threads(plasma->max_threads)
+    #pragma omp master
+    {
+        // Translate matrices to tile layout.
+        plasma_omp_zge2desc(pA, lda, A, &sequence, &request);
+        plasma_omp_zge2desc(pB, ldb, B, &sequence, &request);
+
+        // Call tile async function.
+        plasma_omp_zhesv_rbt(uplo, A, B, X, Ar, R, depth, u,
+                             itermax, hwork, work, Rnorm, Xnorm, iter,
+                             &sequence, &request);
+
+        // Translate back to LAPACK layout.
+        plasma_omp_zdesc2ge(X, pX, ldx, &sequence, &request);
+    }
+    // implicit synchronization
+
+    plasma_workspace_destroy(&hwork);
+
+    // Free matrices in tile layout.
+    plasma_desc_destroy(&A);
+    plasma_desc_destroy(&B);
+    plasma_desc_destroy(&X);
+    plasma_desc_destroy(&Ar);
+    plasma_desc_destroy(&R);
+    free(u);
+    free(work);
+    free(Rnorm);
+    free(Xnorm);
+
+    // Return status, or the index of the first zero pivot.
+    int status = sequence.status;
+    if (status == PlasmaSuccess)
+        status = sequence.info;
+    return status;
+}
+
+
+// Checks, that convergence criterion is true for all columns of R and X
+static bool conv(double *Rnorm, double *Xnorm, int n, double cte) {
+
+    bool value = true;
+
+    for (int i = 0; i < n; i++) {
+        if (Rnorm[i] > Xnorm[i] * cte) {
+            value = false;
+            break;
+        }
+    }
+
+    return value;
+}
+
+// Solves A * X = B with the factors of Ar = U^T * A * U, overwriting B.
+static void solve(plasma_enum_t uplo, plasma_desc_t Ar,
+                  int depth, const double *u, plasma_desc_t B,
+                  plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    plasma_pzgerbt(PlasmaLeft, PlasmaTrans, depth, u, B, sequence, request);
+    plasma_pzhetrs_nopiv(uplo, Ar, B, sequence, request);
+    plasma_pzgerbt(PlasmaLeft, PlasmaNoTrans, depth, u, B, sequence, request);
+}
+
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_hesv
+ *
+ *  Solves a Hermitian indefinite linear system of equations using a random
+ *  butterfly transform, the LDL^H factorization without pivoting and
+ *  iterative refinement.
+ *  Non-blocking tile version of plasma_zhesv_rbt().
+ *  Operates on matrices stored by tiles.
+ *  All matrices are passed through descriptors.
+ *  All dimensions are taken from the descriptors.
+ *  Allows for pipelining of operations at runtime.
+ *
+ *******************************************************************************
+ *
+ * @param[in] uplo
+ *          - PlasmaLower: Lower triangle of A is stored.
+ *          Only PlasmaLower is supported.
+ *
+ * @param[in] A
+ *          Descriptor of matrix A.
+ *
+ * @param[in] B
+ *          Descriptor of matrix B.
+ *
+ * @param[out] X
+ *          Descriptor of the solution matrix X.
+ *
+ * @param[out] Ar
+ *          Descriptor of auxiliary matrix, on exit the LDL^H factors of
+ *          the transformed matrix U^T * A * U in its lower triangle.
+ *
+ * @param[out] R
+ *          Descriptor of auxiliary remainder matrix R.
+ *
+ * @param[in] depth
+ *          The depth of the butterfly transform U. depth >= 0.
+ *
+ * @param[in] u
+ *          The diagonals of the butterflies of U, of length depth*A.n,
+ *          the entries of level l starting at u[l*A.n].
+ *
+ * @param[in] itermax
+ *          The maximum number of iterations of the iterative refinement.
+ *
+ * @param[in] hwork
+ *          Workspace for the auxiliary arrays needed by some coreblas kernels.
+ *          For the LDL^H factorization, contains preallocated space for
+ *          a tile. Allocated by the plasma_workspace_create function.
+ *
+ * @param[out] work
+ *          Workspace needed to compute infinity norm of the matrix A.
+ *
+ * @param[out] Rnorm
+ *          Workspace needed to store the max value in each of resudual vectors.
+ *
+ * @param[out] Xnorm
+ *          Workspace needed to store the max value in each of currenct solution
+ *          vectors.
+ *
+ * @param[out] iter
+ *          The number of the iterations in the iterative refinement
+ *          process, needed for the convergence. If failed, it is set
+ *          to be -(1+itermax).
+ *
+ * @param[in] sequence
+ *          Identifies the sequence of function calls that this call belongs to
+ *          (for completion checks and exception handling purposes).
+ *
+ * @param[out] request
+ *          Identifies this function call (for exception handling purposes).
+ *
+ * @retval void
+ *          Errors are returned by setting sequence->status and
+ *          request->status to error values.  The sequence->status and
+ *          request->status should never be set to PlasmaSuccess (the
+ *          initial values) since another async call may be setting a
+ *          failure value at the same time. The first zero pivot is
+ *          returned in sequence->info.
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_zhesv_rbt
+ * @sa plasma_omp_chesv_rbt
+ * @sa plasma_omp_dsysv_rbt
+ * @sa plasma_omp_ssysv_rbt
+ * @sa plasma_omp_zgesv_rbt
+ *
+ ******************************************************************************/
+void plasma_omp_zhesv_rbt(plasma_enum_t uplo,
+                          plasma_desc_t A, plasma_desc_t B, plasma_desc_t X,
+                          plasma_desc_t Ar, plasma_desc_t R,
+                          int depth, const double *u,
+                          int itermax, plasma_workspace_t hwork,
+                          double *work, double *Rnorm, double *Xnorm,
+                          int *iter,
+                          plasma_sequence_t *sequence,
+                          plasma_request_t *request)
+{
+    const plasma_complex64_t zmone = -1.0;
+    const plasma_complex64_t zone  =  1.0;
+    *iter = 0;
+
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
+    // Check input arguments.
+    if (//(uplo != PlasmaUpper) &&
+        (uplo != PlasmaLower)) {
+        plasma_error("illegal value of uplo (Upper not supported, yet)");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (plasma_desc_check(A) != PlasmaSuccess) {
+        plasma_error("invalid A");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (plasma_desc_check(B) != PlasmaSuccess) {
+        plasma_error("invalid B");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (plasma_desc_check(X) != PlasmaSuccess) {
+        plasma_error("invalid X");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (plasma_desc_check(Ar) != PlasmaSuccess) {
+        plasma_error("invalid Ar");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (plasma_desc_check(R) != PlasmaSuccess) {
+        plasma_error("invalid R");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (depth < 0) {
+        plasma_error("illegal value of depth");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (depth > 0 && u == NULL) {
+        plasma_error("NULL butterflies");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (itermax < 0) {
+        plasma_error("illegal value of itermax");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (sequence == NULL) {
+        plasma_error("NULL sequence");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (request == NULL) {
+        plasma_error("NULL request");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
+    // quick return
+    if (A.n == 0 || B.n == 0)
+        return;
+
+    // Expand the stored triangle of A, transform it and factor it
+    // without pivoting.
+    plasma_pzlacpy(PlasmaLower, PlasmaNoTrans, A, Ar, sequence, request);
+    plasma_pzlacpy(PlasmaLower, PlasmaConjTrans, A, Ar, sequence, request);
+    plasma_pzgerbt(PlasmaLeft, PlasmaTrans, depth, u, Ar, sequence, request);
+    plasma_pzgerbt(PlasmaRight, PlasmaNoTrans, depth, u, Ar,
+                   sequence, request);
+    plasma_pzhetrf_nopiv(uplo, Ar, hwork, sequence, request);
+
+    // Solve the system Ar * Y = U^T * B and set X = U * Y.
+    plasma_pzlacpy(PlasmaGeneral, PlasmaNoTrans, B, X, sequence, request);
+    solve(uplo, Ar, depth, u, X, sequence, request);
+
+    if (itermax == 0)
+        return;
+
+    // workspaces for dzamax
+    double *workX = work;
+    double *workR = &work[X.mt*X.n];
+
+    // Compute some constants.
+    double cte;
+    double eps = LAPACKE_dlamch_work('E');
+    double Anorm;
+    plasma_pzlanhe(PlasmaInfNorm, uplo, A, work, &Anorm, sequence, request);
+
+    // Compute R = B - A * X.
+    plasma_pzlacpy(PlasmaGeneral, PlasmaNoTrans, B, R, sequence, request);
+    plasma_pzhemm(PlasmaLeft, uplo,
+                  zmone, A, X, zone, R, sequence, request);
+
+    // Check whether the nrhs normwise backward error satisfies the
+    // stopping criterion. If yes, set iter=0 and return.
+    plasma_pdzamax(PlasmaColumnwise, X, workX, Xnorm, sequence, request);
+    plasma_pdzamax(PlasmaColumnwise, R, workR, Rnorm, sequence, request);
+
+    #pragma omp taskwait
+    {
+        cte = Anorm * eps * sqrt((double)A.n);
+
+        // Return with a zero pivot, as there is nothing to refine.
+        if (sequence->info != 0 || conv(Rnorm, Xnorm, R.n, cte)) {
+           *iter = 0;
+            return;
+        }
+    }
+
+    // iterative refinement
+    for (int iiter = 0; iiter < itermax; iiter++) {
+        // Solve the system A * D = R and update the current iterate.
+        solve(uplo, Ar, depth, u, R, sequence, request);
+        plasma_pzgeadd(PlasmaNoTrans, zone, R, zone, X, sequence, request);
+
+        // Compute R = B - A * X.
+        plasma_pzlacpy(PlasmaGeneral, PlasmaNoTrans, B, R, sequence, request);
+        plasma_pzhemm(PlasmaLeft, uplo, zmone, A, X, zone, R,
+                      sequence, request);
+
+        // Check whether nrhs normwise backward error satisfies the
+        // stopping criterion. If yes, set iter = iiter > 0 and return.
+        plasma_pdzamax(PlasmaColumnwise, X, workX, Xnorm, sequence, request);
+        plasma_pdzamax(PlasmaColumnwise, R, workR, Rnorm, sequence, request);
+
+        #pragma omp taskwait
+        {
+            if (conv(Rnorm, Xnorm, R.n, cte)) {
+               *iter = iiter+1;
+                return;
+            }
+        }
+    }
+
+    // If we are at this place of the code, this is because we have performed
+    // iter = itermax iterations and never satisfied the stopping criterion.
+    *iter = -itermax - 1;
+}
@@ -180,7 +180,7 @@ int plasma_zhetrf(plasma_enum_t uplo,
     for (int i = 0; i < nb; i++) ipiv[i] = 1+i;
 
     // asynchronous block
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma->max_threads)
     #pragma omp master
     {
         // Translate to tile layout.
@@ -188,7 +188,7 @@ int plasma_zhetrf(plasma_enum_t uplo,
     }
     // implicit synchronization
 
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma->max_threads)
     #pragma omp master
     {
         // Call the tile async function to compute LTL^H factor of A,
@@ -197,7 +197,7 @@ int plasma_zhetrf(plasma_enum_t uplo,
     }
     // implicit synchronization
 
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma->max_threads)
     #pragma omp master
     {
         // Translate back to LAPACK layout.
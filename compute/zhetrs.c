@@ -171,7 +171,7 @@ int plasma_zhetrs(plasma_enum_t uplo, int n, int nrhs,
     retval = plasma_request_init(&request);
 
     // asynchronous block
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma->max_threads)
     #pragma omp master
     {
         // Translate to tile layout.
@@ -180,14 +180,14 @@ int plasma_zhetrs(plasma_enum_t uplo, int n, int nrhs,
         plasma_omp_zge2desc(pB, ldb, B, &sequence, &request);
     }
 
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma->max_threads)
     #pragma omp master
     {
         // Call the tile async function.
         plasma_omp_zhetrs(uplo, A, ipiv, T, ipiv2, B, &sequence, &request);
     }
 
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma->max_threads)
     #pragma omp master
     {
         // Translate back to LAPACK layout.
@@ -154,7 +154,7 @@ int plasma_zlacpy(plasma_enum_t uplo, plasma_enum_t transa,
     retval = plasma_request_init(&request);
 
     // asynchronous block
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma->max_threads)
     #pragma omp master
     {
         // Translate to tile layout.
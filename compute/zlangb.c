@@ -180,7 +180,7 @@ double plasma_zlangb(plasma_enum_t norm,
     double value;
 
     // asynchronous block
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma->max_threads)
     #pragma omp master
     {
         // Translate to tile layout.
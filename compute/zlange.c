@@ -157,7 +157,7 @@ double plasma_zlange(plasma_enum_t norm,
     double value;
 
     // asynchronous block
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma->max_threads)
     #pragma omp master
     {
         // Translate to tile layout.
@@ -158,7 +158,7 @@ double plasma_zlanhe(plasma_enum_t norm, plasma_enum_t uplo,
     double value;
 
     // asynchronous block
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma->max_threads)
     #pragma omp master
     {
         // Translate to tile layout.
@@ -117,7 +117,7 @@ int plasma_zlauum(plasma_enum_t uplo, int n,
     retval = plasma_request_init(&request);
 
     // asynchronous block
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma->max_threads)
     #pragma omp master
     {
         // Translate to tile layout.
@@ -19,6 +19,8 @@
 #include "plasma_types.h"
 #include "plasma_workspace.h"
 
+#include <stdint.h>
+
 /***************************************************************************//**
  *
  * @ingroup plasma_posv
@@ -137,14 +139,22 @@ int plasma_zposv(plasma_enum_t uplo,
     plasma_desc_t A;
     plasma_desc_t B;
     int retval;
-    retval = plasma_desc_triangular_create(PlasmaComplexDouble, uplo, nb, nb,
-                                           n, n, 0, 0, n, n, &A);
+    if (plasma->layout == PlasmaLapackLayout)
+        retval = plasma_desc_general_lapack_init(PlasmaComplexDouble, pA, nb, nb,
+                                                 lda, n, n, 0, 0, n, n, &A);
+    else
+        retval = plasma_desc_triangular_create(PlasmaComplexDouble, uplo, nb, nb,
+                                               n, n, 0, 0, n, n, &A);
     if (retval != PlasmaSuccess) {
         plasma_error("plasma_desc_general_create() failed");
         return retval;
     }
-    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
-                                        n, nrhs, 0, 0, n, nrhs, &B);
+    if (plasma->layout == PlasmaLapackLayout)
+        retval = plasma_desc_general_lapack_init(PlasmaComplexDouble, pB, nb, nb,
+                                                 ldb, n, nrhs, 0, 0, n, nrhs, &B);
+    else
+        retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
+                                            n, nrhs, 0, 0, n, nrhs, &B);
     if (retval != PlasmaSuccess) {
         plasma_error("plasma_desc_general_create() failed");
         plasma_desc_destroy(&A);
@@ -160,7 +170,7 @@ int plasma_zposv(plasma_enum_t uplo,
     retval = plasma_request_init(&request);
 
     // asynchronous block
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma->max_threads)
     #pragma omp master
     {
         // Translate to tile layout.
@@ -185,6 +195,165 @@ int plasma_zposv(plasma_enum_t uplo,
     return status;
 }
 
+/***************************************************************************//**
+ *
+ * @ingroup plasma_posv
+ *
+ *  Returns the bytes of the caller buffer of plasma_zposv_buffer() for a
+ *  system of n equations with nrhs right hand sides, with the current
+ *  settings of the context: the tile matrices of A and B, none in
+ *  PlasmaLapackLayout, and the progress table of the static scheduler.
+ *
+ *******************************************************************************
+ *
+ * @param[in] uplo
+ *          - PlasmaUpper: Upper triangle of A is stored;
+ *          - PlasmaLower: Lower triangle of A is stored.
+ *
+ * @param[in] n
+ *          The number of linear equations. n >= 0.
+ *
+ * @param[in] nrhs
+ *          The number of right hand sides. nrhs >= 0.
+ *
+ * @param[out] size
+ *          On exit, the bytes of the caller buffer.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_zposv_buffer
+ * @sa plasma_cposv_workspace_query
+ * @sa plasma_dposv_workspace_query
+ * @sa plasma_sposv_workspace_query
+ *
+ ******************************************************************************/
+int plasma_zposv_workspace_query(plasma_enum_t uplo, int n, int nrhs,
+                                 size_t *size)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Check input arguments.
+    if ((uplo != PlasmaUpper) &&
+        (uplo != PlasmaLower)) {
+        plasma_error("illegal value of uplo");
+        return -1;
+    }
+    if (n < 0) {
+        plasma_error("illegal value of n");
+        return -2;
+    }
+    if (nrhs < 0) {
+        plasma_error("illegal value of nrhs");
+        return -3;
+    }
+    if (size == NULL) {
+        plasma_error("NULL size");
+        return -4;
+    }
+
+    *size = 0;
+    if (imin(n, nrhs) == 0)
+        return PlasmaSuccess;
+
+    // Tune parameters, as plasma_zposv() does.
+    if (plasma->tuning)
+        plasma_tune_potrf(plasma, PlasmaComplexDouble, n);
+
+    int nb = plasma->nb;
+
+    plasma_desc_t A;
+    plasma_desc_t B;
+    plasma_desc_triangular_init(PlasmaComplexDouble, uplo, NULL, nb, nb,
+                                n, n, 0, 0, n, n, &A);
+    plasma_desc_general_init(PlasmaComplexDouble, NULL, nb, nb,
+                             n, nrhs, 0, 0, n, nrhs, &B);
+    if (plasma->layout != PlasmaLapackLayout)
+        *size = plasma_pool_bytes(plasma_desc_matrix_size(A)) +
+                plasma_pool_bytes(plasma_desc_matrix_size(B));
+
+    // Progress table of the static scheduler.
+    if (plasma->runtime == PlasmaRuntimeStatic)
+        *size += plasma_pool_bytes((size_t)A.mt*A.mt*sizeof(int));
+    return PlasmaSuccess;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_posv
+ *
+ *  Solves a system of linear equations as plasma_zposv(), with the tile
+ *  matrices carved out of a caller buffer instead of allocated.
+ *
+ *******************************************************************************
+ *
+ * @param[in] uplo
+ * @param[in] n
+ * @param[in] nrhs
+ * @param[in,out] pA
+ * @param[in] lda
+ * @param[in,out] pB
+ * @param[in] ldb
+ *          See plasma_zposv().
+ *
+ * @param[in,out] buffer
+ *          The caller buffer, aligned to PLASMA_ALLOCATOR_ALIGN bytes.
+ *
+ * @param[in] size
+ *          The bytes of buffer, at least those returned by
+ *          plasma_zposv_workspace_query().
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ * @retval > 0 if i, the leading minor of order i of A is not
+ *         positive definite
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_zposv
+ * @sa plasma_zposv_workspace_query
+ *
+ ******************************************************************************/
+int plasma_zposv_buffer(plasma_enum_t uplo,
+                        int n, int nrhs,
+                        plasma_complex64_t *pA, int lda,
+                        plasma_complex64_t *pB, int ldb,
+                        void *buffer, size_t size)
+{
+    size_t lbuffer;
+    int retval = plasma_zposv_workspace_query(uplo, n, nrhs, &lbuffer);
+    if (retval != PlasmaSuccess)
+        return retval;
+
+    if (lbuffer > 0 &&
+        (buffer == NULL || (uintptr_t)buffer%PLASMA_ALLOCATOR_ALIGN != 0)) {
+        plasma_error("illegal value of buffer");
+        return -8;
+    }
+    if (size < lbuffer) {
+        plasma_error("illegal value of size");
+        return -9;
+    }
+
+    // Carve the tile matrices and the bookkeeping out of the buffer.
+    plasma_context_t *plasma = plasma_context_self();
+    plasma_pool_buffer(&plasma->pool, buffer, size);
+    retval = plasma_zposv(uplo, n, nrhs, pA, lda, pB, ldb);
+    plasma_pool_buffer(&plasma->pool, NULL, 0);
+    return retval;
+}
+
 /***************************************************************************//**
  *
  * @ingroup plasma_posv
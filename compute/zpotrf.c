@@ -111,8 +111,12 @@ int plasma_zpotrf(plasma_enum_t uplo,
     // Create tile matrix.
     plasma_desc_t A;
     int retval;
-    retval = plasma_desc_triangular_create(PlasmaComplexDouble, uplo, nb, nb,
-                                           n, n, 0, 0, n, n, &A);
+    if (plasma->layout == PlasmaLapackLayout)
+        retval = plasma_desc_general_lapack_init(PlasmaComplexDouble, pA, nb, nb,
+                                                 lda, n, n, 0, 0, n, n, &A);
+    else
+        retval = plasma_desc_triangular_create(PlasmaComplexDouble, uplo, nb, nb,
+                                               n, n, 0, 0, n, n, &A);
     if (retval != PlasmaSuccess) {
         plasma_error("plasma_desc_general_create() failed");
         return retval;
@@ -127,7 +131,7 @@ int plasma_zpotrf(plasma_enum_t uplo,
     retval = plasma_request_init(&request);
 
     // asynchronous block
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma->max_threads)
     #pragma omp master
     {
         // Translate to tile layout.
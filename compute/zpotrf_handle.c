@@ -0,0 +1,265 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+
+#include "plasma.h"
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_factor.h"
+#include "plasma_internal.h"
+#include "plasma_tuning.h"
+#include "plasma_types.h"
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_potrf
+ *
+ *  Computes the Cholesky factorization of a Hermitian positive definite
+ *  matrix A and keeps the factor in tile layout in a handle, for repeated
+ *  solves with plasma_zpotrs_handle().
+ *
+ *******************************************************************************
+ *
+ * @param[in] uplo
+ *          - PlasmaUpper: Upper triangle of A is stored;
+ *          - PlasmaLower: Lower triangle of A is stored.
+ *
+ * @param[in] n
+ *          The order of the matrix A. n >= 0.
+ *
+ * @param[in] pA
+ *          The Hermitian positive definite matrix A. It is not modified.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A. lda >= max(1,n).
+ *
+ * @param[out] F
+ *          The handle receiving the factor U or L.
+ *          Release it with plasma_factor_destroy().
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval  < 0 if -i, the i-th argument had an illegal value
+ * @retval  > 0 if i, the leading minor of order i of A is not
+ *          positive definite and the handle is left empty.
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_zpotrs_handle
+ * @sa plasma_factor_destroy
+ * @sa plasma_cpotrf_handle
+ * @sa plasma_dpotrf_handle
+ * @sa plasma_spotrf_handle
+ *
+ ******************************************************************************/
+int plasma_zpotrf_handle(plasma_enum_t uplo, int n,
+                         plasma_complex64_t *pA, int lda,
+                         plasma_factor_t *F)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Check input arguments.
+    if ((uplo != PlasmaUpper) &&
+        (uplo != PlasmaLower)) {
+        plasma_error("illegal value of uplo");
+        return -1;
+    }
+    if (n < 0) {
+        plasma_error("illegal value of n");
+        return -2;
+    }
+    if (lda < imax(1, n)) {
+        plasma_error("illegal value of lda");
+        return -4;
+    }
+    if (F == NULL) {
+        plasma_error("NULL F");
+        return -5;
+    }
+
+    // Tune parameters.
+    if (plasma->tuning)
+        plasma_tune_potrf(plasma, PlasmaComplexDouble, n);
+
+    // Set tiling parameters.
+    int nb = plasma->nb;
+
+    // Start with an empty handle.
+    F->uplo = uplo;
+    F->ipiv = NULL;
+    plasma_desc_triangular_init(PlasmaComplexDouble, uplo, NULL, nb, nb,
+                                n, n, 0, 0, n, n, &F->A);
+
+    // quick return
+    if (n == 0)
+        return PlasmaSuccess;
+
+    // Create tile matrix kept by the handle.
+    int retval;
+    retval = plasma_desc_triangular_create(PlasmaComplexDouble, uplo, nb, nb,
+                                           n, n, 0, 0, n, n, &F->A);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_triangular_create() failed");
+        F->A.matrix = NULL;
+        return retval;
+    }
+
+    // Initialize sequence.
+    plasma_sequence_t sequence;
+    retval = plasma_sequence_init(&sequence);
+
+    // Initialize request.
+    plasma_request_t request;
+    retval = plasma_request_init(&request);
+
+    // asynchronous block
+    #pragma omp parallel num_threads(plasma->max_threads)
+    #pragma omp master
+    {
+        // Translate to tile layout.
+        plasma_omp_ztr2desc(pA, lda, F->A, &sequence, &request);
+
+        // Call the tile async function.
+        plasma_omp_zpotrf(uplo, F->A, &sequence, &request);
+    }
+    // implicit synchronization
+
+    // Keep the factor only if the factorization went through.
+    if (sequence.status != PlasmaSuccess)
+        plasma_factor_destroy(F);
+
+    // Return status.
+    int status = sequence.status;
+    return status;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_potrs
+ *
+ *  Solves a system of linear equations A * X = B with the Cholesky factor
+ *  kept by plasma_zpotrf_handle().
+ *  Only the right-hand sides are translated, the factor stays in tile layout.
+ *
+ *******************************************************************************
+ *
+ * @param[in] F
+ *          The handle from plasma_zpotrf_handle() of an n-by-n matrix A.
+ *
+ * @param[in] nrhs
+ *          The number of right hand sides, i.e., the number of
+ *          columns of the matrix B. nrhs >= 0.
+ *
+ * @param[in,out] pB
+ *          On entry, the n-by-nrhs right hand side matrix B.
+ *          On exit, if return value = 0, the n-by-nrhs solution matrix X.
+ *
+ * @param[in] ldb
+ *          The leading dimension of the array B. ldb >= max(1,n).
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval  < 0 if -i, the i-th argument had an illegal value
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_zpotrf_handle
+ * @sa plasma_cpotrs_handle
+ * @sa plasma_dpotrs_handle
+ * @sa plasma_spotrs_handle
+ *
+ ******************************************************************************/
+int plasma_zpotrs_handle(plasma_factor_t *F,
+                         int nrhs, plasma_complex64_t *pB, int ldb)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Check input arguments.
+    if (F == NULL ||
+        (F->uplo != PlasmaUpper && F->uplo != PlasmaLower) ||
+        F->A.precision != PlasmaComplexDouble) {
+        plasma_error("illegal value of F");
+        return -1;
+    }
+    int n = F->A.n;
+    if (nrhs < 0) {
+        plasma_error("illegal value of nrhs");
+        return -2;
+    }
+    if (ldb < imax(1, n)) {
+        plasma_error("illegal value of ldb");
+        return -4;
+    }
+
+    // quick return
+    if (imin(n, nrhs) == 0)
+        return PlasmaSuccess;
+
+    // Use the tiling of the factor.
+    int nb = F->A.nb;
+
+    // Create tile matrix.
+    plasma_desc_t B;
+    int retval;
+    if (plasma->layout == PlasmaLapackLayout)
+        retval = plasma_desc_general_lapack_init(PlasmaComplexDouble, pB, nb, nb,
+                                                 ldb, n, nrhs, 0, 0, n, nrhs, &B);
+    else
+        retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
+                                            n, nrhs, 0, 0, n, nrhs, &B);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_create() failed");
+        return retval;
+    }
+
+    // Initialize sequence.
+    plasma_sequence_t sequence;
+    retval = plasma_sequence_init(&sequence);
+
+    // Initialize request.
+    plasma_request_t request;
+    retval = plasma_request_init(&request);
+
+    // asynchronous block
+    #pragma omp parallel num_threads(plasma->max_threads)
+    #pragma omp master
+    {
+        // Translate to tile layout.
+        plasma_omp_zge2desc(pB, ldb, B, &sequence, &request);
+
+        // Call the tile async function.
+        plasma_omp_zpotrs(F->uplo, F->A, B, &sequence, &request);
+
+        // Translate back to LAPACK layout.
+        plasma_omp_zdesc2ge(B, pB, ldb, &sequence, &request);
+    }
+    // implicit synchronization
+
+    // Free matrix B in tile layout.
+    plasma_desc_destroy(&B);
+
+    // Return status.
+    int status = sequence.status;
+    return status;
+}
@@ -63,6 +63,11 @@ void plasma_omp_ztr2desc(plasma_complex64_t *pA, int lda,
     if (A.m == 0 || A.n == 0)
         return;
 
+    // quick return if A is a LAPACK-layout view of pA
+    if (A.type == PlasmaGeneralLapack && A.ld == lda &&
+        (plasma_complex64_t*)A.matrix + A.i + (size_t)A.ld*A.j == pA)
+        return;
+
     // Call the parallel function.
     plasma_pztr2desc(pA, lda, A, sequence, request);
 }
@@ -199,7 +199,7 @@ int plasma_ztrmm(plasma_enum_t side, plasma_enum_t uplo,
     retval = plasma_request_init(&request);
 
     // asynchronous block
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma->max_threads)
     #pragma omp master
     {
         // Translate matrices to tile layout.
@@ -0,0 +1,109 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+#include "plasma_allocator.h"
+#include "plasma_context.h"
+#include "plasma_internal.h"
+
+#include <stdlib.h>
+
+#include <omp.h>
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_allocator
+ *
+ *  Sets the allocator of the context: the tile matrices, the T matrices,
+ *  the workspaces and the panel buffers of the calls then take their
+ *  memory from alloc and give it back to free, both called with data.
+ *  The memory asked for is aligned to PLASMA_ALLOCATOR_ALIGN bytes.
+ *  Both NULL restore the system allocator.
+ *
+ *  The idle memory of the pool and of the workspace arena is released
+ *  first, to the previous allocator. Must be called outside of parallel
+ *  regions, with no descriptor or workspace of the context alive.
+ *
+ *******************************************************************************
+ *
+ * @param[in] alloc
+ *          The allocation hook, or NULL.
+ *
+ * @param[in] free
+ *          The release hook, or NULL.
+ *
+ * @param[in] data
+ *          User data passed to the hooks.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ *
+ ******************************************************************************/
+int plasma_allocator_set(plasma_alloc_func_t alloc, plasma_free_func_t free,
+                         void *data)
+{
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+    if ((alloc == NULL) != (free == NULL)) {
+        plasma_error("invalid allocator");
+        return PlasmaErrorIllegalValue;
+    }
+    if (omp_in_parallel()) {
+        plasma_error("allocator set in a parallel region");
+        return PlasmaErrorEnvironment;
+    }
+    plasma_pool_shrink(&plasma->pool, 0);
+    plasma_arena_trim(&plasma->arena);
+
+    plasma->allocator.alloc = alloc;
+    plasma->allocator.free = free;
+    plasma->allocator.data = data;
+    return PlasmaSuccess;
+}
+
+/******************************************************************************/
+void plasma_allocator_init(plasma_allocator_t *allocator)
+{
+    allocator->alloc = NULL;
+    allocator->free = NULL;
+    allocator->data = NULL;
+}
+
+/***************************************************************************//**
+    Returns size bytes aligned to PLASMA_ALLOCATOR_ALIGN, or NULL if out of
+    memory. The memory is released by plasma_allocator_free().
+*/
+void *plasma_allocator_alloc(const plasma_allocator_t *allocator, size_t size)
+{
+    if (allocator->alloc != NULL)
+        return allocator->alloc(size, PLASMA_ALLOCATOR_ALIGN, allocator->data);
+
+    void *ptr;
+    if (posix_memalign(&ptr, PLASMA_ALLOCATOR_ALIGN, size) != 0)
+        return NULL;
+    return ptr;
+}
+
+/***************************************************************************//**
+    Releases the size bytes at ptr of plasma_allocator_alloc().
+*/
+void plasma_allocator_free(const plasma_allocator_t *allocator,
+                           void *ptr, size_t size)
+{
+    if (ptr == NULL)
+        return;
+
+    if (allocator->free != NULL)
+        allocator->free(ptr, size, allocator->data);
+    else
+        free(ptr);
+}
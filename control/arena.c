@@ -0,0 +1,234 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+#include "plasma_arena.h"
+#include "plasma_internal.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+// The header keeps the blocks aligned to cache lines.
+#define PLASMA_ARENA_ALIGN PLASMA_ALLOCATOR_ALIGN
+#define PLASMA_ARENA_HEADER PLASMA_ARENA_ALIGN
+
+// Header of a block.
+typedef struct {
+    size_t len;  // bytes of the block, header included
+    size_t prev; // offset of the block below in the buffer
+    int popped;  // released, reclaimed once the blocks above are
+} plasma_arena_header_t;
+
+/******************************************************************************/
+void plasma_arena_init(plasma_arena_t *arena,
+                       const plasma_allocator_t *allocator, int num_threads)
+{
+    arena->slots = NULL;
+    arena->num_slots = 0;
+    arena->allocator = allocator;
+    arena->own = NULL;
+    arena->num_own = 0;
+    arena->external = 0;
+    // Without slots, the blocks come from the allocator.
+    plasma_arena_reserve(arena, num_threads);
+}
+
+/******************************************************************************/
+void plasma_arena_finalize(plasma_arena_t *arena)
+{
+    for (int tid = 0; tid < arena->num_slots; tid++)
+        plasma_allocator_free(arena->allocator, arena->slots[tid].base,
+                              arena->slots[tid].size);
+    free(arena->slots);
+    arena->slots = NULL;
+    arena->num_slots = 0;
+}
+
+/***************************************************************************//**
+    Makes room for the buffers of num_threads threads. The slots only grow,
+    keeping their buffers. Must be called outside of parallel regions.
+*/
+int plasma_arena_reserve(plasma_arena_t *arena, int num_threads)
+{
+    if (num_threads <= arena->num_slots)
+        return PlasmaSuccess;
+
+    void *slots;
+    if (posix_memalign(&slots, PLASMA_ARENA_ALIGN,
+                       (size_t)num_threads*sizeof(plasma_arena_slot_t)) != 0)
+        return PlasmaErrorOutOfMemory;
+
+    memset(slots, 0, (size_t)num_threads*sizeof(plasma_arena_slot_t));
+    if (arena->num_slots > 0)
+        memcpy(slots, arena->slots,
+               (size_t)arena->num_slots*sizeof(plasma_arena_slot_t));
+    free(arena->slots);
+    arena->slots = (plasma_arena_slot_t*)slots;
+    arena->num_slots = num_threads;
+    return PlasmaSuccess;
+}
+
+/***************************************************************************//**
+    Releases the buffers with no block handed out. Must be called outside
+    of parallel regions.
+*/
+void plasma_arena_trim(plasma_arena_t *arena)
+{
+    for (int tid = 0; tid < arena->num_slots; tid++) {
+        plasma_arena_slot_t *slot = &arena->slots[tid];
+        if (slot->live == 0) {
+            plasma_allocator_free(arena->allocator, slot->base, slot->size);
+            slot->base = NULL;
+            slot->size = 0;
+            slot->peak = 0;
+        }
+    }
+}
+
+/***************************************************************************//**
+    Returns size bytes aligned to cache lines from the buffer of thread tid,
+    or NULL if out of memory. An idle buffer grows to the most bytes asked
+    for at once so far; a busy one too small, or a thread without a slot,
+    gets the block from the allocator until then. With a caller buffer set,
+    a block not fitting in the share of the thread is not allocated either.
+    Only thread tid, or the master thread outside of parallel regions,
+    may use the buffer.
+    The block is released by plasma_arena_pop() with the same tid.
+*/
+void *plasma_arena_push(plasma_arena_t *arena, int tid, size_t size)
+{
+    size_t len = PLASMA_ARENA_HEADER +
+                 (size+PLASMA_ARENA_ALIGN-1)/PLASMA_ARENA_ALIGN*
+                 PLASMA_ARENA_ALIGN;
+
+    char *block = NULL;
+    if (tid >= 0 && tid < arena->num_slots) {
+        plasma_arena_slot_t *slot = &arena->slots[tid];
+        if (slot->top+len > slot->size && slot->live == 0 &&
+            !arena->external) {
+            size_t peak = slot->peak > len ? slot->peak : len;
+            plasma_allocator_free(arena->allocator, slot->base, slot->size);
+            slot->base = (char*)plasma_allocator_alloc(arena->allocator, peak);
+            slot->size = slot->base != NULL ? peak : 0;
+        }
+        if (slot->top+len > slot->peak)
+            slot->peak = slot->top+len;
+        if (slot->top+len <= slot->size) {
+            block = slot->base+slot->top;
+            ((plasma_arena_header_t*)block)->prev = slot->last;
+            slot->last = slot->top;
+            slot->top += len;
+            slot->live++;
+        }
+    }
+    if (block == NULL) {
+        if (arena->external)
+            return NULL;
+        block = (char*)plasma_allocator_alloc(arena->allocator, len);
+        if (block == NULL)
+            return NULL;
+    }
+    ((plasma_arena_header_t*)block)->len = len;
+    ((plasma_arena_header_t*)block)->popped = 0;
+    return block+PLASMA_ARENA_HEADER;
+}
+
+/***************************************************************************//**
+    Releases the block ptr of plasma_arena_push(), in any order. A block
+    released below the top of its buffer is only marked; its space is
+    reclaimed with the top block, so that a task suspended while holding
+    a block, and resumed after another task on its thread pushed one, does
+    not leak the space of either.
+*/
+void plasma_arena_pop(plasma_arena_t *arena, int tid, void *ptr)
+{
+    if (ptr == NULL)
+        return;
+
+    char *block = (char*)ptr-PLASMA_ARENA_HEADER;
+    plasma_arena_header_t *header = (plasma_arena_header_t*)block;
+    if (tid >= 0 && tid < arena->num_slots) {
+        plasma_arena_slot_t *slot = &arena->slots[tid];
+        if (slot->base != NULL &&
+            block >= slot->base && block < slot->base+slot->size) {
+            header->popped = 1;
+            slot->live--;
+            // Unwind the released blocks at the top.
+            while (slot->top > 0) {
+                plasma_arena_header_t *top =
+                    (plasma_arena_header_t*)(slot->base+slot->last);
+                if (!top->popped)
+                    break;
+                slot->top = slot->last;
+                slot->last = top->prev;
+            }
+            return;
+        }
+    }
+    plasma_allocator_free(arena->allocator, block, header->len);
+}
+
+/***************************************************************************//**
+    Returns the bytes a block of size bytes takes out of the buffer
+    of a thread.
+*/
+size_t plasma_arena_bytes(size_t size)
+{
+    return PLASMA_ARENA_HEADER +
+           (size+PLASMA_ARENA_ALIGN-1)/PLASMA_ARENA_ALIGN*PLASMA_ARENA_ALIGN;
+}
+
+/***************************************************************************//**
+    Returns the bytes of a caller buffer giving size bytes to each of
+    num_threads threads.
+*/
+size_t plasma_arena_buffer_bytes(size_t size, int num_threads)
+{
+    size = (size+PLASMA_ARENA_ALIGN-1)/PLASMA_ARENA_ALIGN*PLASMA_ARENA_ALIGN;
+    return (size_t)num_threads*(sizeof(plasma_arena_slot_t)+size);
+}
+
+/***************************************************************************//**
+    Carves the slots and the buffers of num_threads threads out of the size
+    bytes of buffer, aligned to PLASMA_ALLOCATOR_ALIGN, in equal shares,
+    until called with NULL, which gives the arena its own buffers back.
+    Nothing is allocated meanwhile. Must be called outside of parallel
+    regions, with no block handed out.
+*/
+void plasma_arena_buffer(plasma_arena_t *arena, void *buffer, size_t size,
+                         int num_threads)
+{
+    if (buffer == NULL) {
+        if (arena->external) {
+            arena->slots = arena->own;
+            arena->num_slots = arena->num_own;
+            arena->own = NULL;
+            arena->num_own = 0;
+            arena->external = 0;
+        }
+        return;
+    }
+    if (!arena->external) {
+        arena->own = arena->slots;
+        arena->num_own = arena->num_slots;
+        arena->external = 1;
+    }
+    size_t lslots = (size_t)num_threads*sizeof(plasma_arena_slot_t);
+    size_t share = 0;
+    if (num_threads > 0 && size > lslots)
+        share = (size-lslots)/num_threads/PLASMA_ARENA_ALIGN*
+                PLASMA_ARENA_ALIGN;
+
+    arena->slots = (plasma_arena_slot_t*)buffer;
+    arena->num_slots = num_threads;
+    memset(arena->slots, 0, lslots);
+    for (int tid = 0; tid < num_threads; tid++) {
+        arena->slots[tid].base = (char*)buffer+lslots+tid*share;
+        arena->slots[tid].size = share;
+    }
+}
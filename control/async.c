@@ -36,5 +36,6 @@ int plasma_sequence_init(plasma_sequence_t *sequence)
 {
     sequence->status = PlasmaSuccess;
     sequence->request = NULL;
+    sequence->info = 0;
     return PlasmaSuccess;
 }
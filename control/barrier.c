@@ -10,21 +10,142 @@
 
 #include "plasma_barrier.h"
 
+#include <sched.h>
+
+// number of spins before yielding the processor
+#define PLASMA_BARRIER_SPINS 64
+
+// maximum number of pauses per spin
+#define PLASMA_BARRIER_MAX_PAUSES 64
+
+// flag of a closed team in its state
+#define PLASMA_TEAM_CLOSED (1 << 30)
+
+/******************************************************************************/
+static inline void plasma_barrier_pause()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#else
+    __asm__ __volatile__ ("" ::: "memory");
+#endif
+}
+
+/***************************************************************************//**
+    Waits until the episode of node changes, pausing with exponential backoff
+    and then yielding, so that oversubscribed ranks let the others progress.
+*/
+static void plasma_barrier_spin(plasma_barrier_node_t *node, int episode)
+{
+    int pauses = 1;
+    int spins = 0;
+    while (node->episode == episode) {
+        if (spins < PLASMA_BARRIER_SPINS) {
+            for (int i = 0; i < pauses; i++)
+                plasma_barrier_pause();
+            if (pauses < PLASMA_BARRIER_MAX_PAUSES)
+                pauses *= 2;
+            spins++;
+        }
+        else {
+            sched_yield();
+        }
+    }
+    __sync_synchronize();
+}
+
 /******************************************************************************/
 void plasma_barrier_init(plasma_barrier_t *barrier)
 {
-    barrier->count = 0;
-    barrier->passed = 0;
+    barrier->root.count = 0;
+    barrier->root.episode = 0;
+    for (int i = 0; i < PLASMA_BARRIER_MAX_GROUPS; i++) {
+        barrier->group[i].count = 0;
+        barrier->group[i].episode = 0;
+    }
+}
+
+/***************************************************************************//**
+    Waits until all the size ranks of the barrier have called it.
+    Consecutive ranks share a group, which places them on the same socket
+    when the threads are bound close to each other.
+*/
+void plasma_barrier_wait(plasma_barrier_t *barrier, int rank, int size)
+{
+    if (size <= 1)
+        return;
+
+    int group_size = (size+PLASMA_BARRIER_MAX_GROUPS-1) /
+                     PLASMA_BARRIER_MAX_GROUPS;
+    if (group_size < PLASMA_BARRIER_GROUP_SIZE)
+        group_size = PLASMA_BARRIER_GROUP_SIZE;
+    int num_groups = (size+group_size-1)/group_size;
+    int g = rank/group_size;
+    int members = g < num_groups-1 ? group_size : size-g*group_size;
+
+    plasma_barrier_node_t *node = &barrier->group[g];
+    int episode = node->episode;
+
+    // Arrive at the group, then the last one of the group at the root.
+    if (__sync_add_and_fetch(&node->count, 1) == members) {
+        node->count = 0;
+        if (__sync_add_and_fetch(&barrier->root.count, 1) == num_groups) {
+            // Release all the groups.
+            barrier->root.count = 0;
+            __sync_synchronize();
+            for (int i = 0; i < num_groups; i++)
+                barrier->group[i].episode++;
+            return;
+        }
+    }
+    plasma_barrier_spin(node, episode);
 }
 
 /******************************************************************************/
-void plasma_barrier_wait(plasma_barrier_t *barrier, int size)
+void plasma_team_init(plasma_team_t *team, int max_size, int wait)
 {
-    int passed_old = barrier->passed;
+    team->state = 0;
+    team->size = 0;
+    team->max_size = max_size;
+    team->wait = wait;
+}
 
-    __sync_fetch_and_add(&barrier->count, 1);
-    if (__sync_bool_compare_and_swap(&barrier->count, size, 0))
-        barrier->passed++;
-    else
-        while (barrier->passed == passed_old);
+/***************************************************************************//**
+    Joins the team as a helper and waits until the owner closes it.
+    Returns the rank in the team, or -1 if the team is closed or full,
+    in which case the caller has nothing to do.
+*/
+int plasma_team_join(plasma_team_t *team)
+{
+    int rank;
+    for (;;) {
+        int state = team->state;
+        if ((state & PLASMA_TEAM_CLOSED) || state+1 >= team->max_size)
+            return -1;
+        if (__sync_bool_compare_and_swap(&team->state, state, state+1)) {
+            rank = state+1;
+            break;
+        }
+    }
+    while (team->size == 0)
+        plasma_barrier_pause();
+    __sync_synchronize();
+    return rank;
+}
+
+/***************************************************************************//**
+    Closes the team, after waiting up to the pauses of the team for the
+    workers that are idle to join it, or at once if these are zero, and
+    returns its size, i.e., the owner and the helpers joined.
+*/
+int plasma_team_close(plasma_team_t *team)
+{
+    for (int i = 0; i < team->wait; i++) {
+        if (team->state+1 >= team->max_size)
+            break;
+        plasma_barrier_pause();
+    }
+    int state = __sync_fetch_and_or(&team->state, PLASMA_TEAM_CLOSED);
+    team->size = state+1;
+    return state+1;
 }
@@ -0,0 +1,221 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+#include "plasma_cache.h"
+#include "plasma_context.h"
+#include "plasma_internal.h"
+
+#include <stdlib.h>
+
+/******************************************************************************/
+static void plasma_cache_remove(plasma_cache_t *cache,
+                                plasma_cache_entry_t *entry)
+{
+    plasma_cache_entry_t **link = &cache->head;
+    while (*link != entry)
+        link = &(*link)->next;
+    *link = entry->next;
+
+    cache->size -= entry->size;
+    plasma_desc_destroy(&entry->A);
+    free(entry);
+}
+
+/***************************************************************************//**
+    @ingroup plasma_cache
+    Drops the tile-layout copies of the array ptr, or of all arrays
+    if ptr is NULL. Must be called whenever a cached array is modified.
+*/
+int plasma_cache_invalidate(const void *ptr)
+{
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+    plasma_cache_t *cache = &plasma->cache;
+    plasma_cache_entry_t *entry = cache->head;
+    while (entry != NULL) {
+        plasma_cache_entry_t *next = entry->next;
+        if (ptr == NULL || entry->ptr == ptr) {
+            // Entries in use are dropped when released.
+            if (entry->busy > 0) {
+                entry->valid = false;
+                entry->stale = true;
+            }
+            else {
+                plasma_cache_remove(cache, entry);
+            }
+        }
+        entry = next;
+    }
+    return PlasmaSuccess;
+}
+
+/******************************************************************************/
+static int plasma_cache_set_pinned(const void *ptr, bool pinned)
+{
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+    int found = 0;
+    for (plasma_cache_entry_t *entry = plasma->cache.head;
+         entry != NULL; entry = entry->next) {
+        if (entry->ptr == ptr) {
+            entry->pinned = pinned;
+            found = 1;
+        }
+    }
+    if (! found) {
+        plasma_error("array not in the cache");
+        return PlasmaErrorIllegalValue;
+    }
+    return PlasmaSuccess;
+}
+
+/***************************************************************************//**
+    @ingroup plasma_cache
+    Protects the cached copies of the array ptr from eviction.
+*/
+int plasma_cache_pin(const void *ptr)
+{
+    return plasma_cache_set_pinned(ptr, true);
+}
+
+/***************************************************************************//**
+    @ingroup plasma_cache
+    Makes the cached copies of the array ptr evictable again.
+*/
+int plasma_cache_unpin(const void *ptr)
+{
+    return plasma_cache_set_pinned(ptr, false);
+}
+
+/******************************************************************************/
+void plasma_cache_init(plasma_cache_t *cache)
+{
+    cache->head = NULL;
+    cache->size = 0;
+    cache->limit = 0;
+    cache->clock = 0;
+}
+
+/******************************************************************************/
+void plasma_cache_finalize(plasma_cache_t *cache)
+{
+    while (cache->head != NULL)
+        plasma_cache_remove(cache, cache->head);
+}
+
+/***************************************************************************//**
+    Evicts least recently used entries, which are neither pinned nor in use,
+    until the cache holds at most limit bytes.
+*/
+void plasma_cache_trim(plasma_cache_t *cache, size_t limit)
+{
+    while (cache->size > limit) {
+        plasma_cache_entry_t *lru = NULL;
+        for (plasma_cache_entry_t *entry = cache->head;
+             entry != NULL; entry = entry->next) {
+            if (! entry->pinned && entry->busy == 0 &&
+                (lru == NULL || entry->stamp < lru->stamp))
+                lru = entry;
+        }
+        if (lru == NULL)
+            return;
+
+        plasma_cache_remove(cache, lru);
+    }
+}
+
+/***************************************************************************//**
+    Returns the cache entry for an m-by-n array ptr with leading dimension lda
+    in tiles of nb-by-nb, creating an invalid one if needed.
+    Returns NULL if the cache is disabled or the copy does not fit.
+    The entry stays in use until plasma_cache_release().
+*/
+plasma_cache_entry_t *plasma_cache_acquire(plasma_cache_t *cache,
+                                           plasma_enum_t precision,
+                                           const void *ptr, int lda, int nb,
+                                           int m, int n)
+{
+    if (cache->limit == 0 || ptr == NULL)
+        return NULL;
+
+    // Look up the array.
+    for (plasma_cache_entry_t *entry = cache->head;
+         entry != NULL; entry = entry->next) {
+        if (! entry->stale && entry->ptr == ptr && entry->lda == lda &&
+            entry->A.precision == precision && entry->A.nb == nb &&
+            entry->A.m == m && entry->A.n == n) {
+            entry->stamp = ++cache->clock;
+            entry->busy++;
+            return entry;
+        }
+    }
+
+    // Make room for a new copy, as allocated in tile layout.
+    plasma_desc_t A;
+    plasma_desc_general_init(precision, NULL, nb, nb, m, n, 0, 0, m, n, &A);
+    size_t size = plasma_desc_matrix_size(A);
+    if (size > cache->limit)
+        return NULL;
+
+    plasma_cache_trim(cache, cache->limit-size);
+    if (cache->size+size > cache->limit)
+        return NULL;
+
+    plasma_cache_entry_t *entry =
+        (plasma_cache_entry_t*)calloc(1, sizeof(plasma_cache_entry_t));
+    if (entry == NULL)
+        return NULL;
+
+    int retval = plasma_desc_general_create(precision, nb, nb,
+                                            m, n, 0, 0, m, n, &entry->A);
+    if (retval != PlasmaSuccess) {
+        free(entry);
+        return NULL;
+    }
+    entry->ptr = ptr;
+    entry->lda = lda;
+    entry->size = size;
+    entry->stamp = ++cache->clock;
+    entry->valid = false;
+    entry->stale = false;
+    entry->pinned = false;
+    entry->busy = 1;
+
+    entry->next = cache->head;
+    cache->head = entry;
+    cache->size += size;
+
+    return entry;
+}
+
+/***************************************************************************//**
+    Ends the use of an entry by a call. If the call translated the array,
+    the copy is valid from now on if the call finished with status success
+    and the array was not invalidated meanwhile. An entry invalidated while
+    in use is dropped when its last call ends.
+*/
+void plasma_cache_release(plasma_cache_t *cache, plasma_cache_entry_t *entry,
+                          bool translated, int status)
+{
+    if (entry == NULL)
+        return;
+
+    entry->busy--;
+    if (translated && ! entry->stale)
+        entry->valid = (status == PlasmaSuccess);
+
+    if (entry->stale && entry->busy == 0)
+        plasma_cache_remove(cache, entry);
+}
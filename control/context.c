@@ -12,6 +12,7 @@
 #include "plasma_internal.h"
 #include "plasma_tuning.h"
 
+#include <pthread.h>
 #include <stdlib.h>
 #include <omp.h>
 
@@ -19,9 +20,26 @@
 #include <magma.h>
 #endif
 
+// maximum number of threads attached at the same time
+#define PLASMA_CONTEXTS_MAX 256
+
 static int plasma_initialized_g = 0;
 static plasma_context_t plasma_context_g;
 
+// count of plasma_init() calls, so that a context pointer left in the
+// thread-local storage of a thread across plasma_finalize() is not used
+static int plasma_generation_g = 0;
+
+// context of the calling thread, if attached, and the generation it was
+// attached in
+static __thread plasma_context_t *plasma_context_tls_g = NULL;
+static __thread int plasma_context_tls_generation_g = 0;
+
+// contexts of the attached threads, for plasma_finalize() to free those
+// of the threads that did not detach; not used to look up contexts
+static plasma_context_map_t plasma_context_map_g[PLASMA_CONTEXTS_MAX];
+static pthread_mutex_t plasma_context_map_lock_g = PTHREAD_MUTEX_INITIALIZER;
+
 /***************************************************************************//**
     @ingroup plasma_init
     Initializes PLASMA, allocating its context.
@@ -36,6 +54,7 @@ int plasma_init()
         return PlasmaErrorNotInitialized;
 
     plasma_initialized_g = 1;
+    plasma_generation_g++;
 
     plasma_context_init(&plasma_context_g);
 
@@ -63,6 +82,17 @@ int plasma_finalize()
     magma_finalize();
 #endif
 
+    // Free the contexts of threads that did not detach.
+    pthread_mutex_lock(&plasma_context_map_lock_g);
+    for (int i = 0; i < PLASMA_CONTEXTS_MAX; i++) {
+        if (plasma_context_map_g[i].context != NULL) {
+            plasma_context_finalize(plasma_context_map_g[i].context);
+            free(plasma_context_map_g[i].context);
+            plasma_context_map_g[i].context = NULL;
+        }
+    }
+    pthread_mutex_unlock(&plasma_context_map_lock_g);
+
     plasma_context_finalize(&plasma_context_g);
 
     plasma_initialized_g = 0;
@@ -72,7 +102,20 @@ int plasma_finalize()
 
 /***************************************************************************//**
     @ingroup plasma_init
-    Sets one of PLASMA's internal state variables.
+    Sets one of PLASMA's internal state variables in the context
+    of the calling thread.
+    PlasmaRuntime selects the runtime of xPOTRF(), of xGETRF() with partial
+    pivoting and of xGEQRF() with flat Householder trees, also within the
+    solvers calling them. The other routines run on OpenMP tasks whatever
+    the runtime. PlasmaReplay keeps the task graphs of these routines
+    on the native runtime, for replay on matrices of the same shape.
+    PlasmaInplaceOutplace set to PlasmaInplace translates the matrices of
+    xGETRF(), xGESV(), xGEQRF() and xGELS() to tile layout in the array of
+    the caller; the other routines copy them out of place whatever the
+    setting.
+    PlasmaTeamWait is the number of pause instructions the owner of a
+    multithreaded panel waits for idle workers to join its team, 1024 by
+    default; 0 closes the team as soon as the owner starts.
     This function must be called outside of any parallel region.
 */
 int plasma_set(plasma_enum_t param, int value)
@@ -83,41 +126,155 @@ int plasma_set(plasma_enum_t param, int value)
     if (omp_in_parallel())
         return PlasmaErrorEnvironment;
 
+    plasma_context_t *plasma = plasma_context_self();
+
     switch (param) {
     case PlasmaTuning:
         if (value != PlasmaEnabled && value != PlasmaDisabled) {
             plasma_error("invalid tuning flag");
             return PlasmaErrorIllegalValue;
         }
-        plasma_context_g.tuning = value;
+        plasma->tuning = value;
         break;
     case PlasmaNb:
         if (value <= 0) {
             plasma_error("invalid tile size");
             return PlasmaErrorIllegalValue;
         }
-        plasma_context_g.nb = value;
+        plasma->nb = value;
         break;
     case PlasmaIb:
         if (value <= 0) {
             plasma_error("invalid inner block size");
             return PlasmaErrorIllegalValue;
         }
-        plasma_context_g.ib = value;
+        plasma->ib = value;
+        break;
+    case PlasmaInplaceOutplace:
+        if (value != PlasmaInplace && value != PlasmaOutplace) {
+            plasma_error("invalid translation mode");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->inplace_outplace = value;
         break;
     case PlasmaNumPanelThreads:
         if (value <= 0) {
             plasma_error("invalid number of panel threads");
             return PlasmaErrorIllegalValue;
         }
-        plasma_context_g.max_panel_threads = value;
+        plasma->max_panel_threads = value;
+        break;
+    case PlasmaTeamWait:
+        if (value < 0) {
+            plasma_error("invalid team wait");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->team_wait = value;
         break;
     case PlasmaHouseholderMode:
         if (value != PlasmaFlatHouseholder && value != PlasmaTreeHouseholder) {
             plasma_error("invalid Householder mode");
             return PlasmaErrorIllegalValue;
         }
-        plasma_context_g.householder_mode = value;
+        plasma->householder_mode = value;
+        break;
+    case PlasmaLayout:
+        if (value != PlasmaTileLayout && value != PlasmaLapackLayout) {
+            plasma_error("invalid layout");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->layout = value;
+        break;
+    case PlasmaCacheSize:
+        if (value < 0) {
+            plasma_error("invalid cache size");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->cache.limit = (size_t)value*1024*1024;
+        plasma_cache_trim(&plasma->cache, plasma->cache.limit);
+        break;
+    case PlasmaNumThreads:
+        if (value <= 0) {
+            plasma_error("invalid number of threads");
+            return PlasmaErrorIllegalValue;
+        }
+        if (plasma_arena_reserve(&plasma->arena, value) != PlasmaSuccess) {
+            plasma_error("plasma_arena_reserve() failed");
+            return PlasmaErrorOutOfMemory;
+        }
+        plasma->max_threads = value;
+        break;
+    case PlasmaRuntime:
+        if (value != PlasmaRuntimeOpenMP && value != PlasmaRuntimeNative &&
+            value != PlasmaRuntimeStatic) {
+            plasma_error("invalid runtime");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->runtime = value;
+        break;
+    case PlasmaReplay:
+        if (value != PlasmaEnabled && value != PlasmaDisabled) {
+            plasma_error("invalid replay flag");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->replay = value;
+        if (value == PlasmaDisabled)
+            plasma_graph_destroy(&plasma->graphs);
+        break;
+    case PlasmaLookahead:
+        if (value < 0) {
+            plasma_error("invalid lookahead depth");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->lookahead = value;
+        break;
+    case PlasmaPivoting:
+        if (value != PlasmaPartialPivoting &&
+            value != PlasmaTournamentPivoting) {
+            plasma_error("invalid pivoting");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->pivoting = value;
+        break;
+    case PlasmaTrailingUpdate:
+        if (value != PlasmaColumnUpdate &&
+            value != PlasmaTileUpdate) {
+            plasma_error("invalid trailing update");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->update = value;
+        break;
+    case PlasmaGranularity:
+        if (value < 0) {
+            plasma_error("invalid granularity");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->granularity = value;
+        break;
+    case PlasmaPlacement:
+        if (value != PlasmaPlacementDefault &&
+            value != PlasmaPlacementInterleave &&
+            value != PlasmaPlacementCyclic &&
+            value != PlasmaPlacementFirstTouch) {
+            plasma_error("invalid placement");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->placement = value;
+        break;
+    case PlasmaHugePages:
+        if (value != PlasmaEnabled && value != PlasmaDisabled) {
+            plasma_error("invalid hugepages flag");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->hugepages = value;
+        break;
+    case PlasmaPoolSize:
+        if (value < 0) {
+            plasma_error("invalid pool size");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->pool.limit = (size_t)value*1024*1024;
+        plasma_pool_shrink(&plasma->pool, plasma->pool.limit);
         break;
     default:
         plasma_error("unknown parameter");
@@ -128,28 +285,73 @@ int plasma_set(plasma_enum_t param, int value)
 
 /***************************************************************************//**
     @ingroup plasma_init
-    Gets one of PLASMA's internal state variables.
+    Gets one of PLASMA's internal state variables from the context
+    of the calling thread.
 */
 int plasma_get(plasma_enum_t param, int *value)
 {
     if (! plasma_initialized_g)
         return PlasmaErrorNotInitialized;
 
+    plasma_context_t *plasma = plasma_context_self();
+
     switch (param) {
     case PlasmaTuning:
-        *value = plasma_context_g.tuning;
+        *value = plasma->tuning;
         return PlasmaSuccess;
     case PlasmaNb:
-        *value = plasma_context_g.nb;
+        *value = plasma->nb;
         return PlasmaSuccess;
     case PlasmaIb:
-        *value = plasma_context_g.ib;
+        *value = plasma->ib;
+        return PlasmaSuccess;
+    case PlasmaInplaceOutplace:
+        *value = plasma->inplace_outplace;
         return PlasmaSuccess;
     case PlasmaNumPanelThreads:
-        *value = plasma_context_g.max_panel_threads;
+        *value = plasma->max_panel_threads;
+        return PlasmaSuccess;
+    case PlasmaTeamWait:
+        *value = plasma->team_wait;
         return PlasmaSuccess;
     case PlasmaHouseholderMode:
-        *value = plasma_context_g.householder_mode;
+        *value = plasma->householder_mode;
+        return PlasmaSuccess;
+    case PlasmaLayout:
+        *value = plasma->layout;
+        return PlasmaSuccess;
+    case PlasmaCacheSize:
+        *value = (int)(plasma->cache.limit/(1024*1024));
+        return PlasmaSuccess;
+    case PlasmaNumThreads:
+        *value = plasma->max_threads;
+        return PlasmaSuccess;
+    case PlasmaRuntime:
+        *value = plasma->runtime;
+        return PlasmaSuccess;
+    case PlasmaReplay:
+        *value = plasma->replay;
+        return PlasmaSuccess;
+    case PlasmaLookahead:
+        *value = plasma->lookahead;
+        return PlasmaSuccess;
+    case PlasmaPivoting:
+        *value = plasma->pivoting;
+        return PlasmaSuccess;
+    case PlasmaTrailingUpdate:
+        *value = plasma->update;
+        return PlasmaSuccess;
+    case PlasmaGranularity:
+        *value = plasma->granularity;
+        return PlasmaSuccess;
+    case PlasmaPlacement:
+        *value = plasma->placement;
+        return PlasmaSuccess;
+    case PlasmaHugePages:
+        *value = plasma->hugepages;
+        return PlasmaSuccess;
+    case PlasmaPoolSize:
+        *value = (int)(plasma->pool.limit/(1024*1024));
         return PlasmaSuccess;
     default:
         plasma_error("Unknown parameter");
@@ -174,7 +376,26 @@ void plasma_context_init(plasma_context_t *context)
     context->inplace_outplace = PlasmaOutplace;
     context->max_threads = omp_get_max_threads();
     context->max_panel_threads = 1;
+    context->team_wait = 1024;
     context->householder_mode = PlasmaFlatHouseholder;
+    context->layout = PlasmaTileLayout;
+    plasma_cache_init(&context->cache);
+    plasma_allocator_init(&context->allocator);
+    plasma_pool_init(&context->pool, &context->allocator);
+    plasma_arena_init(&context->arena, &context->allocator,
+                      context->max_threads);
+    context->runtime = PlasmaRuntimeOpenMP;
+    context->replay = PlasmaDisabled;
+    context->graphs = NULL;
+    context->lookahead = 1;
+    context->pivoting = PlasmaPartialPivoting;
+    context->update = PlasmaColumnUpdate;
+    context->granularity = 0;
+    context->placement = PlasmaPlacementDefault;
+    context->hugepages = PlasmaDisabled;
+    context->ss_progress = NULL;
+    context->ss_ld = 0;
+    context->ss_abort = 0;
 
     plasma_tuning_init(context);
 }
@@ -185,18 +406,120 @@ void plasma_context_init(plasma_context_t *context)
 */
 void plasma_context_finalize(plasma_context_t *context)
 {
+    plasma_cache_finalize(&context->cache);
+    plasma_pool_finalize(&context->pool);
+    plasma_arena_finalize(&context->arena);
+    plasma_graph_destroy(&context->graphs);
     plasma_tuning_finalize(context);
 }
 
+/******************************************************************************/
+static plasma_context_t *plasma_context_attached()
+{
+    if (plasma_context_tls_generation_g != plasma_generation_g)
+        return NULL;
+    return plasma_context_tls_g;
+}
+
+/***************************************************************************//**
+    @ingroup plasma_init
+    Gives the calling thread its own execution context, with default settings,
+    tuning state, barrier and static scheduler progress table, so that
+    independent threads can call PLASMA concurrently.
+    Must be called after plasma_init() and outside of any parallel region.
+*/
+int plasma_context_attach()
+{
+    if (! plasma_initialized_g)
+        return PlasmaErrorNotInitialized;
+
+    if (omp_in_parallel())
+        return PlasmaErrorEnvironment;
+
+    if (plasma_context_attached() != NULL) {
+        plasma_error("thread already attached");
+        return PlasmaErrorIllegalValue;
+    }
+    plasma_context_t *context =
+        (plasma_context_t*)malloc(sizeof(plasma_context_t));
+    if (context == NULL) {
+        plasma_error("malloc() failed");
+        return PlasmaErrorOutOfMemory;
+    }
+    plasma_context_init(context);
+
+    int slot = -1;
+    pthread_mutex_lock(&plasma_context_map_lock_g);
+    for (int i = 0; i < PLASMA_CONTEXTS_MAX; i++) {
+        if (plasma_context_map_g[i].context == NULL) {
+            slot = i;
+            plasma_context_map_g[slot].thread_id = pthread_self();
+            plasma_context_map_g[slot].context = context;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&plasma_context_map_lock_g);
+
+    if (slot < 0) {
+        plasma_context_finalize(context);
+        free(context);
+        plasma_error("too many attached threads");
+        return PlasmaErrorOutOfMemory;
+    }
+    plasma_context_tls_g = context;
+    plasma_context_tls_generation_g = plasma_generation_g;
+
+    return PlasmaSuccess;
+}
+
 /***************************************************************************//**
     @ingroup plasma_init
-    Returns PLASMA's default execution context or NULL if PLASMA was not
-    initialized.
+    Frees the execution context of the calling thread, which falls back
+    to PLASMA's default context.
+    Must be called outside of any parallel region.
+*/
+int plasma_context_detach()
+{
+    if (! plasma_initialized_g)
+        return PlasmaErrorNotInitialized;
+
+    if (omp_in_parallel())
+        return PlasmaErrorEnvironment;
+
+    plasma_context_t *context = plasma_context_attached();
+    if (context == NULL) {
+        plasma_error("thread not attached");
+        return PlasmaErrorIllegalValue;
+    }
+    pthread_mutex_lock(&plasma_context_map_lock_g);
+    for (int i = 0; i < PLASMA_CONTEXTS_MAX; i++) {
+        if (plasma_context_map_g[i].context == context) {
+            plasma_context_map_g[i].context = NULL;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&plasma_context_map_lock_g);
+    plasma_context_tls_g = NULL;
+
+    plasma_context_finalize(context);
+    free(context);
+
+    return PlasmaSuccess;
+}
+
+/***************************************************************************//**
+    @ingroup plasma_init
+    Returns the execution context of the calling thread, PLASMA's default
+    context if the thread is not attached, or NULL if PLASMA was not
+    initialized. The lookup takes no lock. The worker threads of a parallel
+    region are not attached, so the routines running on them get the
+    context of the caller passed in instead.
 */
 plasma_context_t *plasma_context_self()
 {
-    if (plasma_initialized_g)
-        return &plasma_context_g;
-    else
+    if (! plasma_initialized_g)
         return NULL;
+
+    plasma_context_t *context = plasma_context_attached();
+    return context != NULL ? context : &plasma_context_g;
 }
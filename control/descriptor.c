@@ -11,6 +11,50 @@
 #include "plasma_context.h"
 #include "plasma_descriptor.h"
 #include "plasma_internal.h"
+#include "plasma_numa.h"
+
+/***************************************************************************//**
+ *  Returns the bytes of the matrix of A in tile layout, zero in LAPACK
+ *  layout, where it belongs to the caller.
+ ******************************************************************************/
+size_t plasma_desc_matrix_size(plasma_desc_t A)
+{
+    if (A.type == PlasmaGeneral || A.type == PlasmaGeneralBand) {
+        return (size_t)A.gm*A.gn*plasma_element_size(A.precision);
+    }
+    else if (A.type == PlasmaUpper || A.type == PlasmaLower) {
+        int lm1 = A.gm/A.mb;
+        int ln1 = A.gn/A.nb;
+        int mnt = (ln1*(1+lm1))/2;
+        return (size_t)(mnt*A.mb*A.nb + (A.gm * (A.gn%A.nb)))*
+               plasma_element_size(A.precision);
+    }
+    return 0;
+}
+
+/***************************************************************************//**
+ *  Allocates size bytes for the matrix of A, placed on the NUMA nodes
+ *  and backed with hugepages as set by PlasmaPlacement and PlasmaHugePages,
+ *  or else from the pool of the context, which carves it out of the
+ *  caller buffer of a plasma_*_buffer() call.
+ ******************************************************************************/
+static int plasma_desc_alloc(plasma_context_t *plasma, plasma_desc_t *A,
+                             size_t size)
+{
+    if (size > 0 && plasma->pool.buffer == NULL &&
+        (plasma->placement != PlasmaPlacementDefault ||
+         plasma->hugepages == PlasmaEnabled)) {
+        return plasma_numa_alloc(A, size,
+                                 plasma->placement, plasma->hugepages,
+                                 plasma->max_threads);
+    }
+    A->matrix = plasma_pool_alloc(&plasma->pool, size);
+    if (A->matrix == NULL) {
+        plasma_error("plasma_pool_alloc() failed");
+        return PlasmaErrorOutOfMemory;
+    }
+    return PlasmaSuccess;
+}
 
 /******************************************************************************/
 int plasma_desc_general_create(plasma_enum_t precision, int mb, int nb,
@@ -36,14 +80,7 @@ int plasma_desc_general_create(plasma_enum_t precision, int mb, int nb,
         return PlasmaErrorIllegalValue;
     }
     // Allocate the matrix.
-    size_t size = (size_t)A->gm*A->gn*
-                  plasma_element_size(A->precision);
-    A->matrix = malloc(size);
-    if (A->matrix == NULL) {
-        plasma_error("malloc() failed");
-        return PlasmaErrorOutOfMemory;
-    }
-    return PlasmaSuccess;
+    return plasma_desc_alloc(plasma, A, plasma_desc_matrix_size(*A));
 }
 
 /******************************************************************************/
@@ -71,14 +108,7 @@ int plasma_desc_general_band_create(plasma_enum_t precision, plasma_enum_t uplo,
         return PlasmaErrorIllegalValue;
     }
     // Allocate the matrix.
-    size_t size = (size_t)A->gm*A->gn*
-                  plasma_element_size(A->precision);
-    A->matrix = malloc(size);
-    if (A->matrix == NULL) {
-        plasma_error("malloc() failed");
-        return PlasmaErrorOutOfMemory;
-    }
-    return PlasmaSuccess;
+    return plasma_desc_alloc(plasma, A, plasma_desc_matrix_size(*A));
 }
 
 /******************************************************************************/
@@ -105,17 +135,7 @@ int plasma_desc_triangular_create(plasma_enum_t precision, plasma_enum_t uplo, i
         return PlasmaErrorIllegalValue;
     }
     // Allocate the matrix.
-    int lm1 = lm/mb;
-    int ln1 = ln/nb;
-    int mnt = (ln1*(1+lm1))/2;
-    size_t size = (size_t)(mnt*mb*nb + (lm * (ln%nb)))*
-                  plasma_element_size(A->precision);
-    A->matrix = malloc(size);
-    if (A->matrix == NULL) {
-        plasma_error("malloc() failed");
-        return PlasmaErrorOutOfMemory;
-    }
-    return PlasmaSuccess;
+    return plasma_desc_alloc(plasma, A, plasma_desc_matrix_size(*A));
 }
 
 /******************************************************************************/
@@ -126,7 +146,15 @@ int plasma_desc_destroy(plasma_desc_t *A)
         plasma_error("PLASMA not initialized");
         return PlasmaErrorNotInitialized;
     }
-    free(A->matrix);
+    // A matrix in LAPACK layout, or translated in place, is owned by
+    // the caller.
+    if (A->type != PlasmaGeneralLapack && ! A->inplace) {
+        if (A->mapped > 0)
+            plasma_numa_free(A);
+        else
+            plasma_pool_free(&plasma->pool, A->matrix);
+    }
+
     return PlasmaSuccess;
 }
 
@@ -141,6 +169,8 @@ int plasma_desc_general_init(plasma_enum_t precision, void *matrix,
 
     // pointer and offsets
     A->matrix = matrix;
+    A->mapped = 0;
+    A->inplace = 0;
     A->A21 = (size_t)(lm - lm%mb) * (ln - ln%nb);
     A->A12 = (size_t)(     lm%mb) * (ln - ln%nb) + A->A21;
     A->A22 = (size_t)(lm - lm%mb) * (     ln%nb) + A->A12;
@@ -230,6 +260,8 @@ int plasma_desc_triangular_init(plasma_enum_t precision, plasma_enum_t uplo, voi
     int ln1 = ln/nb;
     int mnt = (ln1*(1+lm1))/2;
     A->matrix = matrix;
+    A->mapped = 0;
+    A->inplace = 0;
     A->A21 = (size_t)(mb * nb) * mnt; // only for PlasmaLower
     A->A12 = (size_t)(mb * nb) * mnt; // only for PlasmaUpper
     A->A22 = (size_t)(lm - lm%mb) * (ln%nb) + A->A12;
@@ -263,6 +295,73 @@ int plasma_desc_triangular_init(plasma_enum_t precision, plasma_enum_t uplo, voi
     return PlasmaSuccess;
 }
 
+/***************************************************************************//**
+ *
+ *  Initializes a descriptor of a general matrix that stays in the user's
+ *  column-major array with leading dimension ld.  No memory is allocated
+ *  and the tiles are strided blocks of the array, so computing on such
+ *  a descriptor works in place, without translation to tile layout.
+ *
+ */
+int plasma_desc_general_lapack_init(plasma_enum_t precision, void *matrix,
+                                    int mb, int nb, int ld, int lm, int ln,
+                                    int i, int j, int m, int n,
+                                    plasma_desc_t *A)
+{
+    // Init parameters for a general matrix.
+    int retval = plasma_desc_general_init(precision, matrix, mb, nb,
+                                          lm, ln, i, j, m, n, A);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_init() failed");
+        return retval;
+    }
+    // Change matrix type to LAPACK layout.
+    A->type = PlasmaGeneralLapack;
+    A->ld = ld;
+
+    // Check the descriptor.
+    retval = plasma_desc_check(*A);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_check() failed");
+        return PlasmaErrorIllegalValue;
+    }
+    return PlasmaSuccess;
+}
+
+/***************************************************************************//**
+ *
+ *  Initializes a descriptor of a general matrix in tile layout in the
+ *  user's column-major array with leading dimension ld, by which
+ *  plasma_omp_zge2desc() and plasma_omp_zdesc2ge() translate the array
+ *  in place instead of copying it. The tile layout covers the ld-by-ln
+ *  array, the rows below lm included, so that these come back unchanged.
+ *  No memory is allocated.
+ *
+ */
+int plasma_desc_general_inplace_init(plasma_enum_t precision, void *matrix,
+                                     int mb, int nb, int ld, int ln,
+                                     int i, int j, int m, int n,
+                                     plasma_desc_t *A)
+{
+    // Init parameters for a general matrix.
+    int retval = plasma_desc_general_init(precision, matrix, mb, nb,
+                                          ld, ln, i, j, m, n, A);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_init() failed");
+        return retval;
+    }
+    // The matrix is the user's array.
+    A->inplace = 1;
+
+    // Check the descriptor.
+    retval = plasma_desc_check(*A);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_check() failed");
+        return PlasmaErrorIllegalValue;
+    }
+    return PlasmaSuccess;
+}
+
 /******************************************************************************/
 int plasma_desc_check(plasma_desc_t A)
 {
@@ -274,6 +373,9 @@ int plasma_desc_check(plasma_desc_t A)
     else if (A.type == PlasmaGeneralBand) {
         return plasma_desc_general_band_check(A);
     }
+    else if (A.type == PlasmaGeneralLapack) {
+        return plasma_desc_general_lapack_check(A);
+    }
     else {
         plasma_error("invalid matrix type");
         return PlasmaErrorIllegalValue;
@@ -370,6 +472,24 @@ int plasma_desc_general_band_check(plasma_desc_t A)
     return PlasmaSuccess;
 }
 
+/******************************************************************************/
+int plasma_desc_general_lapack_check(plasma_desc_t A)
+{
+    int retval = plasma_desc_general_check(A);
+    if (retval != PlasmaSuccess)
+        return retval;
+
+    if (A.ld < imax(1, A.gm)) {
+        plasma_error("leading dimension smaller than the number of rows");
+        return PlasmaErrorIllegalValue;
+    }
+    if (A.matrix == NULL && A.gm > 0 && A.gn > 0) {
+        plasma_error("NULL matrix in LAPACK layout");
+        return PlasmaErrorNullParameter;
+    }
+    return PlasmaSuccess;
+}
+
 /******************************************************************************/
 plasma_desc_t plasma_desc_view(plasma_desc_t A, int i, int j, int m, int n)
 {
@@ -397,8 +517,8 @@ plasma_desc_t plasma_desc_view(plasma_desc_t A, int i, int j, int m, int n)
 }
 
 /******************************************************************************/
-int plasma_descT_create(plasma_desc_t A, int ib, plasma_enum_t householder_mode,
-                        plasma_desc_t *T)
+int plasma_descT_init(plasma_desc_t A, int ib, plasma_enum_t householder_mode,
+                      plasma_desc_t *T)
 {
     // T uses tiles ib x nb, typically, ib < nb, and these tiles are
     // rectangular. This dimension is the same for QR and LQ factorizations.
@@ -417,8 +537,21 @@ int plasma_descT_create(plasma_desc_t A, int ib, plasma_enum_t householder_mode,
     int m = mt*mb;
     int n = nt*nb;
 
+    // Initialize the descriptor using the standard function.
+    return plasma_desc_general_init(A.precision, NULL, mb, nb, m, n,
+                                    0, 0, m, n, T);
+}
+
+/******************************************************************************/
+int plasma_descT_create(plasma_desc_t A, int ib, plasma_enum_t householder_mode,
+                        plasma_desc_t *T)
+{
+    plasma_desc_t T0;
+    plasma_descT_init(A, ib, householder_mode, &T0);
+
     // Create the descriptor using the standard function.
-    int retval = plasma_desc_general_create(A.precision, mb, nb, m, n,
-                                            0, 0, m, n, T);
+    int retval = plasma_desc_general_create(A.precision, T0.mb, T0.nb,
+                                            T0.gm, T0.gn,
+                                            0, 0, T0.gm, T0.gn, T);
     return retval;
 }
@@ -0,0 +1,39 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+#include "plasma_factor.h"
+#include "plasma_context.h"
+#include "plasma_internal.h"
+
+#include <stdlib.h>
+
+/***************************************************************************//**
+    @ingroup plasma_factor
+    Releases the factors kept by a factorization handle.
+    The handle is left empty and may be destroyed again.
+*/
+int plasma_factor_destroy(plasma_factor_t *F)
+{
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+    if (F == NULL) {
+        plasma_error("NULL handle");
+        return PlasmaErrorNullParameter;
+    }
+    plasma_desc_destroy(&F->A);
+    F->A.matrix = NULL;
+
+    free(F->ipiv);
+    F->ipiv = NULL;
+
+    return PlasmaSuccess;
+}
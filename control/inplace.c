@@ -0,0 +1,299 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+#include "plasma_inplace.h"
+#include "plasma_context.h"
+#include "plasma_internal.h"
+#include "plasma_pool.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include <omp.h>
+
+// bytes moved at a time through the stack
+#define PLASMA_INPLACE_PIECE 4096
+
+/***************************************************************************//**
+    Swaps the size bytes at a with the size bytes at b, not overlapping.
+*/
+static void plasma_inplace_swap(char *a, char *b, size_t size)
+{
+    char buf[PLASMA_INPLACE_PIECE];
+    for (size_t o = 0; o < size; o += PLASMA_INPLACE_PIECE) {
+        size_t len = size-o < PLASMA_INPLACE_PIECE ? size-o
+                                                   : PLASMA_INPLACE_PIECE;
+        memcpy(buf, a+o, len);
+        memcpy(a+o, b+o, len);
+        memcpy(b+o, buf, len);
+    }
+}
+
+/***************************************************************************//**
+    Rotates the x bytes at a and the y bytes following them, [X Y] to [Y X].
+    A side fitting the stack goes around the other, moved at once;
+    otherwise the shorter side is swapped into place until one does.
+*/
+static void plasma_inplace_rotate(char *a, size_t x, size_t y)
+{
+    char buf[PLASMA_INPLACE_PIECE];
+    while (x > 0 && y > 0) {
+        if (x <= PLASMA_INPLACE_PIECE) {
+            memcpy(buf, a, x);
+            memmove(a, a+x, y);
+            memcpy(a+y, buf, x);
+            return;
+        }
+        if (y <= PLASMA_INPLACE_PIECE) {
+            memcpy(buf, a+x, y);
+            memmove(a+y, a, x);
+            memcpy(a, buf, y);
+            return;
+        }
+        if (x <= y) {
+            // [X Y1 Y2] to [Y1 X Y2] with x bytes of Y1, then rotate [X Y2].
+            plasma_inplace_swap(a, a+x, x);
+            a += x;
+            y -= x;
+        }
+        else {
+            // [X1 X2 Y] to [X1 Y X2] with y bytes of X2, then rotate [X1 Y].
+            plasma_inplace_swap(a+x-y, a+x, y);
+            x -= y;
+        }
+    }
+}
+
+/***************************************************************************//**
+    Transposes the rows-by-cols column-major matrix of units of size bytes
+    at a into the cols-by-rows one. Unit k of the result is unit k*rows
+    mod rows*cols-1 of the matrix; each cycle of that permutation is moved
+    from its smallest unit, a stack piece of the units at a time. The units
+    moved are marked in the bitset visited, of rows*cols bits cleared, or
+    without it, the smallest unit of a cycle is found by walking the cycle.
+*/
+static void plasma_inplace_transpose(char *a, size_t rows, size_t cols,
+                                     size_t size, uint64_t *visited)
+{
+    if (rows <= 1 || cols <= 1)
+        return;
+
+    char buf[PLASMA_INPLACE_PIECE];
+    size_t last = rows*cols-1;
+    for (size_t s = 1; s < last; s++) {
+        if (visited != NULL) {
+            if (visited[s/64] & (uint64_t)1 << s%64)
+                continue;
+        }
+        else {
+            size_t k = s*rows%last;
+            while (k > s)
+                k = k*rows%last;
+            if (k < s)
+                continue;
+        }
+        if (s*rows%last == s)
+            continue;
+
+        for (size_t o = 0; o < size; o += PLASMA_INPLACE_PIECE) {
+            size_t len = size-o < PLASMA_INPLACE_PIECE ? size-o
+                                                       : PLASMA_INPLACE_PIECE;
+            memcpy(buf, a+s*size+o, len);
+            size_t p = s;
+            for (size_t q = s*rows%last; q != s; q = q*rows%last) {
+                memcpy(a+p*size+o, a+q*size+o, len);
+                p = q;
+            }
+            memcpy(a+p*size+o, buf, len);
+        }
+        if (visited != NULL) {
+            for (size_t q = s*rows%last; q != s; q = q*rows%last)
+                visited[q/64] |= (uint64_t)1 << q%64;
+        }
+    }
+}
+
+/***************************************************************************//**
+    Returns the bytes of the bitset of plasma_inplace_transpose() for
+    a matrix of units units.
+*/
+static size_t plasma_inplace_visited_bytes(size_t units)
+{
+    return (units+63)/64*sizeof(uint64_t);
+}
+
+/***************************************************************************//**
+    Transposes as plasma_inplace_transpose(), with the bitset from the
+    memory pool of the context, if there is room for it.
+*/
+static void plasma_inplace_transpose_pool(char *a, size_t rows, size_t cols,
+                                          size_t size,
+                                          plasma_context_t *plasma)
+{
+    if (rows <= 1 || cols <= 1)
+        return;
+
+    size_t lvisited = plasma_inplace_visited_bytes(rows*cols);
+    uint64_t *visited =
+        (uint64_t*)plasma_pool_alloc(&plasma->pool, lvisited);
+    if (visited != NULL)
+        memset(visited, 0, lvisited);
+    plasma_inplace_transpose(a, rows, cols, size, visited);
+    plasma_pool_free(&plasma->pool, visited);
+}
+
+/***************************************************************************//**
+    Moves the g bytes after each of the p blocks of f bytes at a to the end,
+    [F0 G0 F1 G1 ...] to [F0 F1 ... G0 G1 ...], through strip of q*g bytes
+    for up to q blocks at once, and by rotations of halves beyond.
+*/
+static void plasma_inplace_unshuffle(char *a, size_t p, size_t f, size_t g,
+                                     char *strip, size_t q)
+{
+    if (p <= q) {
+        for (size_t j = 0; j < p; j++)
+            memcpy(strip+j*g, a+j*(f+g)+f, g);
+        for (size_t j = 1; j < p; j++)
+            memmove(a+j*f, a+j*(f+g), f);
+        memcpy(a+p*f, strip, p*g);
+    }
+    else if (p > 1) {
+        size_t h = p/2;
+        plasma_inplace_unshuffle(a, h, f, g, strip, q);
+        plasma_inplace_unshuffle(a+h*(f+g), p-h, f, g, strip, q);
+        plasma_inplace_rotate(a+h*f, h*g, (p-h)*f);
+    }
+}
+
+/***************************************************************************//**
+    Reverses plasma_inplace_unshuffle().
+*/
+static void plasma_inplace_shuffle(char *a, size_t p, size_t f, size_t g,
+                                   char *strip, size_t q)
+{
+    if (p <= q) {
+        memcpy(strip, a+p*f, p*g);
+        for (size_t j = p-1; j > 0; j--)
+            memmove(a+j*(f+g), a+j*f, f);
+        for (size_t j = 0; j < p; j++)
+            memcpy(a+j*(f+g)+f, strip+j*g, g);
+    }
+    else if (p > 1) {
+        size_t h = p/2;
+        plasma_inplace_rotate(a+h*f, (p-h)*f, h*g);
+        plasma_inplace_shuffle(a, h, f, g, strip, q);
+        plasma_inplace_shuffle(a+h*(f+g), p-h, f, g, strip, q);
+    }
+}
+
+/***************************************************************************//**
+    Translates the matrix of A from column-major, with leading dimension
+    A.gm, to tile layout in the same memory. The rows below the full tile
+    rows, A21 and A22, first go to the end of the matrix, A.nb columns at
+    a time through a strip from the memory pool of the context, and by
+    rotations of the groups of columns, or all by rotations without the
+    strip; A21 is then rotated ahead of A12. The tile columns of A11 and
+    A12 are then transposed, as matrices of tile-high column pieces, by a
+    task each, with a bitset of the pieces moved from the pool.
+    The pool carves these out of the caller buffer of the _buffer()
+    routines. Never fails, so that plasma_inplace_desc2ge() always restores
+    the array.
+*/
+void plasma_inplace_ge2desc(plasma_desc_t A, plasma_context_t *plasma)
+{
+    char *a = (char*)A.matrix;
+    size_t eltsize = plasma_element_size(A.precision);
+    size_t mb = A.mb;
+    size_t nb = A.nb;
+    size_t lm1 = A.gm/A.mb;
+    size_t ln1 = A.gn/A.nb;
+    size_t m1 = lm1*mb;
+    size_t n1 = ln1*nb;
+    size_t m2 = A.gm%A.mb;
+    size_t n2 = A.gn%A.nb;
+
+    if (m2 > 0 && lm1 > 0) {
+        size_t q = imin(A.gn, A.nb);
+        char *strip = (char*)plasma_pool_alloc(&plasma->pool, m2*q*eltsize);
+        plasma_inplace_unshuffle(a, A.gn, m1*eltsize, m2*eltsize, strip,
+                                 strip != NULL ? q : 0);
+        plasma_pool_free(&plasma->pool, strip);
+
+        plasma_inplace_rotate(a+m1*n1*eltsize, m1*n2*eltsize, m2*n1*eltsize);
+    }
+    for (size_t n = 0; n < ln1; n++) {
+        #pragma omp task
+        plasma_inplace_transpose_pool(a+m1*nb*n*eltsize, lm1, nb,
+                                      mb*eltsize, plasma);
+    }
+    if (n2 > 0) {
+        #pragma omp task
+        plasma_inplace_transpose_pool(a+A.A12*eltsize, lm1, n2,
+                                      mb*eltsize, plasma);
+    }
+    #pragma omp taskwait
+}
+
+/***************************************************************************//**
+    Translates the matrix of A back from tile layout to column-major,
+    in the same memory, once all the tasks of the caller are done.
+    Reverses plasma_inplace_ge2desc().
+*/
+void plasma_inplace_desc2ge(plasma_desc_t A, plasma_context_t *plasma)
+{
+    char *a = (char*)A.matrix;
+    size_t eltsize = plasma_element_size(A.precision);
+    size_t mb = A.mb;
+    size_t nb = A.nb;
+    size_t lm1 = A.gm/A.mb;
+    size_t ln1 = A.gn/A.nb;
+    size_t m1 = lm1*mb;
+    size_t n1 = ln1*nb;
+    size_t m2 = A.gm%A.mb;
+    size_t n2 = A.gn%A.nb;
+
+    #pragma omp taskwait
+    for (size_t n = 0; n < ln1; n++) {
+        #pragma omp task
+        plasma_inplace_transpose_pool(a+m1*nb*n*eltsize, nb, lm1,
+                                      mb*eltsize, plasma);
+    }
+    if (n2 > 0) {
+        #pragma omp task
+        plasma_inplace_transpose_pool(a+A.A12*eltsize, n2, lm1,
+                                      mb*eltsize, plasma);
+    }
+    #pragma omp taskwait
+
+    if (m2 > 0 && lm1 > 0) {
+        plasma_inplace_rotate(a+m1*n1*eltsize, m2*n1*eltsize, m1*n2*eltsize);
+
+        size_t q = imin(A.gn, A.nb);
+        char *strip = (char*)plasma_pool_alloc(&plasma->pool, m2*q*eltsize);
+        plasma_inplace_shuffle(a, A.gn, m1*eltsize, m2*eltsize, strip,
+                                 strip != NULL ? q : 0);
+        plasma_pool_free(&plasma->pool, strip);
+    }
+}
+
+/***************************************************************************//**
+    Returns the bytes a translation of A, either way, takes from the memory
+    pool: the strip and the bitsets of the transposes, which grow with the
+    leading dimension A.gm. A transpose without room for its bitset walks
+    the cycles of its permutation instead.
+*/
+size_t plasma_inplace_bytes(plasma_desc_t A)
+{
+    // The rows below the full tile rows are fewer than mb.
+    size_t eltsize = plasma_element_size(A.precision);
+    size_t lstrip = (size_t)(A.mb-1)*imin(A.gn, A.nb)*eltsize;
+    size_t units = (size_t)(A.gm/A.mb)*A.nb;
+    return plasma_pool_bytes(lstrip) +
+           A.nt*plasma_pool_bytes(plasma_inplace_visited_bytes(units));
+}
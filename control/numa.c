@@ -0,0 +1,205 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+#include "plasma_numa.h"
+#include "plasma_internal.h"
+
+#include <stdint.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <omp.h>
+
+#if defined(PLASMA_USE_NUMA)
+#include <numa.h>
+#endif
+
+// size of the transparent and explicit hugepages
+#define PLASMA_HUGEPAGE_SIZE (2*1024*1024)
+
+/******************************************************************************/
+static int plasma_numa_nodes(void)
+{
+    static int nodes = 0;
+    if (nodes == 0) {
+        int num = 1;
+#if defined(PLASMA_USE_NUMA)
+        if (numa_available() >= 0)
+            num = imax(1, numa_num_configured_nodes());
+#endif
+        nodes = num;
+    }
+    return nodes;
+}
+
+/***************************************************************************//**
+ *  Returns the p-by-q grid of the nodes, as square as their number allows.
+ ******************************************************************************/
+static void plasma_numa_grid(int nodes, int *p, int *q)
+{
+    int r = 1;
+    for (int d = 1; d*d <= nodes; d++)
+        if (nodes%d == 0)
+            r = d;
+    *p = r;
+    *q = nodes/r;
+}
+
+/***************************************************************************//**
+ *  Returns the home node of tile (m, n) of A with PlasmaPlacementCyclic,
+ *  distributing the tiles 2D block-cyclically over the grid of the nodes.
+ ******************************************************************************/
+int plasma_numa_node(plasma_desc_t A, int m, int n)
+{
+    int p, q;
+    plasma_numa_grid(plasma_numa_nodes(), &p, &q);
+    int mm = m + A.i/A.mb;
+    int nn = n + A.j/A.nb;
+    return (mm%p)*q + nn%q;
+}
+
+/***************************************************************************//**
+ *  Returns the number of blocks the matrix of A is placed by: the tiles
+ *  of a general (band) matrix, chunks of a hugepage of the others.
+ ******************************************************************************/
+static int plasma_numa_blocks(plasma_desc_t A)
+{
+    if (A.type == PlasmaGeneral || A.type == PlasmaGeneralBand)
+        return A.gmt*A.gnt;
+    else
+        return (int)((A.mapped+PLASMA_HUGEPAGE_SIZE-1)/PLASMA_HUGEPAGE_SIZE);
+}
+
+/***************************************************************************//**
+ *  Returns the start ptr, the length len and the home node of block b.
+ ******************************************************************************/
+static void plasma_numa_block(plasma_desc_t A, int b,
+                              char **ptr, size_t *len, int *node)
+{
+    if (A.type == PlasmaGeneral || A.type == PlasmaGeneralBand) {
+        plasma_desc_t G = A;
+        G.i = 0;
+        G.j = 0;
+        int m = b%A.gmt;
+        int n = b/A.gmt;
+        *ptr = (char*)plasma_tile_addr_general(G, m, n);
+        *len = (size_t)plasma_tile_mmain(G, m)*plasma_tile_nmain(G, n)*
+               plasma_element_size(A.precision);
+        *node = plasma_numa_node(G, m, n);
+    }
+    else {
+        size_t offset = (size_t)b*PLASMA_HUGEPAGE_SIZE;
+        *ptr = (char*)A.matrix + offset;
+        *len = A.mapped-offset < PLASMA_HUGEPAGE_SIZE ?
+               A.mapped-offset : PLASMA_HUGEPAGE_SIZE;
+        *node = b%plasma_numa_nodes();
+    }
+}
+
+/***************************************************************************//**
+ *
+ *  Maps size bytes for the matrix of A, backed with hugepages if enabled,
+ *  and places its pages on the NUMA nodes following placement:
+ *
+ *  - PlasmaPlacementInterleave: page by page over all the nodes,
+ *  - PlasmaPlacementCyclic: tile by tile, 2D block-cyclically over a grid
+ *    of the nodes (see plasma_numa_node()),
+ *  - PlasmaPlacementFirstTouch: tile by tile, each first touched by one
+ *    of num_threads threads, cyclically, so that the tiles land on the
+ *    nodes of the threads when these are bound (OMP_PROC_BIND),
+ *  - PlasmaPlacementDefault: where the kernel puts them on first use.
+ *
+ *  Interleaving and binding need libnuma; without it, only the first-touch
+ *  placement applies. A tile smaller than a hugepage shares it with its
+ *  neighbours, which then all land on the node of the first one.
+ *  The matrix is released by plasma_numa_free().
+ *
+ ******************************************************************************/
+int plasma_numa_alloc(plasma_desc_t *A, size_t size,
+                      plasma_enum_t placement, plasma_enum_t hugepages,
+                      int num_threads)
+{
+    size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    size_t align = hugepages == PlasmaEnabled ? PLASMA_HUGEPAGE_SIZE : page;
+    size_t mapped = (size+align-1)/align*align;
+
+    // Explicit hugepages, if reserved, else pages aligned to the hugepages
+    // by trimming the mapping, for the transparent ones.
+    char *matrix = MAP_FAILED;
+#if defined(MAP_HUGETLB)
+    if (hugepages == PlasmaEnabled)
+        matrix = mmap(NULL, mapped, PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+#endif
+    if (matrix == MAP_FAILED) {
+        char *base = mmap(NULL, mapped+align-page, PROT_READ | PROT_WRITE,
+                          MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (base == MAP_FAILED) {
+            plasma_error("mmap() failed");
+            return PlasmaErrorOutOfMemory;
+        }
+        matrix = (char*)(((uintptr_t)base+align-1)/align*align);
+        if (matrix > base)
+            munmap(base, matrix-base);
+        if (align-page > (size_t)(matrix-base))
+            munmap(matrix+mapped, align-page-(matrix-base));
+#if defined(MADV_HUGEPAGE)
+        if (hugepages == PlasmaEnabled)
+            madvise(matrix, mapped, MADV_HUGEPAGE);
+#endif
+    }
+    A->matrix = matrix;
+    A->mapped = mapped;
+
+    int nb = plasma_numa_blocks(*A);
+    if (placement == PlasmaPlacementFirstTouch) {
+        #pragma omp parallel num_threads(num_threads)
+        {
+            int rank = omp_get_thread_num();
+            int nth = omp_get_num_threads();
+            for (int b = rank; b < nb; b += nth) {
+                char *ptr;
+                size_t len;
+                int node;
+                plasma_numa_block(*A, b, &ptr, &len, &node);
+                memset(ptr, 0, len);
+            }
+        }
+    }
+#if defined(PLASMA_USE_NUMA)
+    else if (plasma_numa_nodes() > 1) {
+        if (placement == PlasmaPlacementInterleave) {
+            numa_interleave_memory(matrix, mapped, numa_all_nodes_ptr);
+        }
+        else if (placement == PlasmaPlacementCyclic) {
+            for (int b = 0; b < nb; b++) {
+                char *ptr;
+                size_t len;
+                int node;
+                plasma_numa_block(*A, b, &ptr, &len, &node);
+                // mbind() takes whole pages.
+                char *start = (char*)((uintptr_t)ptr/page*page);
+                numa_tonode_memory(start, len+(ptr-start), node);
+            }
+        }
+    }
+#endif
+    return PlasmaSuccess;
+}
+
+/***************************************************************************//**
+ *  Unmaps the matrix of A mapped by plasma_numa_alloc().
+ ******************************************************************************/
+void plasma_numa_free(plasma_desc_t *A)
+{
+    munmap(A->matrix, A->mapped);
+    A->matrix = NULL;
+    A->mapped = 0;
+}
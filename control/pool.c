@@ -0,0 +1,242 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+#include "plasma_pool.h"
+#include "plasma_context.h"
+#include "plasma_internal.h"
+
+// The header keeps the memory handed out aligned to cache lines.
+#define PLASMA_POOL_ALIGN PLASMA_ALLOCATOR_ALIGN
+#define PLASMA_POOL_HEADER PLASMA_POOL_ALIGN
+
+/***************************************************************************//**
+    Returns the size class of size bytes: the smallest of 2^k*(4+j)/8,
+    j = 1, ..., 4, not below size, i.e., four classes per power of two,
+    so that a block wastes at most a quarter of its size.
+*/
+static size_t plasma_pool_class(size_t size)
+{
+    size_t c = 4096;
+    while (c < size)
+        c <<= 1;
+    if (c == 4096)
+        return c;
+    size_t s = c/2;
+    while (s < size)
+        s += c/8;
+    return s;
+}
+
+/******************************************************************************/
+static plasma_pool_block_t *plasma_pool_block(void *ptr)
+{
+    return (plasma_pool_block_t*)((char*)ptr-PLASMA_POOL_HEADER);
+}
+
+/***************************************************************************//**
+    Unlinks the idle block from the list of the pool, with the lock held.
+*/
+static void plasma_pool_unlink(plasma_pool_t *pool,
+                               plasma_pool_block_t *block)
+{
+    if (block->prev != NULL)
+        block->prev->next = block->next;
+    else
+        pool->head = block->next;
+    if (block->next != NULL)
+        block->next->prev = block->prev;
+    else
+        pool->tail = block->prev;
+    pool->size -= block->size;
+}
+
+/***************************************************************************//**
+    Unlinks the least recently idle blocks until the pool holds at most
+    limit bytes, with the lock held, and returns them in a list, to be
+    released by plasma_pool_release() once the lock is dropped.
+*/
+static plasma_pool_block_t *plasma_pool_evict(plasma_pool_t *pool,
+                                              size_t limit)
+{
+    plasma_pool_block_t *evicted = NULL;
+    while (pool->size > limit) {
+        plasma_pool_block_t *block = pool->tail;
+        plasma_pool_unlink(pool, block);
+        block->next = evicted;
+        evicted = block;
+    }
+    return evicted;
+}
+
+/******************************************************************************/
+static void plasma_pool_release(plasma_pool_t *pool,
+                                plasma_pool_block_t *block)
+{
+    while (block != NULL) {
+        plasma_pool_block_t *next = block->next;
+        plasma_allocator_free(pool->allocator, block,
+                              PLASMA_POOL_HEADER+block->size);
+        block = next;
+    }
+}
+
+/***************************************************************************//**
+    @ingroup plasma_pool
+    Releases the idle blocks of the pool of the context and the idle
+    buffers of its workspace arena, e.g., before a phase of the application
+    needing the memory. Must be called outside of parallel regions.
+*/
+int plasma_pool_trim(void)
+{
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+    plasma_pool_shrink(&plasma->pool, 0);
+    plasma_arena_trim(&plasma->arena);
+    return PlasmaSuccess;
+}
+
+/******************************************************************************/
+void plasma_pool_init(plasma_pool_t *pool,
+                      const plasma_allocator_t *allocator)
+{
+    pool->head = NULL;
+    pool->tail = NULL;
+    pool->size = 0;
+    pool->limit = 0;
+    pool->allocator = allocator;
+    pool->buffer = NULL;
+    pool->lbuffer = 0;
+    pool->used = 0;
+    omp_init_lock(&pool->lock);
+}
+
+/******************************************************************************/
+void plasma_pool_finalize(plasma_pool_t *pool)
+{
+    plasma_pool_shrink(pool, 0);
+    omp_destroy_lock(&pool->lock);
+}
+
+/***************************************************************************//**
+    Releases the least recently idle blocks until the pool holds at most
+    limit bytes.
+*/
+void plasma_pool_shrink(plasma_pool_t *pool, size_t limit)
+{
+    omp_set_lock(&pool->lock);
+    plasma_pool_block_t *evicted = plasma_pool_evict(pool, limit);
+    omp_unset_lock(&pool->lock);
+    plasma_pool_release(pool, evicted);
+}
+
+/***************************************************************************//**
+    Returns the bytes a block of size bytes takes out of a caller buffer.
+*/
+size_t plasma_pool_bytes(size_t size)
+{
+    return PLASMA_POOL_HEADER +
+           (size+PLASMA_POOL_ALIGN-1)/PLASMA_POOL_ALIGN*PLASMA_POOL_ALIGN;
+}
+
+/***************************************************************************//**
+    Carves the blocks of the next plasma_pool_alloc() calls out of the size
+    bytes of buffer, aligned to PLASMA_ALLOCATOR_ALIGN, until called with
+    NULL. The blocks are never released and live as long as the buffer.
+*/
+void plasma_pool_buffer(plasma_pool_t *pool, void *buffer, size_t size)
+{
+    pool->buffer = (char*)buffer;
+    pool->lbuffer = buffer != NULL ? size : 0;
+    pool->used = 0;
+}
+
+/***************************************************************************//**
+    Returns size bytes aligned to cache lines, carved out of the caller
+    buffer if set, else reusing an idle block of the size class if the pool
+    holds one, or NULL if out of memory.
+    The memory is released by plasma_pool_free().
+*/
+void *plasma_pool_alloc(plasma_pool_t *pool, size_t size)
+{
+    plasma_pool_block_t *block = NULL;
+    if (pool->buffer != NULL) {
+        size_t len = plasma_pool_bytes(size);
+        omp_set_lock(&pool->lock);
+        if (pool->used+len <= pool->lbuffer) {
+            block = (plasma_pool_block_t*)(pool->buffer+pool->used);
+            pool->used += len;
+        }
+        omp_unset_lock(&pool->lock);
+        if (block == NULL)
+            return NULL;
+        block->size = len-PLASMA_POOL_HEADER;
+        block->next = NULL;
+        block->prev = NULL;
+        block->external = 1;
+        return (char*)block+PLASMA_POOL_HEADER;
+    }
+    if (pool->limit > 0) {
+        size = plasma_pool_class(size);
+        omp_set_lock(&pool->lock);
+        for (block = pool->head; block != NULL; block = block->next) {
+            if (block->size == size) {
+                plasma_pool_unlink(pool, block);
+                break;
+            }
+        }
+        omp_unset_lock(&pool->lock);
+    }
+    if (block == NULL) {
+        block = (plasma_pool_block_t*)plasma_allocator_alloc(
+            pool->allocator, PLASMA_POOL_HEADER+size);
+        if (block == NULL)
+            return NULL;
+        block->size = size;
+        block->external = 0;
+    }
+    block->next = NULL;
+    block->prev = NULL;
+    return (char*)block+PLASMA_POOL_HEADER;
+}
+
+/***************************************************************************//**
+    Returns the memory ptr of plasma_pool_alloc() to the pool, or to the
+    allocator if the pool is disabled or the block does not fit in its
+    limit. The blocks of a caller buffer stay in it.
+*/
+void plasma_pool_free(plasma_pool_t *pool, void *ptr)
+{
+    if (ptr == NULL)
+        return;
+
+    plasma_pool_block_t *block = plasma_pool_block(ptr);
+    if (block->external)
+        return;
+    if (pool->limit == 0 || block->size > pool->limit ||
+        plasma_pool_class(block->size) != block->size) {
+        plasma_allocator_free(pool->allocator, block,
+                              PLASMA_POOL_HEADER+block->size);
+        return;
+    }
+    omp_set_lock(&pool->lock);
+    block->prev = NULL;
+    block->next = pool->head;
+    if (pool->head != NULL)
+        pool->head->prev = block;
+    else
+        pool->tail = block;
+    pool->head = block;
+    pool->size += block->size;
+    plasma_pool_block_t *evicted = plasma_pool_evict(pool, pool->limit);
+    omp_unset_lock(&pool->lock);
+    plasma_pool_release(pool, evicted);
+}
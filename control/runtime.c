@@ -0,0 +1,642 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+#include "plasma_runtime.h"
+#include "plasma_internal.h"
+
+#include <sched.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <omp.h>
+
+/******************************************************************************/
+// Chase-Lev work-stealing deque of task indices.
+// The owner pushes and pops at the bottom, thieves steal from the top.
+// Arrays replaced by a bigger one are kept until the deque is freed,
+// since a thief may still be reading them.
+typedef struct plasma_deque_array_s {
+    long mask;                          // capacity-1, capacity a power of two
+    struct plasma_deque_array_s *prev;  // replaced array
+    int data[];
+} plasma_deque_array_t;
+
+typedef struct {
+    long top;
+    long bottom;
+    plasma_deque_array_t *array;
+    char pad[64];   // keeps deques of different threads on separate lines
+} plasma_deque_t;
+
+/******************************************************************************/
+static int plasma_deque_init(plasma_deque_t *deque, long capacity)
+{
+    long size = 64;
+    while (size < capacity)
+        size *= 2;
+
+    deque->top = 0;
+    deque->bottom = 0;
+    deque->array = (plasma_deque_array_t*)malloc(
+        sizeof(plasma_deque_array_t) + size*sizeof(int));
+    if (deque->array == NULL)
+        return PlasmaErrorOutOfMemory;
+
+    deque->array->mask = size-1;
+    deque->array->prev = NULL;
+    return PlasmaSuccess;
+}
+
+/******************************************************************************/
+static void plasma_deque_destroy(plasma_deque_t *deque)
+{
+    plasma_deque_array_t *array = deque->array;
+    while (array != NULL) {
+        plasma_deque_array_t *prev = array->prev;
+        free(array);
+        array = prev;
+    }
+    deque->array = NULL;
+}
+
+/******************************************************************************/
+static int plasma_deque_push(plasma_deque_t *deque, int task)
+{
+    long b = __atomic_load_n(&deque->bottom, __ATOMIC_RELAXED);
+    long t = __atomic_load_n(&deque->top, __ATOMIC_ACQUIRE);
+    plasma_deque_array_t *a = __atomic_load_n(&deque->array, __ATOMIC_RELAXED);
+    if (b-t > a->mask) {
+        // Double the array.
+        long size = 2*(a->mask+1);
+        plasma_deque_array_t *new_a = (plasma_deque_array_t*)malloc(
+            sizeof(plasma_deque_array_t) + size*sizeof(int));
+        if (new_a == NULL)
+            return PlasmaErrorOutOfMemory;
+
+        new_a->mask = size-1;
+        new_a->prev = a;
+        for (long i = t; i < b; i++)
+            new_a->data[i & new_a->mask] = a->data[i & a->mask];
+
+        __atomic_store_n(&deque->array, new_a, __ATOMIC_RELEASE);
+        a = new_a;
+    }
+    __atomic_store_n(&a->data[b & a->mask], task, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    __atomic_store_n(&deque->bottom, b+1, __ATOMIC_RELAXED);
+    return PlasmaSuccess;
+}
+
+/******************************************************************************/
+static int plasma_deque_pop(plasma_deque_t *deque)
+{
+    long b = __atomic_load_n(&deque->bottom, __ATOMIC_RELAXED)-1;
+    plasma_deque_array_t *a = __atomic_load_n(&deque->array, __ATOMIC_RELAXED);
+    __atomic_store_n(&deque->bottom, b, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    long t = __atomic_load_n(&deque->top, __ATOMIC_RELAXED);
+
+    int task = -1;
+    if (t <= b) {
+        task = __atomic_load_n(&a->data[b & a->mask], __ATOMIC_RELAXED);
+        if (t == b) {
+            // Last task, race against thieves.
+            if (! __atomic_compare_exchange_n(&deque->top, &t, t+1, false,
+                                              __ATOMIC_SEQ_CST,
+                                              __ATOMIC_RELAXED))
+                task = -1;
+            __atomic_store_n(&deque->bottom, b+1, __ATOMIC_RELAXED);
+        }
+    }
+    else {
+        __atomic_store_n(&deque->bottom, b+1, __ATOMIC_RELAXED);
+    }
+    return task;
+}
+
+/******************************************************************************/
+static int plasma_deque_steal(plasma_deque_t *deque)
+{
+    long t = __atomic_load_n(&deque->top, __ATOMIC_ACQUIRE);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    long b = __atomic_load_n(&deque->bottom, __ATOMIC_ACQUIRE);
+    if (t >= b)
+        return -1;
+
+    plasma_deque_array_t *a = __atomic_load_n(&deque->array, __ATOMIC_ACQUIRE);
+    int task = __atomic_load_n(&a->data[t & a->mask], __ATOMIC_RELAXED);
+    if (! __atomic_compare_exchange_n(&deque->top, &t, t+1, false,
+                                      __ATOMIC_SEQ_CST, __ATOMIC_RELAXED))
+        return -1;
+
+    return task;
+}
+
+/***************************************************************************//**
+    @ingroup plasma_runtime
+    Initializes an empty task graph.
+*/
+void plasma_dag_init(plasma_dag_t *dag)
+{
+    dag->tasks = NULL;
+    dag->num_tasks = 0;
+    dag->cap_tasks = 0;
+    dag->handles = NULL;
+    dag->cap_handles = 0;
+    dag->num_handles = 0;
+    dag->completed = 0;
+    dag->num_bases = 0;
+    dag->status = PlasmaSuccess;
+}
+
+/***************************************************************************//**
+    @ingroup plasma_runtime
+    Frees a task graph.
+*/
+void plasma_dag_destroy(plasma_dag_t *dag)
+{
+    for (int i = 0; i < dag->num_tasks; i++) {
+        free(dag->tasks[i].args);
+        free(dag->tasks[i].reloc);
+        free(dag->tasks[i].succ);
+    }
+    free(dag->tasks);
+    for (int i = 0; i < dag->cap_handles; i++)
+        free(dag->handles[i].readers);
+    free(dag->handles);
+    plasma_dag_init(dag);
+}
+
+/******************************************************************************/
+static int plasma_dag_hash(const void *ptr, int cap)
+{
+    uint64_t key = (uint64_t)(uintptr_t)ptr >> 4;
+    return (int)((key*0x9E3779B97F4A7C15ull) >> 32) & (cap-1);
+}
+
+/******************************************************************************/
+// Returns the handle of the tile ptr, adding it if needed.
+static plasma_handle_t *plasma_dag_handle(plasma_dag_t *dag, const void *ptr)
+{
+    // Keep the load of the hash table under one half.
+    if (2*(dag->num_handles+1) > dag->cap_handles) {
+        int cap = dag->cap_handles == 0 ? 1024 : 2*dag->cap_handles;
+        plasma_handle_t *handles =
+            (plasma_handle_t*)calloc(cap, sizeof(plasma_handle_t));
+        if (handles == NULL)
+            return NULL;
+
+        for (int i = 0; i < dag->cap_handles; i++) {
+            if (dag->handles[i].ptr != NULL) {
+                int j = plasma_dag_hash(dag->handles[i].ptr, cap);
+                while (handles[j].ptr != NULL)
+                    j = (j+1) & (cap-1);
+                handles[j] = dag->handles[i];
+            }
+        }
+        free(dag->handles);
+        dag->handles = handles;
+        dag->cap_handles = cap;
+    }
+
+    int j = plasma_dag_hash(ptr, dag->cap_handles);
+    while (dag->handles[j].ptr != NULL && dag->handles[j].ptr != ptr)
+        j = (j+1) & (dag->cap_handles-1);
+
+    plasma_handle_t *handle = &dag->handles[j];
+    if (handle->ptr == NULL) {
+        handle->ptr = ptr;
+        handle->writer = -1;
+        handle->readers = NULL;
+        handle->nreaders = 0;
+        handle->capreaders = 0;
+        dag->num_handles++;
+    }
+    return handle;
+}
+
+/******************************************************************************/
+static int plasma_dag_edge(plasma_dag_t *dag, int pred, int succ)
+{
+    if (pred == succ)
+        return PlasmaSuccess;
+
+    plasma_task_t *task = &dag->tasks[pred];
+    if (task->nsucc > 0 && task->succ[task->nsucc-1] == succ)
+        return PlasmaSuccess;
+
+    if (task->nsucc == task->capsucc) {
+        int cap = task->capsucc == 0 ? 4 : 2*task->capsucc;
+        int *s = (int*)realloc(task->succ, cap*sizeof(int));
+        if (s == NULL)
+            return PlasmaErrorOutOfMemory;
+        task->succ = s;
+        task->capsucc = cap;
+    }
+    task->succ[task->nsucc++] = succ;
+    dag->tasks[succ].ndeps_init++;
+    return PlasmaSuccess;
+}
+
+/******************************************************************************/
+// Returns the region of the graph holding ptr, the one with the highest base
+// not above ptr, as the regions are disjoint, or -1 if there is none.
+static int plasma_dag_region(plasma_dag_t *dag, const void *ptr)
+{
+    int region = -1;
+    for (int i = 0; i < dag->num_bases; i++)
+        if ((uintptr_t)dag->base[i] <= (uintptr_t)ptr &&
+            (region < 0 ||
+             (uintptr_t)dag->base[i] > (uintptr_t)dag->base[region]))
+            region = i;
+
+    return region;
+}
+
+/******************************************************************************/
+static int plasma_dag_append(plasma_dag_t *dag, plasma_task_func_t func,
+                             const void *args, size_t size,
+                             int ndeps, const plasma_dep_t *deps)
+{
+    if (dag->num_tasks == dag->cap_tasks) {
+        int cap = dag->cap_tasks == 0 ? 256 : 2*dag->cap_tasks;
+        plasma_task_t *tasks =
+            (plasma_task_t*)realloc(dag->tasks, cap*sizeof(plasma_task_t));
+        if (tasks == NULL)
+            return PlasmaErrorOutOfMemory;
+        dag->tasks = tasks;
+        dag->cap_tasks = cap;
+    }
+    int id = dag->num_tasks;
+    plasma_task_t *task = &dag->tasks[id];
+    task->func = func;
+    task->args = NULL;
+    task->reloc = NULL;
+    task->nreloc = 0;
+    task->ndeps_init = 0;
+    task->ndeps = 0;
+    task->succ = NULL;
+    task->nsucc = 0;
+    task->capsucc = 0;
+    dag->num_tasks++;
+
+    if (size > 0) {
+        task->args = malloc(size);
+        if (task->args == NULL)
+            return PlasmaErrorOutOfMemory;
+        memcpy(task->args, args, size);
+    }
+    // Pointers are relocated only in graphs that may be replayed.
+    int nreloc = 0;
+    if (dag->num_bases > 0)
+        for (int d = 0; d < ndeps; d++)
+            if (deps[d].offset != PLASMA_DEP_NOARG)
+                nreloc++;
+    if (nreloc > 0) {
+        task->reloc = (plasma_reloc_t*)malloc(nreloc*sizeof(plasma_reloc_t));
+        if (task->reloc == NULL)
+            return PlasmaErrorOutOfMemory;
+        for (int d = 0; d < ndeps; d++)
+            if (deps[d].offset != PLASMA_DEP_NOARG) {
+                int base = plasma_dag_region(dag, deps[d].ptr);
+                if (base < 0)
+                    return PlasmaErrorIllegalValue;
+                task->reloc[task->nreloc].offset = deps[d].offset;
+                task->reloc[task->nreloc].base = base;
+                task->nreloc++;
+            }
+    }
+
+    for (int d = 0; d < ndeps; d++) {
+        if (deps[d].mode == PlasmaDepNone)
+            continue;
+
+        plasma_handle_t *handle = plasma_dag_handle(dag, deps[d].ptr);
+        if (handle == NULL)
+            return PlasmaErrorOutOfMemory;
+
+        int retval = PlasmaSuccess;
+        if (deps[d].mode & PlasmaDepOut) {
+            if (handle->nreaders > 0) {
+                for (int r = 0; r < handle->nreaders; r++)
+                    if (retval == PlasmaSuccess)
+                        retval = plasma_dag_edge(dag, handle->readers[r], id);
+            }
+            else if (handle->writer >= 0) {
+                retval = plasma_dag_edge(dag, handle->writer, id);
+            }
+            handle->writer = id;
+            handle->nreaders = 0;
+        }
+        else {
+            if (handle->writer >= 0)
+                retval = plasma_dag_edge(dag, handle->writer, id);
+
+            if (handle->nreaders == handle->capreaders) {
+                int cap = handle->capreaders == 0 ? 4 : 2*handle->capreaders;
+                int *r = (int*)realloc(handle->readers, cap*sizeof(int));
+                if (r == NULL)
+                    return PlasmaErrorOutOfMemory;
+                handle->readers = r;
+                handle->capreaders = cap;
+            }
+            handle->readers[handle->nreaders++] = id;
+        }
+        if (retval != PlasmaSuccess)
+            return retval;
+    }
+    return PlasmaSuccess;
+}
+
+/***************************************************************************//**
+    @ingroup plasma_runtime
+    Appends a task to the graph. Its arguments are copied. It depends on
+    earlier tasks through the tile handles in deps, as with the depend
+    clause of OpenMP: a read waits for the last write, a write waits for
+    the last write and all reads since.
+    Tasks must be inserted by a single thread, in a sequentially valid order.
+    After a failure, the graph is incomplete and later insertions fail too.
+*/
+int plasma_dag_insert(plasma_dag_t *dag, plasma_task_func_t func,
+                      const void *args, size_t size,
+                      int ndeps, const plasma_dep_t *deps)
+{
+    if (dag->status != PlasmaSuccess)
+        return dag->status;
+
+    int retval = plasma_dag_append(dag, func, args, size, ndeps, deps);
+    if (retval != PlasmaSuccess)
+        dag->status = retval;
+
+    return retval;
+}
+
+/***************************************************************************//**
+    @ingroup plasma_runtime
+    Moves the pointers of all tasks from the regions the graph was built for
+    to the regions at base, e.g., matrices of the same shape, in the order
+    they were given to plasma_graph_record().
+*/
+void plasma_dag_relocate(plasma_dag_t *dag, const void *const *base)
+{
+    ptrdiff_t delta[PLASMA_DAG_MAX_BASES];
+    int moved = 0;
+    for (int i = 0; i < dag->num_bases; i++) {
+        delta[i] = (const char*)base[i] - (const char*)dag->base[i];
+        if (delta[i] != 0)
+            moved = 1;
+    }
+    if (!moved)
+        return;
+
+    for (int i = 0; i < dag->num_tasks; i++) {
+        plasma_task_t *task = &dag->tasks[i];
+        for (int r = 0; r < task->nreloc; r++) {
+            char **ptr = (char**)((char*)task->args + task->reloc[r].offset);
+            *ptr += delta[task->reloc[r].base];
+        }
+    }
+    for (int i = 0; i < dag->num_bases; i++)
+        dag->base[i] = base[i];
+}
+
+/******************************************************************************/
+static void plasma_dag_execute(plasma_dag_t *dag, plasma_deque_t *deque,
+                               int id,
+                               plasma_sequence_t *sequence,
+                               plasma_request_t *request)
+{
+    plasma_task_t *task = &dag->tasks[id];
+    task->func(task->args, sequence, request);
+
+    // Release the successors.
+    for (int s = 0; s < task->nsucc; s++) {
+        int succ = task->succ[s];
+        if (__atomic_sub_fetch(&dag->tasks[succ].ndeps, 1,
+                               __ATOMIC_ACQ_REL) == 0) {
+            if (plasma_deque_push(deque, succ) != PlasmaSuccess)
+                plasma_dag_execute(dag, deque, succ, sequence, request);
+        }
+    }
+    __atomic_add_fetch(&dag->completed, 1, __ATOMIC_RELEASE);
+}
+
+/******************************************************************************/
+static void plasma_dag_worker(plasma_dag_t *dag, plasma_deque_t *deques,
+                              int nthread, int id,
+                              plasma_sequence_t *sequence,
+                              plasma_request_t *request)
+{
+    unsigned int seed = 2*id+1;
+    while (__atomic_load_n(&dag->completed, __ATOMIC_ACQUIRE) <
+           dag->num_tasks) {
+        int task = plasma_deque_pop(&deques[id]);
+
+        // Steal from random victims.
+        for (int i = 0; task < 0 && i < 2*nthread; i++) {
+            seed ^= seed << 13;
+            seed ^= seed >> 17;
+            seed ^= seed << 5;
+            int victim = seed % nthread;
+            if (victim != id)
+                task = plasma_deque_steal(&deques[victim]);
+        }
+        if (task < 0) {
+            sched_yield();
+            continue;
+        }
+        plasma_dag_execute(dag, &deques[id], task, sequence, request);
+    }
+}
+
+/***************************************************************************//**
+    @ingroup plasma_runtime
+    Executes all tasks of the graph and returns when they are completed.
+    Called by the master thread of a parallel region; the other threads
+    of the team join as OpenMP tasks and steal work from each other.
+    No tasks may be inserted afterwards, but the graph may be run again,
+    after plasma_dag_relocate() if the matrix moved.
+*/
+void plasma_dag_run(plasma_dag_t *dag,
+                    plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    int num_tasks = dag->num_tasks;
+    if (num_tasks == 0)
+        return;
+
+    // Insertion is over, drop the handles.
+    for (int i = 0; i < dag->cap_handles; i++)
+        free(dag->handles[i].readers);
+    free(dag->handles);
+    dag->handles = NULL;
+    dag->cap_handles = 0;
+    dag->num_handles = 0;
+
+    for (int i = 0; i < num_tasks; i++)
+        dag->tasks[i].ndeps = dag->tasks[i].ndeps_init;
+    dag->completed = 0;
+
+    int nthread = omp_get_num_threads();
+    plasma_deque_t *deques =
+        (plasma_deque_t*)calloc(nthread, sizeof(plasma_deque_t));
+    int retval = deques == NULL ? PlasmaErrorOutOfMemory : PlasmaSuccess;
+    for (int i = 0; i < nthread && retval == PlasmaSuccess; i++)
+        retval = plasma_deque_init(&deques[i], num_tasks/nthread+1);
+
+    if (retval != PlasmaSuccess) {
+        // The insertion order is a valid sequential schedule.
+        for (int i = 0; i < num_tasks; i++)
+            dag->tasks[i].func(dag->tasks[i].args, sequence, request);
+    }
+    else {
+        // Deal the initially ready tasks round robin.
+        int next = 0;
+        for (int i = 0; i < num_tasks; i++) {
+            if (dag->tasks[i].ndeps_init == 0) {
+                plasma_deque_push(&deques[next], i);
+                next = (next+1) % nthread;
+            }
+        }
+
+        for (int id = 1; id < nthread; id++) {
+            #pragma omp task firstprivate(id)
+            plasma_dag_worker(dag, deques, nthread, id, sequence, request);
+        }
+        plasma_dag_worker(dag, deques, nthread, 0, sequence, request);
+
+        #pragma omp taskwait
+    }
+
+    if (deques != NULL) {
+        for (int i = 0; i < nthread; i++)
+            plasma_deque_destroy(&deques[i]);
+        free(deques);
+    }
+}
+
+/******************************************************************************/
+// maximum number of recorded graphs per context
+#define PLASMA_GRAPHS_MAX 16
+
+/******************************************************************************/
+static int plasma_graph_match(plasma_graph_t *graph, const char *name,
+                              int param, plasma_desc_t A, int num_bases)
+{
+    return strcmp(graph->name, name) == 0 &&
+           graph->param == param &&
+           graph->dag.num_bases == num_bases &&
+           graph->A.type == A.type &&
+           graph->A.uplo == A.uplo &&
+           graph->A.precision == A.precision &&
+           graph->A.mb == A.mb && graph->A.nb == A.nb &&
+           graph->A.gm == A.gm && graph->A.gn == A.gn &&
+           graph->A.i == A.i && graph->A.j == A.j &&
+           graph->A.m == A.m && graph->A.n == A.n &&
+           graph->A.kl == A.kl && graph->A.ku == A.ku &&
+           graph->A.ld == A.ld;
+}
+
+/***************************************************************************//**
+    @ingroup plasma_runtime
+    Returns the graph recorded for routine name with parameter param
+    on a matrix of the shape of A, relocated to the regions at base,
+    or NULL if there is none.
+*/
+plasma_dag_t *plasma_graph_lookup(plasma_graph_t **graphs, const char *name,
+                                  int param, plasma_desc_t A,
+                                  int num_bases, const void *const *base)
+{
+    for (plasma_graph_t **link = graphs; *link != NULL;
+         link = &(*link)->next) {
+        plasma_graph_t *graph = *link;
+        if (plasma_graph_match(graph, name, param, A, num_bases)) {
+            // Move to the front.
+            *link = graph->next;
+            graph->next = *graphs;
+            *graphs = graph;
+
+            plasma_dag_relocate(&graph->dag, base);
+            return &graph->dag;
+        }
+    }
+    return NULL;
+}
+
+/***************************************************************************//**
+    @ingroup plasma_runtime
+    Returns an empty graph to be recorded for routine name with parameter
+    param on the matrix A, evicting the least recently used graph if there
+    are too many, or NULL if out of memory. The pointers of its tasks must
+    lie in the disjoint regions at base, e.g., A.matrix and the pivot vector,
+    which are moved on replay.
+*/
+plasma_dag_t *plasma_graph_record(plasma_graph_t **graphs, const char *name,
+                                  int param, plasma_desc_t A,
+                                  int num_bases, const void *const *base)
+{
+    if (num_bases > PLASMA_DAG_MAX_BASES)
+        return NULL;
+
+    plasma_graph_t *graph = (plasma_graph_t*)malloc(sizeof(plasma_graph_t));
+    if (graph == NULL)
+        return NULL;
+
+    graph->name = name;
+    graph->param = param;
+    graph->A = A;
+    plasma_dag_init(&graph->dag);
+    for (int i = 0; i < num_bases; i++)
+        graph->dag.base[i] = base[i];
+    graph->dag.num_bases = num_bases;
+    graph->next = *graphs;
+    *graphs = graph;
+
+    int count = 0;
+    for (plasma_graph_t **link = graphs; *link != NULL;
+         link = &(*link)->next) {
+        if (++count == PLASMA_GRAPHS_MAX) {
+            plasma_graph_destroy(&(*link)->next);
+            break;
+        }
+    }
+    return &graph->dag;
+}
+
+/***************************************************************************//**
+    @ingroup plasma_runtime
+    Removes a graph, e.g., one whose recording failed.
+*/
+void plasma_graph_remove(plasma_graph_t **graphs, plasma_dag_t *dag)
+{
+    for (plasma_graph_t **link = graphs; *link != NULL;
+         link = &(*link)->next) {
+        plasma_graph_t *graph = *link;
+        if (&graph->dag == dag) {
+            *link = graph->next;
+            plasma_dag_destroy(&graph->dag);
+            free(graph);
+            return;
+        }
+    }
+}
+
+/***************************************************************************//**
+    @ingroup plasma_runtime
+    Frees a list of graphs.
+*/
+void plasma_graph_destroy(plasma_graph_t **graphs)
+{
+    while (*graphs != NULL) {
+        plasma_graph_t *graph = *graphs;
+        *graphs = graph->next;
+        plasma_dag_destroy(&graph->dag);
+        free(graph);
+    }
+}
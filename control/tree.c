@@ -7,8 +7,10 @@
  *  University of Manchester, UK.
  **/
 
+#include "plasma_context.h"
 #include "plasma_descriptor.h"
 #include "plasma_internal.h"
+#include "plasma_pool.h"
 #include "plasma_tree.h"
 
 #include <omp.h>
@@ -45,6 +47,38 @@ void plasma_tree_block_greedy(int mt, int nt,
                               plasma_sequence_t *sequence,
                               plasma_request_t *request);
 
+/******************************************************************************/
+// The trees and their counters come from the memory pool of the context,
+// hence from the caller buffer of the _buffer() routines.
+static void *plasma_tree_alloc(size_t size)
+{
+    plasma_context_t *plasma = plasma_context_self();
+    return plasma_pool_alloc(&plasma->pool, size);
+}
+
+/***************************************************************************//**
+ *  Releases the operations of plasma_tree_operations().
+ **/
+void plasma_tree_free(int *operations)
+{
+    plasma_context_t *plasma = plasma_context_self();
+    plasma_pool_free(&plasma->pool, operations);
+}
+
+/***************************************************************************//**
+ *  Returns an upper bound of the bytes plasma_tree_operations() takes
+ *  from the memory pool of the context for an mt-by-nt tile matrix.
+ **/
+size_t plasma_tree_bytes(int mt, int nt)
+{
+    size_t minnt = imin(mt, nt);
+
+    // Each tile is triangularized and anihilated at most once.
+    size_t loperations = 2*(size_t)mt*minnt;
+    return plasma_pool_bytes(loperations*4*sizeof(int)) +
+           2*plasma_pool_bytes(minnt*sizeof(int));
+}
+
 static inline int get_super_tiles(int n, int bs) {
     return (n+(bs-1)) / bs;
 }
@@ -149,7 +183,7 @@ void plasma_tree_flat_ts(int mt, int nt,
     size_t loperations = num_triangularized_tiles + num_anihilated_tiles;
 
     // Allocate array of operations.
-    *operations = (int *) malloc(loperations*4*sizeof(int));
+    *operations = (int*)plasma_tree_alloc(loperations*4*sizeof(int));
     if (*operations == NULL) {
         plasma_error("Allocation of the array of operations failed.");
         plasma_request_fail(sequence, request, PlasmaErrorOutOfMemory);
@@ -205,7 +239,7 @@ void plasma_tree_flat_tt(int mt, int nt,
     size_t loperations = num_triangularized_tiles + num_anihilated_tiles;
 
     // Allocate array of operations.
-    *operations = (int *) malloc(loperations*4*sizeof(int));
+    *operations = (int*)plasma_tree_alloc(loperations*4*sizeof(int));
     if (*operations == NULL) {
         plasma_error("Allocation of the array of operations failed.");
         plasma_request_fail(sequence, request, PlasmaErrorOutOfMemory);
@@ -269,7 +303,7 @@ void plasma_tree_binary(int mt, int nt,
     size_t loperations = num_triangularized_tiles + num_anihilated_tiles;
 
     // Allocate array of operations.
-    *operations = (int *) malloc(loperations*4*sizeof(int));
+    *operations = (int*)plasma_tree_alloc(loperations*4*sizeof(int));
     if (*operations == NULL) {
         plasma_error("Allocation of the array of operations failed.");
         plasma_request_fail(sequence, request, PlasmaErrorOutOfMemory);
@@ -348,7 +382,7 @@ void plasma_tree_auto(int mt, int nt,
     size_t loperations = num_triangularized_tiles + num_anihilated_tiles;
 
     // Allocate array of operations.
-    *operations = (int *) malloc(loperations*4*sizeof(int));
+    *operations = (int*)plasma_tree_alloc(loperations*4*sizeof(int));
     if (*operations == NULL) {
         plasma_error("Allocation of the array of operations failed.");
         plasma_request_fail(sequence, request, PlasmaErrorOutOfMemory);
@@ -434,19 +468,19 @@ void plasma_tree_greedy(int mt, int nt,
     size_t loperations = num_triangularized_tiles + num_anihilated_tiles;
 
     // Allocate array of operations.
-    *operations = (int *) malloc(loperations*4*sizeof(int));
+    *operations = (int*)plasma_tree_alloc(loperations*4*sizeof(int));
     if (*operations == NULL) {
         plasma_error("Allocation of the array of operations failed.");
         plasma_request_fail(sequence, request, PlasmaErrorOutOfMemory);
     }
 
     // Prepare memory for column counters.
-    int *NZ = (int*) malloc(minnt*sizeof(int));
+    int *NZ = (int*)plasma_tree_alloc(minnt*sizeof(int));
     if (NZ == NULL) {
         plasma_error("Allocation of the array NZ failed.");
         plasma_request_fail(sequence, request, PlasmaErrorOutOfMemory);
     }
-    int *NT = (int*) malloc(minnt*sizeof(int));
+    int *NT = (int*)plasma_tree_alloc(minnt*sizeof(int));
     if (NT == NULL) {
         plasma_error("Allocation of the array NT failed.");
         plasma_request_fail(sequence, request, PlasmaErrorOutOfMemory);
@@ -525,8 +559,8 @@ void plasma_tree_greedy(int mt, int nt,
     *num_operations = iops;
 
     // Deallocate column counters.
-    free(NZ);
-    free(NT);
+    plasma_tree_free(NZ);
+    plasma_tree_free(NT);
 }
 
 /***************************************************************************//**
@@ -571,19 +605,19 @@ void plasma_tree_block_greedy(int mt, int nt,
     size_t loperations = num_triangularized_tiles + num_anihilated_tiles;
 
     // Allocate array of operations.
-    *operations = (int *) malloc(loperations*4*sizeof(int));
+    *operations = (int*)plasma_tree_alloc(loperations*4*sizeof(int));
     if (*operations == NULL) {
         plasma_error("Allocation of the array of operations failed.");
         plasma_request_fail(sequence, request, PlasmaErrorOutOfMemory);
     }
 
     // Prepare memory for column counters.
-    int *NZ = (int*) malloc(minnt*sizeof(int));
+    int *NZ = (int*)plasma_tree_alloc(minnt*sizeof(int));
     if (NZ == NULL) {
         plasma_error("Allocation of the array NZ failed.");
         plasma_request_fail(sequence, request, PlasmaErrorOutOfMemory);
     }
-    int *NT = (int*) malloc(minnt*sizeof(int));
+    int *NT = (int*)plasma_tree_alloc(minnt*sizeof(int));
     if (NT == NULL) {
         plasma_error("Allocation of the array NT failed.");
         plasma_request_fail(sequence, request, PlasmaErrorOutOfMemory);
@@ -683,6 +717,6 @@ void plasma_tree_block_greedy(int mt, int nt,
     *num_operations = iops;
 
     // Deallocate column counters.
-    free(NZ);
-    free(NT);
+    plasma_tree_free(NZ);
+    plasma_tree_free(NT);
 }
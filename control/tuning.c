@@ -91,7 +91,7 @@ static void plasma_tune(plasma_context_t *plasma, plasma_enum_t dtyp,
         default: plasma_error("invalid type"); return;
     }
 
-    lua_pushinteger(L, omp_get_max_threads());
+    lua_pushinteger(L, plasma->max_threads);
 
     va_list ap;
     va_start(ap, count);
@@ -136,14 +136,16 @@ static void plasma_tune(plasma_context_t *plasma, plasma_enum_t dtyp,
         va_arg(ap, int);
     va_end(ap);
 
-    /* When Lua is missing use tile size 100 with inner blocking 50 and one
-     * panel thread. */
+    /* When Lua is missing use tile size 100 with inner blocking 50, one
+     * panel thread and lookahead 1. */
     if (strstr(func_name, "_nb"))
         *out = 100;
     else if (strstr(func_name, "_ib"))
         *out = 50;
     else if (strstr(func_name, "_threads"))
         *out = 1;
+    else if (strstr(func_name, "_lookahead"))
+        *out = 1;
     else {
         plasma_error("plasma_tune() unknown routine");
         *out = 64;
@@ -172,6 +174,7 @@ void plasma_tune_gbtrf(plasma_context_t *plasma, plasma_enum_t dtyp,
     plasma_tune(plasma, dtyp, "gbtrf_ib", &plasma->ib, 2, n, bw);
     plasma_tune(plasma, dtyp, "gbtrf_max_panel_threads",
                 &plasma->max_panel_threads, 2, n, bw);
+    plasma_tune(plasma, dtyp, "gbtrf_lookahead", &plasma->lookahead, 2, n, bw);
 }
 
 /******************************************************************************/
@@ -250,6 +253,7 @@ void plasma_tune_getrf(plasma_context_t *plasma, plasma_enum_t dtyp,
     plasma_tune(plasma, dtyp, "getrf_ib", &plasma->ib, 2, m, n);
     plasma_tune(plasma, dtyp, "getrf_max_panel_threads",
                 &plasma->max_panel_threads, 2, m, n);
+    plasma_tune(plasma, dtyp, "getrf_lookahead", &plasma->lookahead, 2, m, n);
 }
 
 /******************************************************************************/
@@ -370,6 +374,7 @@ void plasma_tune_potrf(plasma_context_t *plasma, plasma_enum_t dtyp,
         return;
 
     plasma_tune(plasma, dtyp, "potrf_nb", &plasma->nb, 1, n);
+    plasma_tune(plasma, dtyp, "potrf_lookahead", &plasma->lookahead, 1, n);
 }
 
 /******************************************************************************/
@@ -8,37 +8,47 @@
  *
  **/
 #include "plasma_workspace.h"
+#include "plasma_context.h"
 #include "plasma_internal.h"
 
-#include <omp.h>
-
 /******************************************************************************/
 int plasma_workspace_create(plasma_workspace_t *workspace, size_t lworkspace,
                             plasma_enum_t dtyp)
 {
-    // Allocate array of pointers.
-    #pragma omp parallel
-    #pragma omp master
-    {
-        workspace->nthread = omp_get_num_threads();
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
     }
+
+    // One workspace per thread of the parallel regions, carved out of the
+    // arena of the context, with the array of pointers in that of thread 0,
+    // or out of the caller buffer of a plasma_*_buffer() call.
+    int buffer = plasma->pool.buffer != NULL;
+    workspace->nthread = plasma->max_threads;
     workspace->lworkspace = lworkspace;
     workspace->dtyp  = dtyp;
-    if ((workspace->spaces = (void**)calloc(workspace->nthread,
-                                            sizeof(void*))) == NULL) {
-        free(workspace->spaces);
-        plasma_error("malloc() failed");
+    size_t lspaces = (size_t)workspace->nthread*sizeof(void*);
+    workspace->spaces = buffer ?
+        (void**)plasma_pool_alloc(&plasma->pool, lspaces) :
+        (void**)plasma_arena_push(&plasma->arena, 0, lspaces);
+    if (workspace->spaces == NULL) {
+        workspace->nthread = 0;
+        plasma_error("workspace allocation failed");
         return PlasmaErrorOutOfMemory;
     }
+    for (int tid = 0; tid < workspace->nthread; ++tid)
+        workspace->spaces[tid] = NULL;
 
-    // Each thread allocates its workspace.
     size_t size = (size_t)lworkspace * plasma_element_size(workspace->dtyp);
     int info = PlasmaSuccess;
-    #pragma omp parallel
-    {
-        int tid = omp_get_thread_num();
-        if ((workspace->spaces[tid] = (void*)malloc(size)) == NULL) {
+    for (int tid = 0; tid < workspace->nthread; ++tid) {
+        workspace->spaces[tid] = buffer ?
+            plasma_pool_alloc(&plasma->pool, size) :
+            plasma_arena_push(&plasma->arena, tid, size);
+        if (workspace->spaces[tid] == NULL) {
             info = PlasmaErrorOutOfMemory;
+            break;
         }
     }
     if (info != PlasmaSuccess) {
@@ -50,15 +60,38 @@ int plasma_workspace_create(plasma_workspace_t *workspace, size_t lworkspace,
 /******************************************************************************/
 int plasma_workspace_destroy(plasma_workspace_t *workspace)
 {
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
     if (workspace->spaces != NULL) {
-        for (int i = 0; i < workspace->nthread; ++i) {
-            free(workspace->spaces[i]);
-            workspace->spaces[i] = NULL;
+        // The spaces carved out of a caller buffer stay in it.
+        if (plasma->pool.buffer == NULL) {
+            for (int i = workspace->nthread-1; i >= 0; --i) {
+                plasma_arena_pop(&plasma->arena, i, workspace->spaces[i]);
+                workspace->spaces[i] = NULL;
+            }
+            plasma_arena_pop(&plasma->arena, 0, workspace->spaces);
         }
-        free(workspace->spaces);
         workspace->spaces  = NULL;
         workspace->nthread = 0;
         workspace->lworkspace   = 0;
     }
     return PlasmaSuccess;
 }
+
+/***************************************************************************//**
+    Returns the bytes a workspace of lworkspace elements of type dtyp per
+    thread takes out of the caller buffer of a plasma_*_buffer() call.
+*/
+size_t plasma_workspace_bytes(size_t lworkspace, plasma_enum_t dtyp)
+{
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL)
+        return 0;
+
+    size_t nthread = (size_t)plasma->max_threads;
+    return plasma_pool_bytes(nthread*sizeof(void*)) +
+           nthread*plasma_pool_bytes(lworkspace*plasma_element_size(dtyp));
+}
@@ -0,0 +1,89 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> c d s
+ *
+ **/
+
+#include <plasma_core_blas.h>
+#include "plasma_internal.h"
+#include "plasma_types.h"
+
+#include <math.h>
+
+#define COMPLEX
+
+// number of elements reduced in one SIMD pass, a few KB fitting in L1
+#define PLASMA_CORE_IAMAX_BLOCK 256
+
+/***************************************************************************//**
+ *
+ * @ingroup core_iamax
+ *
+ *  Finds the first element of largest magnitude of the vector x.
+ *  The magnitude is abs(real(x)) + abs(imag(x)), as in plasma_core_dcabs1().
+ *  The vector is scanned in blocks: a SIMD max reduction of a block,
+ *  then, only for a block improving the maximum, the search of the index,
+ *  so that value and index come out of a single pass over memory.
+ *
+ *******************************************************************************
+ *
+ * @param[in] n
+ *          The length of the vector x.
+ *
+ * @param[in] x
+ *          The vector of length n, with unit stride.
+ *
+ * @param[out] amax
+ *          On exit, the magnitude of the element found, or -1 if n <= 0.
+ *
+ *******************************************************************************
+ *
+ * @retval The index, from 0, of the element found, or -1 if n <= 0.
+ *
+ ******************************************************************************/
+int plasma_core_izamax(int n, const plasma_complex64_t *x, double *amax)
+{
+#ifdef COMPLEX
+    const double *xr = (const double*)x;
+#endif
+    int imax = -1;
+    double vmax = -1.0;
+
+    for (int i0 = 0; i0 < n; i0 += PLASMA_CORE_IAMAX_BLOCK) {
+        int nb = imin(PLASMA_CORE_IAMAX_BLOCK, n-i0);
+
+        double bmax = -1.0;
+        #pragma omp simd reduction(max:bmax)
+        for (int i = i0; i < i0+nb; i++) {
+#ifdef COMPLEX
+            double v = fabs(xr[2*i]) + fabs(xr[2*i+1]);
+#else
+            double v = fabs(x[i]);
+#endif
+            bmax = v > bmax ? v : bmax;
+        }
+
+        if (bmax > vmax) {
+            for (int i = i0; i < i0+nb; i++) {
+#ifdef COMPLEX
+                double v = fabs(xr[2*i]) + fabs(xr[2*i+1]);
+#else
+                double v = fabs(x[i]);
+#endif
+                if (v == bmax) {
+                    imax = i;
+                    break;
+                }
+            }
+            vmax = bmax;
+        }
+    }
+    *amax = vmax;
+    return imax;
+}
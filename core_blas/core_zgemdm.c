@@ -0,0 +1,130 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> c d s
+ *
+ **/
+
+#include <plasma_core_blas.h>
+#include "plasma_types.h"
+#include "plasma_internal.h"
+#include "core_lapack.h"
+
+#include <omp.h>
+
+/***************************************************************************//**
+ *
+ * @ingroup core_gemdm
+ *
+ *  Performs the update of the LDL^H factorization without pivoting
+ *
+ *    C = alpha * A * D * B^H + beta * C,
+ *
+ *  where D is a k-by-k diagonal matrix, A is m-by-k, B is n-by-k and C is
+ *  m-by-n.
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *          The number of rows of the tiles A and C. m >= 0.
+ *
+ * @param[in] n
+ *          The number of columns of the tile C and rows of B. n >= 0.
+ *
+ * @param[in] k
+ *          The order of D. k >= 0.
+ *
+ * @param[in] alpha
+ *          The scalar alpha.
+ *
+ * @param[in] A
+ *          The m-by-k tile A.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A. lda >= max(1,m).
+ *
+ * @param[in] D
+ *          The diagonal of D.
+ *
+ * @param[in] incd
+ *          The stride between the diagonal elements of D. incd > 0.
+ *
+ * @param[in] B
+ *          The n-by-k tile B.
+ *
+ * @param[in] ldb
+ *          The leading dimension of the array B. ldb >= max(1,n).
+ *
+ * @param[in] beta
+ *          The scalar beta.
+ *
+ * @param[in,out] C
+ *          On entry, the m-by-n tile C.
+ *          On exit, the updated tile.
+ *
+ * @param[in] ldc
+ *          The leading dimension of the array C. ldc >= max(1,m).
+ *
+ * @param work
+ *          Workspace of size at least k*n, holding D * B^H.
+ *
+ ******************************************************************************/
+__attribute__((weak))
+void plasma_core_zgemdm(int m, int n, int k,
+                        plasma_complex64_t alpha,
+                        const plasma_complex64_t *A, int lda,
+                        const plasma_complex64_t *D, int incd,
+                        const plasma_complex64_t *B, int ldb,
+                        plasma_complex64_t beta,
+                              plasma_complex64_t *C, int ldc,
+                              plasma_complex64_t *work)
+{
+    // work = D * B^H
+    for (int j = 0; j < n; j++)
+        for (int l = 0; l < k; l++)
+            work[l+k*j] = D[incd*l]*conj(B[j+ldb*l]);
+
+    cblas_zgemm(CblasColMajor,
+                CblasNoTrans, CblasNoTrans,
+                m, n, k,
+                CBLAS_SADDR(alpha), A, lda,
+                                    work, k,
+                CBLAS_SADDR(beta),  C, ldc);
+}
+
+/******************************************************************************/
+void plasma_core_omp_zgemdm(int m, int n, int k,
+                            plasma_complex64_t alpha,
+                            const plasma_complex64_t *A, int lda,
+                            const plasma_complex64_t *D, int incd,
+                            const plasma_complex64_t *B, int ldb,
+                            plasma_complex64_t beta,
+                                  plasma_complex64_t *C, int ldc,
+                            plasma_workspace_t work,
+                            plasma_sequence_t *sequence,
+                            plasma_request_t *request)
+{
+    #pragma omp task depend(in:A[0:lda*k]) \
+                     depend(in:D[0:incd*k]) \
+                     depend(in:B[0:ldb*k]) \
+                     depend(inout:C[0:ldc*n])
+    {
+        if (sequence->status == PlasmaSuccess) {
+            // Prepare workspace.
+            int tid = omp_get_thread_num();
+            plasma_complex64_t *W = (plasma_complex64_t*)work.spaces[tid];
+
+            plasma_core_zgemdm(m, n, k,
+                               alpha, A, lda,
+                                      D, incd,
+                                      B, ldb,
+                               beta,  C, ldc,
+                               W);
+        }
+    }
+}
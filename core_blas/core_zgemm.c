@@ -11,6 +11,7 @@
  **/
 
 #include <plasma_core_blas.h>
+#include "plasma_internal.h"
 #include "plasma_types.h"
 #include "core_lapack.h"
 
@@ -124,7 +125,8 @@ void plasma_core_omp_zgemm(
 
     #pragma omp task depend(in:A[0:lda*ak]) \
                      depend(in:B[0:ldb*bk]) \
-                     depend(inout:C[0:ldc*n])
+                     depend(inout:C[0:ldc*n]) \
+                     affinity(C[0:ldc*n])
     {
         if (sequence->status == PlasmaSuccess)
             plasma_core_zgemm(transa, transb,
@@ -134,3 +136,53 @@ void plasma_core_omp_zgemm(
                        beta,  C, ldc);
     }
 }
+
+/******************************************************************************/
+typedef struct {
+    plasma_enum_t transa, transb;
+    int m, n, k;
+    plasma_complex64_t alpha;
+    const plasma_complex64_t *A;
+    int lda;
+    const plasma_complex64_t *B;
+    int ldb;
+    plasma_complex64_t beta;
+    plasma_complex64_t *C;
+    int ldc;
+} plasma_core_rt_zgemm_args_t;
+
+static void plasma_core_rt_zgemm_task(void *args,
+                                      plasma_sequence_t *sequence,
+                                      plasma_request_t *request)
+{
+    plasma_core_rt_zgemm_args_t *a = (plasma_core_rt_zgemm_args_t*)args;
+    if (sequence->status == PlasmaSuccess)
+        plasma_core_zgemm(a->transa, a->transb,
+                   a->m, a->n, a->k,
+                   a->alpha, a->A, a->lda,
+                             a->B, a->ldb,
+                   a->beta,  a->C, a->ldc);
+}
+
+/******************************************************************************/
+void plasma_core_rt_zgemm(
+    plasma_dag_t *dag,
+    plasma_enum_t transa, plasma_enum_t transb,
+    int m, int n, int k,
+    plasma_complex64_t alpha, const plasma_complex64_t *A, int lda,
+                              const plasma_complex64_t *B, int ldb,
+    plasma_complex64_t beta,        plasma_complex64_t *C, int ldc,
+    plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    plasma_core_rt_zgemm_args_t args = {
+        transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc
+    };
+    plasma_dep_t deps[] = {
+        {A, PlasmaDepIn, offsetof(plasma_core_rt_zgemm_args_t, A)},
+        {B, PlasmaDepIn, offsetof(plasma_core_rt_zgemm_args_t, B)},
+        {C, PlasmaDepInout, offsetof(plasma_core_rt_zgemm_args_t, C)}
+    };
+    if (plasma_dag_insert(dag, plasma_core_rt_zgemm_task,
+                          &args, sizeof(args), 3, deps) != PlasmaSuccess)
+        plasma_request_fail(sequence, request, PlasmaErrorOutOfMemory);
+}
@@ -197,3 +197,61 @@ void plasma_core_omp_zgeqrt(int m, int n, int ib,
         }
     }
 }
+
+/******************************************************************************/
+typedef struct {
+    int m, n, ib;
+    plasma_complex64_t *A;
+    int lda;
+    plasma_complex64_t *T;
+    int ldt;
+    plasma_workspace_t work;
+} plasma_core_rt_zgeqrt_args_t;
+
+static void plasma_core_rt_zgeqrt_task(void *args,
+                                       plasma_sequence_t *sequence,
+                                       plasma_request_t *request)
+{
+    plasma_core_rt_zgeqrt_args_t *a = (plasma_core_rt_zgeqrt_args_t*)args;
+    if (sequence->status == PlasmaSuccess) {
+        // Prepare workspaces.
+        int tid = omp_get_thread_num();
+        plasma_complex64_t *tau = ((plasma_complex64_t*)a->work.spaces[tid]);
+
+        // Call the kernel.
+        int info = plasma_core_zgeqrt(a->m, a->n, a->ib,
+                               a->A, a->lda,
+                               a->T, a->ldt,
+                               tau,
+                               tau+a->n);
+
+        if (info != PlasmaSuccess) {
+            plasma_error("core_zgeqrt() failed");
+            plasma_request_fail(sequence, request, PlasmaErrorInternal);
+        }
+    }
+}
+
+/******************************************************************************/
+void plasma_core_rt_zgeqrt(plasma_dag_t *dag,
+                    int m, int n, int ib,
+                    plasma_complex64_t *A, int lda,
+                    plasma_complex64_t *T, int ldt,
+                    plasma_workspace_t work,
+                    plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    plasma_core_rt_zgeqrt_args_t args = {
+        m, n, ib, A, lda, T, ldt, work
+    };
+    plasma_dep_t deps[] = {
+        {A, PlasmaDepInout, offsetof(plasma_core_rt_zgeqrt_args_t, A)},
+        {T, PlasmaDepOut, offsetof(plasma_core_rt_zgeqrt_args_t, T)},
+        // the workspaces, moved on replay
+        {work.spaces, PlasmaDepNone,
+         offsetof(plasma_core_rt_zgeqrt_args_t, work)+
+         offsetof(plasma_workspace_t, spaces)}
+    };
+    if (plasma_dag_insert(dag, plasma_core_rt_zgeqrt_task,
+                          &args, sizeof(args), 3, deps) != PlasmaSuccess)
+        plasma_request_fail(sequence, request, PlasmaErrorOutOfMemory);
+}
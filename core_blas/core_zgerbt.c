@@ -0,0 +1,177 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> c d s
+ *
+ **/
+
+#include <plasma_core_blas.h>
+#include "plasma_internal.h"
+#include "plasma_types.h"
+
+#include <math.h>
+
+#define A(m, n) (plasma_complex64_t*)plasma_tile_addr(A, m, n)
+
+/***************************************************************************//**
+ *  Applies the butterfly of the block of s rows or columns of A starting
+ *  at o, which pairs element i of the first half with element i of the
+ *  second half; the middle element of an odd block is left as it is.
+ *  With forward set, the pair (x, y) becomes (r0*x + r1*y, r0*x - r1*y),
+ *  otherwise (r0*(x + y), r1*(x - y)), both divided by sqrt(2).
+ ******************************************************************************/
+static void plasma_core_zgerbt_block(plasma_enum_t side, int forward,
+                                     plasma_desc_t A, int o, int s,
+                                     const double *u)
+{
+    int h = s/2;
+    double c = 1.0/sqrt(2.0);
+
+    if (side == PlasmaLeft) {
+        // Runs of row pairs staying within their tiles.
+        for (int i = 0; i < h; ) {
+            int i1 = o+i;
+            int i2 = o+h+i;
+            int len = imin(h-i, imin(A.mb-i1%A.mb, A.mb-i2%A.mb));
+            plasma_complex64_t *a1 = A(i1/A.mb, 0) + i1%A.mb;
+            plasma_complex64_t *a2 = A(i2/A.mb, 0) + i2%A.mb;
+            int lda1 = plasma_tile_mmain(A, i1/A.mb);
+            int lda2 = plasma_tile_mmain(A, i2/A.mb);
+            const double *r0 = &u[i1];
+            const double *r1 = &u[i2];
+
+            for (int j = 0; j < A.n; j++) {
+                plasma_complex64_t *x = &a1[lda1*j];
+                plasma_complex64_t *y = &a2[lda2*j];
+                if (forward) {
+                    for (int l = 0; l < len; l++) {
+                        plasma_complex64_t xl = r0[l]*x[l];
+                        plasma_complex64_t yl = r1[l]*y[l];
+                        x[l] = c*(xl+yl);
+                        y[l] = c*(xl-yl);
+                    }
+                }
+                else {
+                    for (int l = 0; l < len; l++) {
+                        plasma_complex64_t xl = x[l];
+                        plasma_complex64_t yl = y[l];
+                        x[l] = c*r0[l]*(xl+yl);
+                        y[l] = c*r1[l]*(xl-yl);
+                    }
+                }
+            }
+            i += len;
+        }
+    }
+    else {
+        int lda = plasma_tile_mmain(A, 0);
+        for (int i = 0; i < h; i++) {
+            int j1 = o+i;
+            int j2 = o+h+i;
+            plasma_complex64_t *x = A(0, j1/A.nb) + lda*(j1%A.nb);
+            plasma_complex64_t *y = A(0, j2/A.nb) + lda*(j2%A.nb);
+            double r0 = u[j1];
+            double r1 = u[j2];
+
+            if (forward) {
+                for (int l = 0; l < A.m; l++) {
+                    plasma_complex64_t xl = r0*x[l];
+                    plasma_complex64_t yl = r1*y[l];
+                    x[l] = c*(xl+yl);
+                    y[l] = c*(xl-yl);
+                }
+            }
+            else {
+                for (int l = 0; l < A.m; l++) {
+                    plasma_complex64_t xl = x[l];
+                    plasma_complex64_t yl = y[l];
+                    x[l] = c*r0*(xl+yl);
+                    y[l] = c*r1*(xl-yl);
+                }
+            }
+        }
+    }
+}
+
+/***************************************************************************//**
+ *  Applies the butterflies of the given level to the block of s rows or
+ *  columns starting at o, which the levels above split in halves.
+ ******************************************************************************/
+static void plasma_core_zgerbt_level(plasma_enum_t side, int forward,
+                                     plasma_desc_t A, int level,
+                                     int o, int s, const double *u)
+{
+    if (level == 0) {
+        plasma_core_zgerbt_block(side, forward, A, o, s, u);
+        return;
+    }
+    int h = s/2;
+    plasma_core_zgerbt_level(side, forward, A, level-1, o, h, u);
+    plasma_core_zgerbt_level(side, forward, A, level-1, o+h, s-h, u);
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_gerbt
+ *
+ *  Applies a recursive random butterfly transform U of depth d to the
+ *  rows (side = PlasmaLeft) or to the columns (side = PlasmaRight)
+ *  of the matrix A:
+ *
+ *    A = op(U) * A  or  A = A * op(U),
+ *
+ *  where U = U_{d-1} * ... * U_1 * U_0 and U_l is block diagonal with
+ *  2^l butterflies
+ *
+ *    B = 1/sqrt(2) * | R0  R1 |
+ *                    | R0 -R1 |,
+ *
+ *  R0 and R1 being diagonal and real. Blocks of odd order keep their
+ *  middle element, so that U applies to any order.
+ *
+ *******************************************************************************
+ *
+ * @param[in] side
+ *          - PlasmaLeft:  the rows of A are transformed,
+ *          - PlasmaRight: the columns of A are transformed.
+ *
+ * @param[in] trans
+ *          - PlasmaNoTrans: op(U) = U,
+ *          - PlasmaTrans:   op(U) = U^T = U^H.
+ *
+ * @param[in] depth
+ *          The depth d of the transform. depth >= 0.
+ *
+ * @param[in] u
+ *          The diagonals of the butterflies, of length depth*k, where k is
+ *          the order of U: the k entries of level l start at u[l*k].
+ *
+ * @param[in,out] A
+ *          On entry, the matrix to be transformed, of which U spans the
+ *          rows (side = PlasmaLeft) or the columns (side = PlasmaRight).
+ *          On exit, the transformed matrix.
+ *
+ ******************************************************************************/
+__attribute__((weak))
+void plasma_core_zgerbt(plasma_enum_t side, plasma_enum_t trans, int depth,
+                        const double *u, plasma_desc_t A)
+{
+    int k = side == PlasmaLeft ? A.m : A.n;
+
+    // op(U) applied on the left, or U^T on the right, is the product
+    // with the butterflies of the lowest level first.
+    int forward = (side == PlasmaLeft) == (trans == PlasmaNoTrans);
+    if (forward) {
+        for (int l = 0; l < depth; l++)
+            plasma_core_zgerbt_level(side, forward, A, l, 0, k, &u[l*k]);
+    }
+    else {
+        for (int l = depth-1; l >= 0; l--)
+            plasma_core_zgerbt_level(side, forward, A, l, 0, k, &u[l*k]);
+    }
+}
@@ -0,0 +1,158 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> c d s
+ *
+ **/
+
+#include <plasma_core_blas.h>
+#include "plasma_types.h"
+#include "plasma_internal.h"
+#include "core_lapack.h"
+
+#include <omp.h>
+
+/***************************************************************************//**
+ *
+ * @ingroup core_gessm
+ *
+ *  Applies the factors of plasma_core_zgetrf_incpiv() of a diagonal tile
+ *  to a tile A on its right:
+ *
+ *    A = L^{-1} * P * A
+ *
+ *  The row interchanges are followed by the triangular solve with the
+ *  k-by-k unit lower triangle of L and the update of the rows of A
+ *  below the k-th one with the rest of L.
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *          The number of rows of the tiles L and A. m >= 0.
+ *
+ * @param[in] n
+ *          The number of columns of the tile A. n >= 0.
+ *
+ * @param[in] k
+ *          The number of columns of the factor L. m >= k >= 0.
+ *
+ * @param[in] ipiv
+ *          The pivot indices of plasma_core_zgetrf_incpiv(), of length k.
+ *
+ * @param[in] L
+ *          The m-by-k unit lower trapezoidal factor of
+ *          plasma_core_zgetrf_incpiv().
+ *
+ * @param[in] ldl
+ *          The leading dimension of the array L. ldl >= max(1,m).
+ *
+ * @param[in,out] A
+ *          On entry, the m-by-n tile to be updated.
+ *          On exit, the tile A updated by L and the row interchanges.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A. lda >= max(1,m).
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ *
+ ******************************************************************************/
+__attribute__((weak))
+int plasma_core_zgessm(int m, int n, int k,
+                       const int *ipiv,
+                       const plasma_complex64_t *L, int ldl,
+                             plasma_complex64_t *A, int lda)
+{
+    // Check input arguments.
+    if (m < 0) {
+        plasma_coreblas_error("illegal value of m");
+        return -1;
+    }
+    if (n < 0) {
+        plasma_coreblas_error("illegal value of n");
+        return -2;
+    }
+    if (k < 0 || k > m) {
+        plasma_coreblas_error("illegal value of k");
+        return -3;
+    }
+    if (ipiv == NULL) {
+        plasma_coreblas_error("NULL ipiv");
+        return -4;
+    }
+    if (L == NULL) {
+        plasma_coreblas_error("NULL L");
+        return -5;
+    }
+    if (ldl < imax(1, m)) {
+        plasma_coreblas_error("illegal value of ldl");
+        return -6;
+    }
+    if (A == NULL) {
+        plasma_coreblas_error("NULL A");
+        return -7;
+    }
+    if (lda < imax(1, m)) {
+        plasma_coreblas_error("illegal value of lda");
+        return -8;
+    }
+
+    // quick return
+    if (m == 0 || n == 0 || k == 0)
+        return PlasmaSuccess;
+
+    plasma_complex64_t zone  =  1.0;
+    plasma_complex64_t zmone = -1.0;
+
+    LAPACKE_zlaswp_work(LAPACK_COL_MAJOR, n, A, lda, 1, k, ipiv, 1);
+
+    cblas_ztrsm(CblasColMajor,
+                CblasLeft, CblasLower,
+                CblasNoTrans, CblasUnit,
+                k, n,
+                CBLAS_SADDR(zone), L, ldl,
+                                   A, lda);
+
+    if (m > k) {
+        cblas_zgemm(CblasColMajor,
+                    CblasNoTrans, CblasNoTrans,
+                    m-k, n, k,
+                    CBLAS_SADDR(zmone), &L[k], ldl,
+                                        A, lda,
+                    CBLAS_SADDR(zone),  &A[k], lda);
+    }
+
+    return PlasmaSuccess;
+}
+
+/******************************************************************************/
+void plasma_core_omp_zgessm(int m, int n, int k,
+                            const int *ipiv,
+                            const plasma_complex64_t *L, int ldl,
+                                  plasma_complex64_t *A, int lda,
+                            plasma_sequence_t *sequence,
+                            plasma_request_t *request)
+{
+    #pragma omp task depend(in:ipiv[0:k]) \
+                     depend(in:L[0:ldl*k]) \
+                     depend(inout:A[0:lda*n])
+    {
+        if (sequence->status == PlasmaSuccess) {
+            int info = plasma_core_zgessm(m, n, k,
+                                          ipiv,
+                                          L, ldl,
+                                          A, lda);
+            if (info != PlasmaSuccess) {
+                plasma_error("core_zgessm() failed");
+                plasma_request_fail(sequence, request, PlasmaErrorInternal);
+            }
+        }
+    }
+}
@@ -23,216 +23,238 @@
 
 #define A(m, n) (plasma_complex64_t*)plasma_tile_addr(A, m, n)
 
-/******************************************************************************/
-__attribute__((weak))
-void plasma_core_zgetrf(plasma_desc_t A, int *ipiv, int ib, int rank, int size,
-                 volatile int *max_idx, volatile plasma_complex64_t *max_val,
-                 volatile int *info, plasma_barrier_t *barrier)
+/***************************************************************************//**
+ *  Factors columns j0 to j0+n-1 of the panel one at a time, with rank-1
+ *  updates restricted to these columns. Row interchanges span the whole
+ *  panel, so that no pivoting is left to apply afterwards.
+ ******************************************************************************/
+static void plasma_core_zgetrf_leaf(
+    plasma_desc_t A, int *ipiv, int j0, int n, int rank, int size,
+    plasma_pivot_t *pivot,
+    volatile int *info, plasma_barrier_t *barrier, double sfmin)
 {
-    double sfmin = LAPACKE_dlamch_work('S');
-    for (int k = 0; k < imin(A.m, A.n); k += ib) {
-        int kb = imin(imin(A.m, A.n)-k, ib);
-
-        plasma_complex64_t *a0 = A(0, 0);
-        int lda0 = plasma_tile_mmain(A, 0);
-        int mva0 = plasma_tile_mview(A, 0);
-        int nva0 = plasma_tile_nview(A, 0);
-
-        //======================
-        // panel factorization
-        //======================
-        for (int j = k; j < k+kb; j++) {
-            // pivot search
-            max_idx[rank] = 0;
-            max_val[rank] = a0[j+j*lda0];
-
-            for (int l = rank; l < A.mt; l += size) {
-                plasma_complex64_t *al = A(l, 0);
-                int ldal = plasma_tile_mmain(A, l);
-                int mval = plasma_tile_mview(A, l);
-
-                if (l == 0) {
-                    for (int i = 1; i < mva0-j; i++)
-                        if (plasma_core_dcabs1(a0[j+i+j*lda0]) >
-                            plasma_core_dcabs1(max_val[rank])) {
-
-                            max_val[rank] = a0[j+i+j*lda0];
-                            max_idx[rank] = i;
-                        }
-                }
-                else {
-                    for (int i = 0; i < mval; i++)
-                        if (plasma_core_dcabs1(al[i+j*ldal]) >
-                            plasma_core_dcabs1(max_val[rank])) {
+    plasma_complex64_t *a0 = A(0, 0);
+    int lda0 = plasma_tile_mmain(A, 0);
+    int mva0 = plasma_tile_mview(A, 0);
+    int nva0 = plasma_tile_nview(A, 0);
 
-                            max_val[rank] = al[i+j*ldal];
-                            max_idx[rank] = A.mb*l+i-j;
-                        }
-                }
+    for (int j = j0; j < j0+n; j++) {
+        // pivot search in the tiles of the rank
+        double value = -1.0;
+        int index = -1;
+        for (int l = rank; l < A.mt; l += size) {
+            plasma_complex64_t *al = A(l, 0);
+            int ldal = plasma_tile_mmain(A, l);
+            int mval = plasma_tile_mview(A, l);
+
+            double amax;
+            int i;
+            if (l == 0) {
+                i = plasma_core_izamax(mva0-j, &a0[j+j*lda0], &amax);
+                i += j;
             }
+            else {
+                i = plasma_core_izamax(mval, &al[j*ldal], &amax);
+                i += A.mb*l;
+            }
+            // Tiles are visited top down, so ties keep the upper row.
+            if (amax > value) {
+                value = amax;
+                index = i;
+            }
+        }
+        pivot[rank].value = value;
+        pivot[rank].index = index;
 
-            plasma_barrier_wait(barrier, size);
-            if (rank == 0)
-            {
-                // max reduction
-                for (int i = 1; i < size; i++) {
-                    if (plasma_core_dcabs1(max_val[i]) >
-                        plasma_core_dcabs1(max_val[0])) {
-                        max_val[0] = max_val[i];
-                        max_idx[0] = max_idx[i];
-                    }
+        plasma_barrier_wait(barrier, rank, size);
+        if (rank == 0)
+        {
+            // max reduction, keeping the upper row on ties, as LAPACK
+            for (int r = 1; r < size; r++) {
+                if (pivot[r].value > value ||
+                    (pivot[r].value == value && pivot[r].index < index)) {
+                    value = pivot[r].value;
+                    index = pivot[r].index;
                 }
+            }
 
-                // pivot adjustment
-                int jp = j+max_idx[0];
-                ipiv[j] = jp-k+1;
+            // pivot adjustment
+            int jp = index;
+            ipiv[j] = jp+1;
 
-                // singularity check
-                if (*info == 0 && max_val[0] == 0.0) {
-                    *info = j+1;
-                }
-                else {
-                    // pivot swap
-                    if (jp != j) {
-                        plasma_complex64_t *ap = A(jp/A.mb, 0);
-                        int ldap = plasma_tile_mmain(A, jp/A.mb);
-
-                        cblas_zswap(kb,
-                                    &a0[j+k*lda0], lda0,
-                                    &ap[jp%A.mb+k*ldap], ldap);
-                    }
+            // singularity check
+            if (*info == 0 && value == 0.0) {
+                *info = j+1;
+            }
+            else {
+                // pivot swap
+                if (jp != j) {
+                    plasma_complex64_t *ap = A(jp/A.mb, 0);
+                    int ldap = plasma_tile_mmain(A, jp/A.mb);
+
+                    cblas_zswap(nva0,
+                                &a0[j], lda0,
+                                &ap[jp%A.mb], ldap);
                 }
             }
-            plasma_barrier_wait(barrier, size);
-
-            // column scaling and trailing update (all ranks)
-            for (int l = rank; l < A.mt; l += size) {
-                plasma_complex64_t *al = A(l, 0);
-                int ldal = plasma_tile_mmain(A, l);
-                int mval = plasma_tile_mview(A, l);
-
-                if (*info == 0) {
-                    // column scaling
-                    if (cabs(a0[j+j*lda0]) >= sfmin) {
-                        if (l == 0) {
-                            for (int i = 1; i < mva0-j; i++)
-                                a0[j+i+j*lda0] /= a0[j+j*lda0];
-                        }
-                        else {
-                            for (int i = 0; i < mval; i++)
-                                al[i+j*ldal] /= a0[j+j*lda0];
-                        }
+        }
+        plasma_barrier_wait(barrier, rank, size);
+
+        // column scaling and trailing update (all ranks)
+        for (int l = rank; l < A.mt; l += size) {
+            plasma_complex64_t *al = A(l, 0);
+            int ldal = plasma_tile_mmain(A, l);
+            int mval = plasma_tile_mview(A, l);
+
+            // Skip a zero pivot but keep factorizing, as LAPACK does.
+            if (a0[j+j*lda0] != 0.0) {
+                // column scaling
+                if (cabs(a0[j+j*lda0]) >= sfmin) {
+                    if (l == 0) {
+                        for (int i = 1; i < mva0-j; i++)
+                            a0[j+i+j*lda0] /= a0[j+j*lda0];
                     }
                     else {
-                        plasma_complex64_t scal = 1.0/a0[j+j*lda0];
-                        if (l == 0)
-                            cblas_zscal(mva0-j-1, CBLAS_SADDR(scal),
-                                        &a0[j+1+j*lda0], 1);
-                        else
-                            cblas_zscal(mval, CBLAS_SADDR(scal),
-                                        &al[j*ldal], 1);
+                        for (int i = 0; i < mval; i++)
+                            al[i+j*ldal] /= a0[j+j*lda0];
                     }
                 }
-
-                // trailing update
-                plasma_complex64_t zmone = -1.0;
-                if (l == 0) {
-                    cblas_zgeru(CblasColMajor,
-                                mva0-j-1, k+kb-j-1,
-                                CBLAS_SADDR(zmone), &a0[j+1+j*lda0], 1,
-                                                    &a0[j+(j+1)*lda0], lda0,
-                                                    &a0[j+1+(j+1)*lda0], lda0);
-                }
                 else {
-                    cblas_zgeru(CblasColMajor,
-                                mval, k+kb-j-1,
-                                CBLAS_SADDR(zmone), &al[+j*ldal], 1,
-                                                    &a0[j+(j+1)*lda0], lda0,
-                                                    &al[+(j+1)*ldal], ldal);
+                    plasma_complex64_t scal = 1.0/a0[j+j*lda0];
+                    if (l == 0)
+                        cblas_zscal(mva0-j-1, CBLAS_SADDR(scal),
+                                    &a0[j+1+j*lda0], 1);
+                    else
+                        cblas_zscal(mval, CBLAS_SADDR(scal),
+                                    &al[j*ldal], 1);
                 }
             }
-            plasma_barrier_wait(barrier, size);
-        }
-
-        //===================================
-        // right pivoting and trsm (rank 0)
-        //===================================
-        plasma_barrier_wait(barrier, size);
-        if (rank == 0) {
-            // pivot adjustment
-            for (int i = k+1; i <= imin(A.m, k+kb); i++)
-                ipiv[i-1] += k;
-
-            // right pivoting
-            for (int i = k; i < k+kb; i++) {
-                plasma_complex64_t *ap = A((ipiv[i]-1)/A.mb, 0);
-                int ldap = plasma_tile_mmain(A, (ipiv[i]-1)/A.mb);
-
-                cblas_zswap(nva0-k-kb,
-                            &a0[i+(k+kb)*lda0], lda0,
-                            &ap[(ipiv[i]-1)%A.mb+(k+kb)*ldap], ldap);
-            }
-            // trsm
-            plasma_complex64_t zone = 1.0;
-            cblas_ztrsm(CblasColMajor,
-                        CblasLeft, CblasLower,
-                        CblasNoTrans, CblasUnit,
-                        kb,
-                        nva0-k-kb,
-                        CBLAS_SADDR(zone), &a0[k+k*lda0], lda0,
-                                           &a0[k+(k+kb)*lda0], lda0);
-        }
-        plasma_barrier_wait(barrier, size);
 
-        //===================
-        // gemm (all ranks)
-        //===================
-        plasma_complex64_t zone = 1.0;
-        plasma_complex64_t zmone = -1.0;
-        for (int i = rank; i < A.mt; i += size) {
-            plasma_complex64_t *ai = A(i, 0);
-            int mvai = plasma_tile_mview(A, i);
-            int ldai = plasma_tile_mmain(A, i);
-
-            if (i == 0) {
-                cblas_zgemm(CblasColMajor,
-                            CblasNoTrans, CblasNoTrans,
-                            mva0-k-kb,
-                            nva0-k-kb,
-                            kb,
-                            CBLAS_SADDR(zmone), &a0[k+kb+k*lda0], lda0,
-                                                &a0[k+(k+kb)*lda0], lda0,
-                            CBLAS_SADDR(zone),  &a0[(k+kb)+(k+kb)*lda0], lda0);
+            // trailing update
+            plasma_complex64_t zmone = -1.0;
+            if (l == 0) {
+                cblas_zgeru(CblasColMajor,
+                            mva0-j-1, j0+n-j-1,
+                            CBLAS_SADDR(zmone), &a0[j+1+j*lda0], 1,
+                                                &a0[j+(j+1)*lda0], lda0,
+                                                &a0[j+1+(j+1)*lda0], lda0);
             }
             else {
-                cblas_zgemm(CblasColMajor,
-                            CblasNoTrans, CblasNoTrans,
-                            mvai,
-                            nva0-k-kb,
-                            kb,
-                            CBLAS_SADDR(zmone), &ai[k*ldai], ldai,
-                                                &a0[k+(k+kb)*lda0], lda0,
-                            CBLAS_SADDR(zone),  &ai[(k+kb)*ldai], ldai);
+                cblas_zgeru(CblasColMajor,
+                            mval, j0+n-j-1,
+                            CBLAS_SADDR(zmone), &al[+j*ldal], 1,
+                                                &a0[j+(j+1)*lda0], lda0,
+                                                &al[+(j+1)*ldal], ldal);
             }
         }
-        plasma_barrier_wait(barrier, size);
+        // Each rank updates its own tiles, which it searches next,
+        // and the barrier after the next search protects the swap.
     }
+}
 
-    //============================
-    // left pivoting (all ranks)
-    //============================
-    for (int k = ib; k < imin(A.m, A.n); k += ib) {
-        if (k%ib == rank) {
-            for (int i = k; i < imin(A.m, A.n); i++) {
-                plasma_complex64_t *ai = A(i/A.mb, 0);
-                plasma_complex64_t *ap = A((ipiv[i]-1)/A.mb, 0);
-                int ldai = plasma_tile_mmain(A, (i/A.mb));
-                int ldap = plasma_tile_mmain(A, (ipiv[i]-1)/A.mb);
-
-                cblas_zswap(ib,
-                            &ai[i%A.mb+(k-ib)*ldai], ldai,
-                            &ap[(ipiv[i]-1)%A.mb+(k-ib)*ldap], ldap);
-            }
+/***************************************************************************//**
+ *  Factors columns j0 to j0+n-1 of the panel recursively: the left half,
+ *  then the trsm (rank 0) and gemm (all ranks) updating the right half,
+ *  then the right half. Blocks of at most ib columns are factored by
+ *  plasma_core_zgetrf_leaf(), so most of the flops are in the gemms.
+ ******************************************************************************/
+static void plasma_core_zgetrf_rec(
+    plasma_desc_t A, int *ipiv, int j0, int n, int ib, int rank, int size,
+    plasma_pivot_t *pivot,
+    volatile int *info, plasma_barrier_t *barrier, double sfmin)
+{
+    if (n <= ib) {
+        plasma_core_zgetrf_leaf(A, ipiv, j0, n, rank, size,
+                                pivot, info, barrier, sfmin);
+        return;
+    }
+
+    int n1 = n/2;
+    int n2 = n-n1;
+    int j1 = j0+n1;
+
+    plasma_core_zgetrf_rec(A, ipiv, j0, n1, ib, rank, size,
+                           pivot, info, barrier, sfmin);
+
+    plasma_complex64_t *a0 = A(0, 0);
+    int lda0 = plasma_tile_mmain(A, 0);
+    int mva0 = plasma_tile_mview(A, 0);
+
+    //===============
+    // trsm (rank 0)
+    //===============
+    plasma_complex64_t zone = 1.0;
+    plasma_complex64_t zmone = -1.0;
+    if (rank == 0) {
+        cblas_ztrsm(CblasColMajor,
+                    CblasLeft, CblasLower,
+                    CblasNoTrans, CblasUnit,
+                    n1, n2,
+                    CBLAS_SADDR(zone), &a0[j0+j0*lda0], lda0,
+                                       &a0[j0+j1*lda0], lda0);
+    }
+    plasma_barrier_wait(barrier, rank, size);
+
+    //===================
+    // gemm (all ranks)
+    //===================
+    for (int i = rank; i < A.mt; i += size) {
+        plasma_complex64_t *ai = A(i, 0);
+        int mvai = plasma_tile_mview(A, i);
+        int ldai = plasma_tile_mmain(A, i);
+
+        if (i == 0) {
+            cblas_zgemm(CblasColMajor,
+                        CblasNoTrans, CblasNoTrans,
+                        mva0-j1, n2, n1,
+                        CBLAS_SADDR(zmone), &a0[j1+j0*lda0], lda0,
+                                            &a0[j0+j1*lda0], lda0,
+                        CBLAS_SADDR(zone),  &a0[j1+j1*lda0], lda0);
+        }
+        else {
+            cblas_zgemm(CblasColMajor,
+                        CblasNoTrans, CblasNoTrans,
+                        mvai, n2, n1,
+                        CBLAS_SADDR(zmone), &ai[j0*ldai], ldai,
+                                            &a0[j0+j1*lda0], lda0,
+                        CBLAS_SADDR(zone),  &ai[j1*ldai], ldai);
         }
     }
+    // As in the leaf, no barrier is needed before the right half.
+
+    plasma_core_zgetrf_rec(A, ipiv, j1, n2, ib, rank, size,
+                           pivot, info, barrier, sfmin);
+}
+
+/***************************************************************************//**
+ *  Multithreaded recursive LU factorization of the panel A with partial
+ *  pivoting. The size ranks cooperate on the row tiles of A and
+ *  synchronize through the barrier, publishing their pivot candidates
+ *  in pivot, an array of size entries. On exit, ipiv holds the pivots
+ *  relative to the top of the panel, as in LAPACK.
+ ******************************************************************************/
+__attribute__((weak))
+void plasma_core_zgetrf(plasma_desc_t A, int *ipiv, int ib, int rank, int size,
+                 plasma_pivot_t *pivot,
+                 volatile int *info, plasma_barrier_t *barrier)
+{
+    double sfmin = LAPACKE_dlamch_work('S');
+    int minmn = imin(A.m, A.n);
+
+    plasma_core_zgetrf_rec(A, ipiv, 0, minmn, imax(ib, 1), rank, size,
+                           pivot, info, barrier, sfmin);
+
+    // Columns right of a short panel only need the trsm.
+    plasma_complex64_t *a0 = A(0, 0);
+    int lda0 = plasma_tile_mmain(A, 0);
+    int nva0 = plasma_tile_nview(A, 0);
+    if (rank == 0 && nva0 > minmn) {
+        plasma_complex64_t zone = 1.0;
+        cblas_ztrsm(CblasColMajor,
+                    CblasLeft, CblasLower,
+                    CblasNoTrans, CblasUnit,
+                    minmn, nva0-minmn,
+                    CBLAS_SADDR(zone), a0, lda0,
+                                       &a0[minmn*lda0], lda0);
+    }
 }
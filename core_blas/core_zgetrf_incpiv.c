@@ -0,0 +1,109 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> c d s
+ *
+ **/
+
+#include <plasma_core_blas.h>
+#include "plasma_types.h"
+#include "plasma_internal.h"
+#include "core_lapack.h"
+
+#include <omp.h>
+
+/***************************************************************************//**
+ *
+ * @ingroup core_getrf_incpiv
+ *
+ *  Computes an LU factorization of an m-by-n tile A with partial pivoting
+ *  restricted to the rows of the tile. This is the diagonal step of the
+ *  LU factorization with incremental pivoting:
+ *
+ *    A = P * L * U
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *          The number of rows of the tile A. m >= 0.
+ *
+ * @param[in] n
+ *          The number of columns of the tile A. n >= 0.
+ *
+ * @param[in,out] A
+ *          On entry, the m-by-n tile to be factored.
+ *          On exit, the factors L and U; the unit diagonal elements of L
+ *          are not stored.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A. lda >= max(1,m).
+ *
+ * @param[out] ipiv
+ *          The pivot indices, of length min(m,n); for 1 <= i <= min(m,n),
+ *          row i of the tile was interchanged with row ipiv[i-1].
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ * @retval > 0 if i, U(i,i) is exactly zero
+ *
+ ******************************************************************************/
+__attribute__((weak))
+int plasma_core_zgetrf_incpiv(int m, int n,
+                              plasma_complex64_t *A, int lda, int *ipiv)
+{
+    // Check input arguments.
+    if (m < 0) {
+        plasma_coreblas_error("illegal value of m");
+        return -1;
+    }
+    if (n < 0) {
+        plasma_coreblas_error("illegal value of n");
+        return -2;
+    }
+    if (A == NULL) {
+        plasma_coreblas_error("NULL A");
+        return -3;
+    }
+    if (lda < imax(1, m)) {
+        plasma_coreblas_error("illegal value of lda");
+        return -4;
+    }
+    if (ipiv == NULL) {
+        plasma_coreblas_error("NULL ipiv");
+        return -5;
+    }
+
+    // quick return
+    if (m == 0 || n == 0)
+        return PlasmaSuccess;
+
+    return LAPACKE_zgetrf_work(LAPACK_COL_MAJOR, m, n, A, lda, ipiv);
+}
+
+/******************************************************************************/
+void plasma_core_omp_zgetrf_incpiv(int m, int n,
+                                   plasma_complex64_t *A, int lda, int *ipiv,
+                                   plasma_sequence_t *sequence,
+                                   plasma_request_t *request)
+{
+    #pragma omp task depend(inout:A[0:lda*n]) \
+                     depend(out:ipiv[0:imin(m, n)])
+    {
+        if (sequence->status == PlasmaSuccess) {
+            // A zero pivot is not an error here, as the rows of the tiles
+            // below may still replace it.
+            int info = plasma_core_zgetrf_incpiv(m, n, A, lda, ipiv);
+            if (info < 0) {
+                plasma_error("core_zgetrf_incpiv() failed");
+                plasma_request_fail(sequence, request, PlasmaErrorInternal);
+            }
+        }
+    }
+}
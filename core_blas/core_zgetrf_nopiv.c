@@ -0,0 +1,162 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> c d s
+ *
+ **/
+
+#include <plasma_core_blas.h>
+#include "plasma_types.h"
+#include "plasma_internal.h"
+#include "core_lapack.h"
+
+#include <omp.h>
+
+/***************************************************************************//**
+ *
+ * @ingroup core_getrf_nopiv
+ *
+ *  Computes an LU factorization of an m-by-n tile A without pivoting:
+ *
+ *    A = L * U
+ *
+ *  The tile is factored by panels of ib columns, each of them followed by
+ *  the update of the trailing columns with level 3 BLAS. It is meant for
+ *  matrices which need no pivoting, such as the ones randomized by
+ *  plasma_core_zgerbt().
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *          The number of rows of the tile A. m >= 0.
+ *
+ * @param[in] n
+ *          The number of columns of the tile A. n >= 0.
+ *
+ * @param[in] ib
+ *          The inner-blocking size. ib >= 0.
+ *
+ * @param[in,out] A
+ *          On entry, the m-by-n tile to be factored.
+ *          On exit, the factors L and U; the unit diagonal elements of L
+ *          are not stored.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A. lda >= max(1,m).
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ * @retval > 0 if i, U(i,i) is exactly zero; the columns below it are
+ *         not scaled
+ *
+ ******************************************************************************/
+__attribute__((weak))
+int plasma_core_zgetrf_nopiv(int m, int n, int ib,
+                             plasma_complex64_t *A, int lda)
+{
+    // Check input arguments.
+    if (m < 0) {
+        plasma_coreblas_error("illegal value of m");
+        return -1;
+    }
+    if (n < 0) {
+        plasma_coreblas_error("illegal value of n");
+        return -2;
+    }
+    if (ib < 0) {
+        plasma_coreblas_error("illegal value of ib");
+        return -3;
+    }
+    if (A == NULL) {
+        plasma_coreblas_error("NULL A");
+        return -4;
+    }
+    if (lda < imax(1, m)) {
+        plasma_coreblas_error("illegal value of lda");
+        return -5;
+    }
+
+    // quick return
+    if (m == 0 || n == 0 || ib == 0)
+        return PlasmaSuccess;
+
+    plasma_complex64_t zone  =  1.0;
+    plasma_complex64_t zmone = -1.0;
+
+    int info = 0;
+    int k = imin(m, n);
+    for (int i = 0; i < k; i += ib) {
+        int sb = imin(ib, k-i);
+
+        // Factor the panel of sb columns.
+        for (int ii = i; ii < i+sb; ii++) {
+            plasma_complex64_t piv = A[ii+lda*ii];
+            if (piv == 0.0) {
+                if (info == 0)
+                    info = ii+1;
+            }
+            else if (ii+1 < m) {
+                plasma_complex64_t alpha = 1.0/piv;
+                cblas_zscal(m-ii-1, CBLAS_SADDR(alpha), &A[ii+1+lda*ii], 1);
+            }
+            if (ii+1 < i+sb && ii+1 < m) {
+                cblas_zgeru(CblasColMajor,
+                            m-ii-1, i+sb-ii-1,
+                            CBLAS_SADDR(zmone), &A[ii+1+lda*ii], 1,
+                                                &A[ii+lda*(ii+1)], lda,
+                                                &A[ii+1+lda*(ii+1)], lda);
+            }
+        }
+
+        // Update the trailing columns.
+        if (i+sb < n) {
+            cblas_ztrsm(CblasColMajor,
+                        CblasLeft, CblasLower,
+                        CblasNoTrans, CblasUnit,
+                        sb, n-i-sb,
+                        CBLAS_SADDR(zone), &A[i+lda*i], lda,
+                                           &A[i+lda*(i+sb)], lda);
+
+            if (i+sb < m) {
+                cblas_zgemm(CblasColMajor,
+                            CblasNoTrans, CblasNoTrans,
+                            m-i-sb, n-i-sb, sb,
+                            CBLAS_SADDR(zmone), &A[i+sb+lda*i], lda,
+                                                &A[i+lda*(i+sb)], lda,
+                            CBLAS_SADDR(zone),  &A[i+sb+lda*(i+sb)], lda);
+            }
+        }
+    }
+
+    return info;
+}
+
+/******************************************************************************/
+void plasma_core_omp_zgetrf_nopiv(int m, int n, int ib,
+                                  plasma_complex64_t *A, int lda,
+                                  int iinfo,
+                                  plasma_sequence_t *sequence,
+                                  plasma_request_t *request)
+{
+    #pragma omp task depend(inout:A[0:lda*n])
+    {
+        if (sequence->status == PlasmaSuccess) {
+            int info = plasma_core_zgetrf_nopiv(m, n, ib, A, lda);
+            if (info < 0) {
+                plasma_error("core_zgetrf_nopiv() failed");
+                plasma_request_fail(sequence, request, PlasmaErrorInternal);
+            }
+            else if (info > 0) {
+                // Record the first zero pivot, as plasma_zgetrf() does.
+                __sync_bool_compare_and_swap(&sequence->info, 0, iinfo+info);
+            }
+        }
+    }
+}
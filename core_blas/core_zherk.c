@@ -11,6 +11,7 @@
  **/
 
 #include <plasma_core_blas.h>
+#include "plasma_internal.h"
 #include "plasma_types.h"
 #include "core_lapack.h"
 
@@ -97,7 +98,8 @@ void plasma_core_omp_zherk(plasma_enum_t uplo, plasma_enum_t trans,
         ak = n;
 
     #pragma omp task depend(in:A[0:lda*ak]) \
-                     depend(inout:C[0:ldc*n])
+                     depend(inout:C[0:ldc*n]) \
+                     affinity(C[0:ldc*n])
     {
         if (sequence->status == PlasmaSuccess)
             plasma_core_zherk(uplo, trans,
@@ -106,3 +108,47 @@ void plasma_core_omp_zherk(plasma_enum_t uplo, plasma_enum_t trans,
                        beta,  C, ldc);
     }
 }
+
+/******************************************************************************/
+typedef struct {
+    plasma_enum_t uplo, trans;
+    int n, k;
+    double alpha;
+    const plasma_complex64_t *A;
+    int lda;
+    double beta;
+    plasma_complex64_t *C;
+    int ldc;
+} plasma_core_rt_zherk_args_t;
+
+static void plasma_core_rt_zherk_task(void *args,
+                                      plasma_sequence_t *sequence,
+                                      plasma_request_t *request)
+{
+    plasma_core_rt_zherk_args_t *a = (plasma_core_rt_zherk_args_t*)args;
+    if (sequence->status == PlasmaSuccess)
+        plasma_core_zherk(a->uplo, a->trans,
+                   a->n, a->k,
+                   a->alpha, a->A, a->lda,
+                   a->beta,  a->C, a->ldc);
+}
+
+/******************************************************************************/
+void plasma_core_rt_zherk(plasma_dag_t *dag,
+                   plasma_enum_t uplo, plasma_enum_t trans,
+                   int n, int k,
+                   double alpha, const plasma_complex64_t *A, int lda,
+                   double beta,        plasma_complex64_t *C, int ldc,
+                   plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    plasma_core_rt_zherk_args_t args = {
+        uplo, trans, n, k, alpha, A, lda, beta, C, ldc
+    };
+    plasma_dep_t deps[] = {
+        {A, PlasmaDepIn, offsetof(plasma_core_rt_zherk_args_t, A)},
+        {C, PlasmaDepInout, offsetof(plasma_core_rt_zherk_args_t, C)}
+    };
+    if (plasma_dag_insert(dag, plasma_core_rt_zherk_task,
+                          &args, sizeof(args), 2, deps) != PlasmaSuccess)
+        plasma_request_fail(sequence, request, PlasmaErrorOutOfMemory);
+}
@@ -140,7 +140,7 @@ void plasma_core_zheswp(int rank, int num_threads,
                                     A(m2, m2) + i2 + i2*lda2, lda2);
                     }
                 }
-                plasma_barrier_wait(barrier, num_threads);
+                plasma_barrier_wait(barrier, rank, num_threads);
             }
         }
     }
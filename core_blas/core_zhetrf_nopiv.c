@@ -0,0 +1,125 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> c d s
+ *
+ **/
+
+#include <plasma_core_blas.h>
+#include "plasma_types.h"
+#include "plasma_internal.h"
+#include "core_lapack.h"
+
+#include <omp.h>
+
+/***************************************************************************//**
+ *
+ * @ingroup core_hetrf_nopiv
+ *
+ *  Computes the LDL^H factorization of a Hermitian n-by-n tile A
+ *  without pivoting:
+ *
+ *    A = L * D * L^H,
+ *
+ *  where L is unit lower triangular and D is diagonal and real.
+ *  It is meant for matrices which need no pivoting, such as the ones
+ *  randomized by plasma_core_zgerbt().
+ *
+ *******************************************************************************
+ *
+ * @param[in] uplo
+ *          - PlasmaLower: Lower triangle of A is stored.
+ *          Only PlasmaLower is supported.
+ *
+ * @param[in] n
+ *          The order of the tile A. n >= 0.
+ *
+ * @param[in,out] A
+ *          On entry, the lower triangle of the Hermitian tile A.
+ *          On exit, D on the diagonal and the factor L below it;
+ *          the unit diagonal elements of L are not stored.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A. lda >= max(1,n).
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ * @retval > 0 if i, D(i,i) is exactly zero; the column below it is
+ *         not scaled
+ *
+ ******************************************************************************/
+__attribute__((weak))
+int plasma_core_zhetrf_nopiv(plasma_enum_t uplo, int n,
+                             plasma_complex64_t *A, int lda)
+{
+    // Check input arguments.
+    if (uplo != PlasmaLower) {
+        plasma_coreblas_error("illegal value of uplo");
+        return -1;
+    }
+    if (n < 0) {
+        plasma_coreblas_error("illegal value of n");
+        return -2;
+    }
+    if (A == NULL) {
+        plasma_coreblas_error("NULL A");
+        return -3;
+    }
+    if (lda < imax(1, n)) {
+        plasma_coreblas_error("illegal value of lda");
+        return -4;
+    }
+
+    int info = 0;
+    for (int j = 0; j < n; j++) {
+        double d = creal(A[j+lda*j]);
+        A[j+lda*j] = d;
+        if (d == 0.0) {
+            if (info == 0)
+                info = j+1;
+            continue;
+        }
+        if (j+1 < n) {
+            // A(j+1:n, j+1:n) -= v * v^H / d, then L(j+1:n, j) = v / d.
+            cblas_zher(CblasColMajor, CblasLower,
+                       n-j-1,
+                       -1.0/d, &A[j+1+lda*j], 1,
+                               &A[j+1+lda*(j+1)], lda);
+
+            plasma_complex64_t alpha = 1.0/d;
+            cblas_zscal(n-j-1, CBLAS_SADDR(alpha), &A[j+1+lda*j], 1);
+        }
+    }
+
+    return info;
+}
+
+/******************************************************************************/
+void plasma_core_omp_zhetrf_nopiv(plasma_enum_t uplo, int n,
+                                  plasma_complex64_t *A, int lda,
+                                  int iinfo,
+                                  plasma_sequence_t *sequence,
+                                  plasma_request_t *request)
+{
+    #pragma omp task depend(inout:A[0:lda*n])
+    {
+        if (sequence->status == PlasmaSuccess) {
+            int info = plasma_core_zhetrf_nopiv(uplo, n, A, lda);
+            if (info < 0) {
+                plasma_error("core_zhetrf_nopiv() failed");
+                plasma_request_fail(sequence, request, PlasmaErrorInternal);
+            }
+            else if (info > 0) {
+                // Record the first zero pivot, as plasma_zgetrf() does.
+                __sync_bool_compare_and_swap(&sequence->info, 0, iinfo+info);
+            }
+        }
+    }
+}
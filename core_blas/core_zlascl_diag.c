@@ -0,0 +1,88 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> c d s
+ *
+ **/
+
+#include <plasma_core_blas.h>
+#include "plasma_types.h"
+#include "plasma_internal.h"
+#include "core_lapack.h"
+
+#include <omp.h>
+
+/***************************************************************************//**
+ *
+ * @ingroup core_lascl_diag
+ *
+ *  Scales the rows or the columns of an m-by-n tile A by the inverse
+ *  of a diagonal matrix D:
+ *
+ *    A = D^{-1} * A  or  A = A * D^{-1}.
+ *
+ *******************************************************************************
+ *
+ * @param[in] side
+ *          - PlasmaLeft:  A = D^{-1} * A, D is m-by-m,
+ *          - PlasmaRight: A = A * D^{-1}, D is n-by-n.
+ *
+ * @param[in] m
+ *          The number of rows of the tile A. m >= 0.
+ *
+ * @param[in] n
+ *          The number of columns of the tile A. n >= 0.
+ *
+ * @param[in] D
+ *          The diagonal of D, e.g., the diagonal of a tile factored by
+ *          plasma_core_zhetrf_nopiv().
+ *
+ * @param[in] incd
+ *          The stride between the diagonal elements of D. incd > 0.
+ *
+ * @param[in,out] A
+ *          On entry, the m-by-n tile to be scaled.
+ *          On exit, the scaled tile.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A. lda >= max(1,m).
+ *
+ ******************************************************************************/
+__attribute__((weak))
+void plasma_core_zlascl_diag(plasma_enum_t side, int m, int n,
+                             const plasma_complex64_t *D, int incd,
+                                   plasma_complex64_t *A, int lda)
+{
+    if (side == PlasmaLeft) {
+        for (int j = 0; j < n; j++)
+            for (int i = 0; i < m; i++)
+                A[i+lda*j] /= D[incd*i];
+    }
+    else {
+        for (int j = 0; j < n; j++) {
+            plasma_complex64_t alpha = 1.0/D[incd*j];
+            cblas_zscal(m, CBLAS_SADDR(alpha), &A[lda*j], 1);
+        }
+    }
+}
+
+/******************************************************************************/
+void plasma_core_omp_zlascl_diag(plasma_enum_t side, int m, int n,
+                                 const plasma_complex64_t *D, int incd,
+                                       plasma_complex64_t *A, int lda,
+                                 plasma_sequence_t *sequence,
+                                 plasma_request_t *request)
+{
+    int k = side == PlasmaLeft ? m : n;
+    #pragma omp task depend(in:D[0:incd*k]) \
+                     depend(inout:A[0:lda*n])
+    {
+        if (sequence->status == PlasmaSuccess)
+            plasma_core_zlascl_diag(side, m, n, D, incd, A, lda);
+    }
+}
@@ -80,3 +80,45 @@ void plasma_core_omp_zpotrf(plasma_enum_t uplo,
         }
     }
 }
+
+/******************************************************************************/
+typedef struct {
+    plasma_enum_t uplo;
+    int n;
+    plasma_complex64_t *A;
+    int lda;
+    int iinfo;
+} plasma_core_rt_zpotrf_args_t;
+
+static void plasma_core_rt_zpotrf_task(void *args,
+                                       plasma_sequence_t *sequence,
+                                       plasma_request_t *request)
+{
+    plasma_core_rt_zpotrf_args_t *a = (plasma_core_rt_zpotrf_args_t*)args;
+    if (sequence->status == PlasmaSuccess) {
+        int info = plasma_core_zpotrf(a->uplo,
+                               a->n,
+                               a->A, a->lda);
+        if (info != 0)
+            plasma_request_fail(sequence, request, a->iinfo+info);
+    }
+}
+
+/******************************************************************************/
+void plasma_core_rt_zpotrf(plasma_dag_t *dag,
+                    plasma_enum_t uplo,
+                    int n,
+                    plasma_complex64_t *A, int lda,
+                    int iinfo,
+                    plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    plasma_core_rt_zpotrf_args_t args = {
+        uplo, n, A, lda, iinfo
+    };
+    plasma_dep_t deps[] = {
+        {A, PlasmaDepInout, offsetof(plasma_core_rt_zpotrf_args_t, A)}
+    };
+    if (plasma_dag_insert(dag, plasma_core_rt_zpotrf_task,
+                          &args, sizeof(args), 1, deps) != PlasmaSuccess)
+        plasma_request_fail(sequence, request, PlasmaErrorOutOfMemory);
+}
@@ -0,0 +1,229 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> c d s
+ *
+ **/
+
+#include <plasma_core_blas.h>
+#include "plasma_types.h"
+#include "plasma_internal.h"
+#include "core_lapack.h"
+
+#include <omp.h>
+
+/***************************************************************************//**
+ *
+ * @ingroup core_ssssm
+ *
+ *  Applies the factors of plasma_core_ztstrf() to a pair of tiles,
+ *  A1 on top of A2, on the right of the factored pair:
+ *
+ *    | A1 | = L^{-1} * P * | A1 |
+ *    | A2 |                | A2 |
+ *
+ *  For each block of ib columns of the factors, the rows of A1 are
+ *  interchanged with those of A2 they were pivoted with, then the rows
+ *  of A1 are solved with the unit lower triangle of the block of L1,
+ *  and A2 is updated with the block of L2.
+ *
+ *******************************************************************************
+ *
+ * @param[in] m1
+ *          The offset of the rows of A2 in ipiv, at least the number of
+ *          rows of the tile holding A1. m1 >= k.
+ *
+ * @param[in] n1
+ *          The number of columns of the tile A1. n1 >= 0.
+ *
+ * @param[in] m2
+ *          The number of rows of the tiles A2 and L2. m2 >= 0.
+ *
+ * @param[in] n2
+ *          The number of columns of the tile A2. n2 = n1.
+ *
+ * @param[in] k
+ *          The number of columns of the factors L1 and L2. k >= 0.
+ *
+ * @param[in] ib
+ *          The inner-blocking size. ib >= 0.
+ *
+ * @param[in,out] A1
+ *          On entry, the k-by-n1 tile A1.
+ *          On exit, the tile A1 updated by the factors.
+ *
+ * @param[in] lda1
+ *          The leading dimension of the array A1. lda1 >= max(1,k).
+ *
+ * @param[in,out] A2
+ *          On entry, the m2-by-n2 tile A2.
+ *          On exit, the tile A2 updated by the factors.
+ *
+ * @param[in] lda2
+ *          The leading dimension of the array A2. lda2 >= max(1,m2).
+ *
+ * @param[in] L1
+ *          The ib-by-k array of plasma_core_ztstrf() holding the blocks
+ *          of unit lower triangles of the rows pivoted up to A1.
+ *
+ * @param[in] ldl1
+ *          The leading dimension of the array L1. ldl1 >= max(1,ib).
+ *
+ * @param[in] L2
+ *          The m2-by-k factor of plasma_core_ztstrf() below A1.
+ *
+ * @param[in] ldl2
+ *          The leading dimension of the array L2. ldl2 >= max(1,m2).
+ *
+ * @param[in] ipiv
+ *          The pivot indices of plasma_core_ztstrf(), of length k;
+ *          a value i > m1 interchanges with row i-m1 of A2.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ *
+ ******************************************************************************/
+__attribute__((weak))
+int plasma_core_zssssm(int m1, int n1, int m2, int n2, int k, int ib,
+                             plasma_complex64_t *A1, int lda1,
+                             plasma_complex64_t *A2, int lda2,
+                       const plasma_complex64_t *L1, int ldl1,
+                       const plasma_complex64_t *L2, int ldl2,
+                       const int *ipiv)
+{
+    // Check input arguments.
+    if (m1 < 0) {
+        plasma_coreblas_error("illegal value of m1");
+        return -1;
+    }
+    if (n1 < 0) {
+        plasma_coreblas_error("illegal value of n1");
+        return -2;
+    }
+    if (m2 < 0) {
+        plasma_coreblas_error("illegal value of m2");
+        return -3;
+    }
+    if (n2 != n1) {
+        plasma_coreblas_error("illegal value of n2");
+        return -4;
+    }
+    if (k < 0 || k > m1) {
+        plasma_coreblas_error("illegal value of k");
+        return -5;
+    }
+    if (ib < 0) {
+        plasma_coreblas_error("illegal value of ib");
+        return -6;
+    }
+    if (A1 == NULL) {
+        plasma_coreblas_error("NULL A1");
+        return -7;
+    }
+    if (lda1 < imax(1, k)) {
+        plasma_coreblas_error("illegal value of lda1");
+        return -8;
+    }
+    if (A2 == NULL) {
+        plasma_coreblas_error("NULL A2");
+        return -9;
+    }
+    if (lda2 < imax(1, m2)) {
+        plasma_coreblas_error("illegal value of lda2");
+        return -10;
+    }
+    if (L1 == NULL) {
+        plasma_coreblas_error("NULL L1");
+        return -11;
+    }
+    if (ldl1 < imax(1, ib)) {
+        plasma_coreblas_error("illegal value of ldl1");
+        return -12;
+    }
+    if (L2 == NULL) {
+        plasma_coreblas_error("NULL L2");
+        return -13;
+    }
+    if (ldl2 < imax(1, m2)) {
+        plasma_coreblas_error("illegal value of ldl2");
+        return -14;
+    }
+    if (ipiv == NULL) {
+        plasma_coreblas_error("NULL ipiv");
+        return -15;
+    }
+
+    // quick return
+    if (m1 == 0 || n1 == 0 || k == 0 || ib == 0)
+        return PlasmaSuccess;
+
+    plasma_complex64_t zone  =  1.0;
+    plasma_complex64_t zmone = -1.0;
+
+    for (int ii = 0; ii < k; ii += ib) {
+        int sb = imin(k-ii, ib);
+
+        // row interchanges with A2
+        for (int i = 0; i < sb; i++) {
+            int im = ipiv[ii+i]-m1-1;
+            if (im >= 0) {
+                cblas_zswap(n1, &A1[ii+i], lda1,
+                                &A2[im],   lda2);
+            }
+        }
+
+        cblas_ztrsm(CblasColMajor,
+                    CblasLeft, CblasLower,
+                    CblasNoTrans, CblasUnit,
+                    sb, n1,
+                    CBLAS_SADDR(zone), &L1[ldl1*ii], ldl1,
+                                       &A1[ii], lda1);
+
+        cblas_zgemm(CblasColMajor,
+                    CblasNoTrans, CblasNoTrans,
+                    m2, n2, sb,
+                    CBLAS_SADDR(zmone), &L2[ldl2*ii], ldl2,
+                                        &A1[ii], lda1,
+                    CBLAS_SADDR(zone),  A2, lda2);
+    }
+
+    return PlasmaSuccess;
+}
+
+/******************************************************************************/
+void plasma_core_omp_zssssm(int m1, int n1, int m2, int n2, int k, int ib,
+                                  plasma_complex64_t *A1, int lda1,
+                                  plasma_complex64_t *A2, int lda2,
+                            const plasma_complex64_t *L1, int ldl1,
+                            const plasma_complex64_t *L2, int ldl2,
+                            const int *ipiv,
+                            plasma_sequence_t *sequence,
+                            plasma_request_t *request)
+{
+    #pragma omp task depend(inout:A1[0:lda1*n1]) \
+                     depend(inout:A2[0:lda2*n2]) \
+                     depend(in:L1[0:ldl1*k]) \
+                     depend(in:L2[0:ldl2*k]) \
+                     depend(in:ipiv[0:k])
+    {
+        if (sequence->status == PlasmaSuccess) {
+            int info = plasma_core_zssssm(m1, n1, m2, n2, k, ib,
+                                          A1, lda1,
+                                          A2, lda2,
+                                          L1, ldl1,
+                                          L2, ldl2,
+                                          ipiv);
+            if (info != PlasmaSuccess) {
+                plasma_error("core_zssssm() failed");
+                plasma_request_fail(sequence, request, PlasmaErrorInternal);
+            }
+        }
+    }
+}
@@ -11,6 +11,7 @@
  **/
 
 #include <plasma_core_blas.h>
+#include "plasma_internal.h"
 #include "plasma_types.h"
 #include "core_lapack.h"
 
@@ -98,7 +99,8 @@ void plasma_core_omp_zsyrk(
         ak = n;
 
     #pragma omp task depend(in:A[0:lda*ak]) \
-                     depend(inout:C[0:ldc*n])
+                     depend(inout:C[0:ldc*n]) \
+                     affinity(C[0:ldc*n])
     {
         if (sequence->status == PlasmaSuccess)
             plasma_core_zsyrk(uplo, trans,
@@ -107,3 +109,48 @@ void plasma_core_omp_zsyrk(
                        beta,  C, ldc);
     }
 }
+
+/******************************************************************************/
+typedef struct {
+    plasma_enum_t uplo, trans;
+    int n, k;
+    plasma_complex64_t alpha;
+    const plasma_complex64_t *A;
+    int lda;
+    plasma_complex64_t beta;
+    plasma_complex64_t *C;
+    int ldc;
+} plasma_core_rt_zsyrk_args_t;
+
+static void plasma_core_rt_zsyrk_task(void *args,
+                                      plasma_sequence_t *sequence,
+                                      plasma_request_t *request)
+{
+    plasma_core_rt_zsyrk_args_t *a = (plasma_core_rt_zsyrk_args_t*)args;
+    if (sequence->status == PlasmaSuccess)
+        plasma_core_zsyrk(a->uplo, a->trans,
+                   a->n, a->k,
+                   a->alpha, a->A, a->lda,
+                   a->beta,  a->C, a->ldc);
+}
+
+/******************************************************************************/
+void plasma_core_rt_zsyrk(
+    plasma_dag_t *dag,
+    plasma_enum_t uplo, plasma_enum_t trans,
+    int n, int k,
+    plasma_complex64_t alpha, const plasma_complex64_t *A, int lda,
+    plasma_complex64_t beta,        plasma_complex64_t *C, int ldc,
+    plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    plasma_core_rt_zsyrk_args_t args = {
+        uplo, trans, n, k, alpha, A, lda, beta, C, ldc
+    };
+    plasma_dep_t deps[] = {
+        {A, PlasmaDepIn, offsetof(plasma_core_rt_zsyrk_args_t, A)},
+        {C, PlasmaDepInout, offsetof(plasma_core_rt_zsyrk_args_t, C)}
+    };
+    if (plasma_dag_insert(dag, plasma_core_rt_zsyrk_task,
+                          &args, sizeof(args), 2, deps) != PlasmaSuccess)
+        plasma_request_fail(sequence, request, PlasmaErrorOutOfMemory);
+}
@@ -11,6 +11,7 @@
  **/
 
 #include <plasma_core_blas.h>
+#include "plasma_internal.h"
 #include "plasma_types.h"
 #include "core_lapack.h"
 
@@ -115,7 +116,8 @@ void plasma_core_omp_ztrsm(
         ak = n;
 
     #pragma omp task depend(in:A[0:lda*ak]) \
-                     depend(inout:B[0:ldb*n])
+                     depend(inout:B[0:ldb*n]) \
+                     affinity(B[0:ldb*n])
     {
         if (sequence->status == PlasmaSuccess)
             plasma_core_ztrsm(side, uplo,
@@ -125,3 +127,49 @@ void plasma_core_omp_ztrsm(
                               B, ldb);
     }
 }
+
+/******************************************************************************/
+typedef struct {
+    plasma_enum_t side, uplo, transa, diag;
+    int m, n;
+    plasma_complex64_t alpha;
+    const plasma_complex64_t *A;
+    int lda;
+    plasma_complex64_t *B;
+    int ldb;
+} plasma_core_rt_ztrsm_args_t;
+
+static void plasma_core_rt_ztrsm_task(void *args,
+                                      plasma_sequence_t *sequence,
+                                      plasma_request_t *request)
+{
+    plasma_core_rt_ztrsm_args_t *a = (plasma_core_rt_ztrsm_args_t*)args;
+    if (sequence->status == PlasmaSuccess)
+        plasma_core_ztrsm(a->side, a->uplo,
+                   a->transa, a->diag,
+                   a->m, a->n,
+                   a->alpha, a->A, a->lda,
+                             a->B, a->ldb);
+}
+
+/******************************************************************************/
+void plasma_core_rt_ztrsm(
+    plasma_dag_t *dag,
+    plasma_enum_t side, plasma_enum_t uplo,
+    plasma_enum_t transa, plasma_enum_t diag,
+    int m, int n,
+    plasma_complex64_t alpha, const plasma_complex64_t *A, int lda,
+                                    plasma_complex64_t *B, int ldb,
+    plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    plasma_core_rt_ztrsm_args_t args = {
+        side, uplo, transa, diag, m, n, alpha, A, lda, B, ldb
+    };
+    plasma_dep_t deps[] = {
+        {A, PlasmaDepIn, offsetof(plasma_core_rt_ztrsm_args_t, A)},
+        {B, PlasmaDepInout, offsetof(plasma_core_rt_ztrsm_args_t, B)}
+    };
+    if (plasma_dag_insert(dag, plasma_core_rt_ztrsm_task,
+                          &args, sizeof(args), 2, deps) != PlasmaSuccess)
+        plasma_request_fail(sequence, request, PlasmaErrorOutOfMemory);
+}
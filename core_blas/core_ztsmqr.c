@@ -284,3 +284,75 @@ void plasma_core_omp_ztsmqr(plasma_enum_t side, plasma_enum_t trans,
         }
     }
 }
+
+/******************************************************************************/
+typedef struct {
+    plasma_enum_t side, trans;
+    int m1, n1, m2, n2, k, ib;
+    plasma_complex64_t *A1;
+    int lda1;
+    plasma_complex64_t *A2;
+    int lda2;
+    const plasma_complex64_t *V;
+    int ldv;
+    const plasma_complex64_t *T;
+    int ldt;
+    plasma_workspace_t work;
+} plasma_core_rt_ztsmqr_args_t;
+
+static void plasma_core_rt_ztsmqr_task(void *args,
+                                       plasma_sequence_t *sequence,
+                                       plasma_request_t *request)
+{
+    plasma_core_rt_ztsmqr_args_t *a = (plasma_core_rt_ztsmqr_args_t*)args;
+    if (sequence->status == PlasmaSuccess) {
+        // Prepare workspaces.
+        int tid = omp_get_thread_num();
+        plasma_complex64_t *W = (plasma_complex64_t*)a->work.spaces[tid];
+        int ldwork = a->side == PlasmaLeft ? a->ib : a->m1;
+
+        // Call the kernel.
+        int info = plasma_core_ztsmqr(a->side, a->trans,
+                               a->m1, a->n1, a->m2, a->n2, a->k, a->ib,
+                               a->A1, a->lda1,
+                               a->A2, a->lda2,
+                               a->V,  a->ldv,
+                               a->T,  a->ldt,
+                               W,  ldwork);
+
+        if (info != PlasmaSuccess) {
+            plasma_error("core_ztsmqr() failed");
+            plasma_request_fail(sequence, request, PlasmaErrorInternal);
+        }
+    }
+}
+
+/******************************************************************************/
+void plasma_core_rt_ztsmqr(plasma_dag_t *dag,
+                    plasma_enum_t side, plasma_enum_t trans,
+                    int m1, int n1, int m2, int n2, int k, int ib,
+                          plasma_complex64_t *A1, int lda1,
+                          plasma_complex64_t *A2, int lda2,
+                    const plasma_complex64_t *V,  int ldv,
+                    const plasma_complex64_t *T,  int ldt,
+                    plasma_workspace_t work,
+                    plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    plasma_core_rt_ztsmqr_args_t args = {
+        side, trans, m1, n1, m2, n2, k, ib,
+        A1, lda1, A2, lda2, V, ldv, T, ldt, work
+    };
+    plasma_dep_t deps[] = {
+        {A1, PlasmaDepInout, offsetof(plasma_core_rt_ztsmqr_args_t, A1)},
+        {A2, PlasmaDepInout, offsetof(plasma_core_rt_ztsmqr_args_t, A2)},
+        {V,  PlasmaDepIn,    offsetof(plasma_core_rt_ztsmqr_args_t, V)},
+        {T,  PlasmaDepIn,    offsetof(plasma_core_rt_ztsmqr_args_t, T)},
+        // the workspaces, moved on replay
+        {work.spaces, PlasmaDepNone,
+         offsetof(plasma_core_rt_ztsmqr_args_t, work)+
+         offsetof(plasma_workspace_t, spaces)}
+    };
+    if (plasma_dag_insert(dag, plasma_core_rt_ztsmqr_task,
+                          &args, sizeof(args), 5, deps) != PlasmaSuccess)
+        plasma_request_fail(sequence, request, PlasmaErrorOutOfMemory);
+}
@@ -0,0 +1,264 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> c d s
+ *
+ **/
+
+#include <plasma_core_blas.h>
+#include "plasma_types.h"
+#include "plasma_internal.h"
+#include "core_lapack.h"
+
+#include <omp.h>
+#include <math.h>
+
+/***************************************************************************//**
+ *
+ * @ingroup core_tstrf
+ *
+ *  Computes an LU factorization with partial pivoting of a matrix
+ *  formed by coupling an n-by-n upper triangular tile U on top of
+ *  an m-by-n tile A:
+ *
+ *    | U | = P * L * U
+ *    | A |
+ *
+ *  The pivot of a column is either the diagonal element of U or
+ *  the element of largest magnitude of the column of A, so that rows
+ *  are only interchanged between U and A. The columns are factored in
+ *  blocks of ib: a block is eliminated in a copy of its triangle of U,
+ *  then applied to the columns on its right by plasma_core_zssssm().
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *          The number of rows of the tile A. m >= 0.
+ *
+ * @param[in] n
+ *          The number of rows and columns of the tile U.
+ *          The number of columns of the tile A. n >= 0.
+ *
+ * @param[in] ib
+ *          The inner-blocking size. ib >= 0.
+ *
+ * @param[in] nb
+ *          The offset of the rows of A in ipiv, at least the number of
+ *          rows of the tile holding U. nb >= n.
+ *
+ * @param[in,out] U
+ *          On entry, the n-by-n upper triangular tile U.
+ *          On exit, the updated upper triangular factor;
+ *          the elements below the diagonal are not referenced.
+ *
+ * @param[in] ldu
+ *          The leading dimension of the array U. ldu >= max(1,n).
+ *
+ * @param[in,out] A
+ *          On entry, the m-by-n tile A.
+ *          On exit, the factor L of the rows of A.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A. lda >= max(1,m).
+ *
+ * @param[out] L
+ *          The ib-by-n array holding, for each block of ib columns,
+ *          the factor L of the rows of A pivoted up to U, strictly below
+ *          the diagonal of the block. Required by plasma_core_zssssm().
+ *
+ * @param[in] ldl
+ *          The leading dimension of the array L. ldl >= max(1,ib).
+ *
+ * @param[out] ipiv
+ *          The pivot indices, of length n; for 1 <= i <= n, row i of U
+ *          was interchanged with row ipiv[i-1]-nb of A if ipiv[i-1] > nb.
+ *
+ * @param work
+ *          Auxiliary workspace array of length ldwork*ib.
+ *
+ * @param[in] ldwork
+ *          The leading dimension of the array work. ldwork >= max(1,ib).
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ * @retval > 0 if i, U(i,i) is exactly zero
+ *
+ ******************************************************************************/
+__attribute__((weak))
+int plasma_core_ztstrf(int m, int n, int ib, int nb,
+                       plasma_complex64_t *U, int ldu,
+                       plasma_complex64_t *A, int lda,
+                       plasma_complex64_t *L, int ldl,
+                       int *ipiv,
+                       plasma_complex64_t *work, int ldwork)
+{
+    // Check input arguments.
+    if (m < 0) {
+        plasma_coreblas_error("illegal value of m");
+        return -1;
+    }
+    if (n < 0) {
+        plasma_coreblas_error("illegal value of n");
+        return -2;
+    }
+    if (ib < 0) {
+        plasma_coreblas_error("illegal value of ib");
+        return -3;
+    }
+    if (nb < n) {
+        plasma_coreblas_error("illegal value of nb");
+        return -4;
+    }
+    if (U == NULL) {
+        plasma_coreblas_error("NULL U");
+        return -5;
+    }
+    if (ldu < imax(1, n)) {
+        plasma_coreblas_error("illegal value of ldu");
+        return -6;
+    }
+    if (A == NULL) {
+        plasma_coreblas_error("NULL A");
+        return -7;
+    }
+    if (lda < imax(1, m)) {
+        plasma_coreblas_error("illegal value of lda");
+        return -8;
+    }
+    if (L == NULL) {
+        plasma_coreblas_error("NULL L");
+        return -9;
+    }
+    if (ldl < imax(1, ib)) {
+        plasma_coreblas_error("illegal value of ldl");
+        return -10;
+    }
+    if (ipiv == NULL) {
+        plasma_coreblas_error("NULL ipiv");
+        return -11;
+    }
+    if (work == NULL) {
+        plasma_coreblas_error("NULL work");
+        return -12;
+    }
+    if (ldwork < imax(1, ib)) {
+        plasma_coreblas_error("illegal value of ldwork");
+        return -13;
+    }
+
+    // quick return
+    if (n == 0 || ib == 0)
+        return PlasmaSuccess;
+
+    plasma_complex64_t zzero =  0.0;
+    plasma_complex64_t zmone = -1.0;
+    plasma_complex64_t *W = work;
+    int info = 0;
+
+    for (int ii = 0; ii < n; ii += ib) {
+        int sb = imin(n-ii, ib);
+
+        // The rows of A pivoted up to U bring their factor L along,
+        // so the block is eliminated in a copy of its triangle of U,
+        // which has room for L below the diagonal.
+        LAPACKE_zlaset_work(LAPACK_COL_MAJOR, 'L', sb, sb,
+                            zzero, zzero, W, ldwork);
+        LAPACKE_zlacpy_work(LAPACK_COL_MAJOR, 'U', sb, sb,
+                            &U[ii+ldu*ii], ldu, W, ldwork);
+
+        for (int i = 0; i < sb; i++) {
+            int j = ii+i;
+
+            // The rows of U below the diagonal are zero in column j,
+            // so the pivot is U(j,j) or the largest element of A.
+            double amax;
+            int im = plasma_core_izamax(m, &A[lda*j], &amax);
+            if (amax > plasma_core_dcabs1(W[i+ldwork*i])) {
+                cblas_zswap(sb, &W[i], ldwork,
+                                &A[im+lda*ii], lda);
+                ipiv[j] = nb+im+1;
+            }
+            else {
+                ipiv[j] = j+1;
+            }
+
+            // Keep factoring past a zero pivot, as LAPACK does.
+            if (W[i+ldwork*i] == 0.0) {
+                if (info == 0)
+                    info = j+1;
+                continue;
+            }
+
+            plasma_complex64_t alpha = 1.0/W[i+ldwork*i];
+            cblas_zscal(m, CBLAS_SADDR(alpha), &A[lda*j], 1);
+
+            if (i+1 < sb) {
+                cblas_zgeru(CblasColMajor,
+                            m, sb-i-1,
+                            CBLAS_SADDR(zmone), &A[lda*j], 1,
+                                                &W[i+ldwork*(i+1)], ldwork,
+                                                &A[lda*(j+1)], lda);
+            }
+        }
+
+        LAPACKE_zlacpy_work(LAPACK_COL_MAJOR, 'U', sb, sb,
+                            W, ldwork, &U[ii+ldu*ii], ldu);
+        LAPACKE_zlacpy_work(LAPACK_COL_MAJOR, 'L', sb, sb,
+                            W, ldwork, &L[ldl*ii], ldl);
+
+        // Apply the block to the columns on its right.
+        if (n > ii+sb) {
+            plasma_core_zssssm(nb, n-(ii+sb), m, n-(ii+sb), sb, sb,
+                               &U[ii+ldu*(ii+sb)], ldu,
+                               &A[lda*(ii+sb)], lda,
+                               &L[ldl*ii], ldl,
+                               &A[lda*ii], lda,
+                               &ipiv[ii]);
+        }
+    }
+
+    return info;
+}
+
+/******************************************************************************/
+void plasma_core_omp_ztstrf(int m, int n, int ib, int nb,
+                            plasma_complex64_t *U, int ldu,
+                            plasma_complex64_t *A, int lda,
+                            plasma_complex64_t *L, int ldl,
+                            int *ipiv,
+                            plasma_workspace_t work,
+                            plasma_sequence_t *sequence,
+                            plasma_request_t *request)
+{
+    #pragma omp task depend(inout:U[0:ldu*n]) \
+                     depend(inout:A[0:lda*n]) \
+                     depend(out:L[0:ldl*n]) \
+                     depend(out:ipiv[0:n])
+    {
+        if (sequence->status == PlasmaSuccess) {
+            // Prepare workspaces.
+            int tid = omp_get_thread_num();
+            plasma_complex64_t *W = (plasma_complex64_t*)work.spaces[tid];
+
+            // Call the kernel. A zero pivot is not an error here,
+            // as the rows of the tiles below may still replace it.
+            int info = plasma_core_ztstrf(m, n, ib, nb,
+                                          U, ldu,
+                                          A, lda,
+                                          L, ldl,
+                                          ipiv,
+                                          W, ib);
+            if (info < 0) {
+                plasma_error("core_ztstrf() failed");
+                plasma_request_fail(sequence, request, PlasmaErrorInternal);
+            }
+        }
+    }
+}
@@ -266,3 +266,69 @@ void plasma_core_omp_zunmqr(plasma_enum_t side, plasma_enum_t trans,
         }
     }
 }
+
+/******************************************************************************/
+typedef struct {
+    plasma_enum_t side, trans;
+    int m, n, k, ib;
+    const plasma_complex64_t *A;
+    int lda;
+    const plasma_complex64_t *T;
+    int ldt;
+    plasma_complex64_t *C;
+    int ldc;
+    plasma_workspace_t work;
+} plasma_core_rt_zunmqr_args_t;
+
+static void plasma_core_rt_zunmqr_task(void *args,
+                                       plasma_sequence_t *sequence,
+                                       plasma_request_t *request)
+{
+    plasma_core_rt_zunmqr_args_t *a = (plasma_core_rt_zunmqr_args_t*)args;
+    if (sequence->status == PlasmaSuccess) {
+        // Prepare workspaces.
+        int tid = omp_get_thread_num();
+        plasma_complex64_t *W = (plasma_complex64_t*)a->work.spaces[tid];
+        int ldwork = a->side == PlasmaLeft ? a->n : a->m;
+
+        // Call the kernel.
+        int info = plasma_core_zunmqr(a->side, a->trans,
+                               a->m, a->n, a->k, a->ib,
+                               a->A, a->lda,
+                               a->T, a->ldt,
+                               a->C, a->ldc,
+                               W, ldwork);
+
+        if (info != PlasmaSuccess) {
+            plasma_error("core_zunmqr() failed");
+            plasma_request_fail(sequence, request, PlasmaErrorInternal);
+        }
+    }
+}
+
+/******************************************************************************/
+void plasma_core_rt_zunmqr(plasma_dag_t *dag,
+                    plasma_enum_t side, plasma_enum_t trans,
+                    int m, int n, int k, int ib,
+                    const plasma_complex64_t *A, int lda,
+                    const plasma_complex64_t *T, int ldt,
+                          plasma_complex64_t *C, int ldc,
+                    plasma_workspace_t work,
+                    plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    plasma_core_rt_zunmqr_args_t args = {
+        side, trans, m, n, k, ib, A, lda, T, ldt, C, ldc, work
+    };
+    plasma_dep_t deps[] = {
+        {A, PlasmaDepIn,    offsetof(plasma_core_rt_zunmqr_args_t, A)},
+        {T, PlasmaDepIn,    offsetof(plasma_core_rt_zunmqr_args_t, T)},
+        {C, PlasmaDepInout, offsetof(plasma_core_rt_zunmqr_args_t, C)},
+        // the workspaces, moved on replay
+        {work.spaces, PlasmaDepNone,
+         offsetof(plasma_core_rt_zunmqr_args_t, work)+
+         offsetof(plasma_workspace_t, spaces)}
+    };
+    if (plasma_dag_insert(dag, plasma_core_rt_zunmqr_task,
+                          &args, sizeof(args), 4, deps) != PlasmaSuccess)
+        plasma_request_fail(sequence, request, PlasmaErrorOutOfMemory);
+}
@@ -11,8 +11,13 @@
 #define PLASMA_H
 
 #include "plasma_async.h"
+#include "plasma_cache.h"
+#include "plasma_allocator.h"
+#include "plasma_pool.h"
 #include "plasma_descriptor.h"
 #include "plasma_context.h"
+#include "plasma_factor.h"
+#include "plasma_runtime.h"
 #include "plasma_tuning.h"
 #include "plasma_workspace.h"
 
@@ -0,0 +1,66 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+#ifndef PLASMA_ALLOCATOR_H
+#define PLASMA_ALLOCATOR_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// alignment of the memory asked from the allocator, in bytes
+#define PLASMA_ALLOCATOR_ALIGN 64
+
+/***************************************************************************//**
+ * @ingroup plasma_allocator
+ *
+ * Allocation hook: returns size bytes aligned to alignment bytes,
+ * or NULL if out of memory.
+ *
+ **/
+typedef void *(*plasma_alloc_func_t)(size_t size, size_t alignment,
+                                     void *data);
+
+/***************************************************************************//**
+ * @ingroup plasma_allocator
+ *
+ * Release hook: releases the size bytes at ptr of the allocation hook.
+ *
+ **/
+typedef void (*plasma_free_func_t)(void *ptr, size_t size, void *data);
+
+/***************************************************************************//**
+ * @ingroup plasma_allocator
+ *
+ * Allocator of the context, from which the pool and the workspace arena
+ * take their memory: the system, or the hooks of the user.
+ *
+ **/
+typedef struct {
+    plasma_alloc_func_t alloc; ///< allocation hook, NULL for the system
+    plasma_free_func_t free;   ///< release hook, NULL for the system
+    void *data;                ///< user data passed to the hooks
+} plasma_allocator_t;
+
+/******************************************************************************/
+int plasma_allocator_set(plasma_alloc_func_t alloc, plasma_free_func_t free,
+                         void *data);
+
+void plasma_allocator_init(plasma_allocator_t *allocator);
+void *plasma_allocator_alloc(const plasma_allocator_t *allocator, size_t size);
+void plasma_allocator_free(const plasma_allocator_t *allocator,
+                           void *ptr, size_t size);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif // PLASMA_ALLOCATOR_H
@@ -0,0 +1,73 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+#ifndef PLASMA_ARENA_H
+#define PLASMA_ARENA_H
+
+#include "plasma_allocator.h"
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************************//**
+ * @ingroup plasma_arena
+ *
+ * Buffer of one thread, handing out blocks as a stack.
+ *
+ **/
+typedef struct {
+    char *base;  ///< buffer, NULL until first used
+    size_t size; ///< bytes of the buffer
+    size_t top;  ///< bytes handed out from the base
+    size_t last; ///< offset of the top block, while top > 0
+    size_t peak; ///< most bytes asked for at once, size of the next buffer
+    int live;    ///< blocks handed out and not released
+} __attribute__((aligned(64))) plasma_arena_slot_t;
+
+/***************************************************************************//**
+ * @ingroup plasma_arena
+ *
+ * Per-thread workspace arena of the context. The buffers only grow, to
+ * the most memory their thread asked for at once, so that the workspaces
+ * of the calls are carved out of them without allocating once warm.
+ *
+ **/
+typedef struct {
+    plasma_arena_slot_t *slots; ///< one buffer per thread
+    int num_slots;              ///< number of threads
+    const plasma_allocator_t *allocator; ///< source of the buffers
+    plasma_arena_slot_t *own;   ///< own slots while a caller buffer is set
+    int num_own;                ///< number of own slots
+    int external;               ///< slots carved out of a caller buffer,
+                                ///< never grown
+} plasma_arena_t;
+
+/******************************************************************************/
+void plasma_arena_init(plasma_arena_t *arena,
+                       const plasma_allocator_t *allocator, int num_threads);
+void plasma_arena_finalize(plasma_arena_t *arena);
+int plasma_arena_reserve(plasma_arena_t *arena, int num_threads);
+void plasma_arena_trim(plasma_arena_t *arena);
+
+void *plasma_arena_push(plasma_arena_t *arena, int tid, size_t size);
+void plasma_arena_pop(plasma_arena_t *arena, int tid, void *ptr);
+
+void plasma_arena_buffer(plasma_arena_t *arena, void *buffer, size_t size,
+                         int num_threads);
+size_t plasma_arena_bytes(size_t size);
+size_t plasma_arena_buffer_bytes(size_t size, int num_threads);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif // PLASMA_ARENA_H
@@ -24,6 +24,8 @@ typedef struct {
 typedef struct {
     plasma_enum_t status;      ///< error code
     plasma_request_t *request; ///< failed request
+    int info;                  ///< numerical status, e.g., first zero pivot;
+                               ///  does not stop the sequence
 } plasma_sequence_t;
 
 /******************************************************************************/
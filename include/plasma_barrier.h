@@ -15,14 +15,74 @@ extern "C" {
 #endif
 
 /******************************************************************************/
+// maximum number of groups of a barrier
+#define PLASMA_BARRIER_MAX_GROUPS 64
+
+// number of consecutive ranks sharing a group
+#define PLASMA_BARRIER_GROUP_SIZE 8
+
+/***************************************************************************//**
+ * @ingroup plasma_barrier
+ *
+ * Node of the barrier tree, alone in its cache line.
+ *
+ **/
 typedef struct {
-    int count;
-    volatile int passed;
+    volatile int count;   ///< ranks arrived in the current episode
+    volatile int episode; ///< incremented when the node is released
+} __attribute__((aligned(64))) plasma_barrier_node_t;
+
+/***************************************************************************//**
+ * @ingroup plasma_barrier
+ *
+ * Two-level combining barrier. Ranks arrive at the node of their group,
+ * the last one of each group arrives at the root, and the last one at the
+ * root releases the groups. Each rank spins on its group's node only.
+ *
+ **/
+typedef struct {
+    plasma_barrier_node_t root;
+    plasma_barrier_node_t group[PLASMA_BARRIER_MAX_GROUPS];
 } plasma_barrier_t;
 
+/***************************************************************************//**
+ * @ingroup plasma_barrier
+ *
+ * Pivot candidate published by one rank of a multithreaded panel between
+ * two barriers, alone in its cache line, so that the ranks publishing
+ * their candidates do not invalidate each other's lines.
+ *
+ **/
+typedef struct {
+    volatile double value; ///< magnitude of the candidate
+    volatile int index;    ///< row of the candidate in the panel, or -1
+} __attribute__((aligned(64))) plasma_pivot_t;
+
+/***************************************************************************//**
+ * @ingroup plasma_barrier
+ *
+ * Team of ranks of a multithreaded panel, sized when the panel starts.
+ * The owner of the panel is rank 0. Helper tasks join the team while it is
+ * open and wait until the owner closes it, so that all the ranks of the
+ * team are running when they reach the barriers of the panel; helpers
+ * starting later find the team closed and return at once. The owner
+ * waits up to PlasmaTeamWait pauses for the helpers before closing it.
+ *
+ **/
+typedef struct {
+    volatile int state;  ///< helpers joined, with PLASMA_TEAM_CLOSED
+    volatile int size;   ///< size of the team once closed, 0 before
+    int max_size;        ///< maximum size of the team
+    int wait;            ///< pauses the owner waits for helpers to join
+} plasma_team_t;
+
 /******************************************************************************/
 void plasma_barrier_init(plasma_barrier_t *barrier);
-void plasma_barrier_wait(plasma_barrier_t *barrier, int size);
+void plasma_barrier_wait(plasma_barrier_t *barrier, int rank, int size);
+
+void plasma_team_init(plasma_team_t *team, int max_size, int wait);
+int  plasma_team_join(plasma_team_t *team);
+int  plasma_team_close(plasma_team_t *team);
 
 #ifdef __cplusplus
 }  // extern "C"
@@ -0,0 +1,77 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+#ifndef PLASMA_CACHE_H
+#define PLASMA_CACHE_H
+
+#include "plasma_types.h"
+#include "plasma_descriptor.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************************//**
+ * @ingroup plasma_cache
+ *
+ * Translation cache entry.
+ * A tile-layout copy of a read-only LAPACK-layout operand, keyed by
+ * the user's pointer, leading dimension, shape, tile size and precision.
+ *
+ **/
+typedef struct plasma_cache_entry_s {
+    const void *ptr;     ///< user's array in LAPACK layout
+    int lda;             ///< leading dimension of the user's array
+    plasma_desc_t A;     ///< copy in tile layout
+    size_t size;         ///< bytes held by A
+    unsigned long stamp; ///< time of the last use, for LRU eviction
+    bool valid;          ///< A holds a translated copy of the array
+    bool stale;          ///< invalidated while in use, dropped when released
+    bool pinned;         ///< never evicted
+    int busy;            ///< number of calls currently using the entry
+    struct plasma_cache_entry_s *next; ///< next entry
+} plasma_cache_entry_t;
+
+/***************************************************************************//**
+ * @ingroup plasma_cache
+ *
+ * Translation cache. Disabled while the limit is zero.
+ *
+ **/
+typedef struct {
+    plasma_cache_entry_t *head; ///< list of entries
+    size_t size;                ///< bytes held by all entries
+    size_t limit;               ///< cap in bytes, zero disables the cache
+    unsigned long clock;        ///< LRU clock
+} plasma_cache_t;
+
+/******************************************************************************/
+int plasma_cache_invalidate(const void *ptr);
+int plasma_cache_pin(const void *ptr);
+int plasma_cache_unpin(const void *ptr);
+
+void plasma_cache_init(plasma_cache_t *cache);
+void plasma_cache_finalize(plasma_cache_t *cache);
+void plasma_cache_trim(plasma_cache_t *cache, size_t limit);
+
+plasma_cache_entry_t *plasma_cache_acquire(plasma_cache_t *cache,
+                                           plasma_enum_t precision,
+                                           const void *ptr, int lda, int nb,
+                                           int m, int n);
+void plasma_cache_release(plasma_cache_t *cache, plasma_cache_entry_t *entry,
+                          bool translated, int status);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif // PLASMA_CACHE_H
@@ -0,0 +1,21 @@
+/* PLASMA configuration options */
+
+/* #undef HAVE_MKL */
+
+/* #undef HAVE_ESSL */
+
+/* #undef PLASMA_WITH_ESSL */
+
+/* #undef CBLAS_ADD_TYPEDEF */
+
+/* #undef PLASMA_WITH_MKL */
+
+/* #undef PLASMA_WITH_NETLIB */
+
+/* #undef PLASMA_USE_LUA */
+
+#define PLASMA_USE_OMP_ITERATOR
+
+#define PLASMA_USE_OMP_AFFINITY
+
+#define PLASMA_USE_NUMA
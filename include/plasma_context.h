@@ -11,9 +11,15 @@
 #define PLASMA_CONTEXT_H
 
 #include "plasma_types.h"
+#include "plasma_allocator.h"
+#include "plasma_arena.h"
 #include "plasma_barrier.h"
+#include "plasma_cache.h"
+#include "plasma_pool.h"
+#include "plasma_runtime.h"
 
 #include <pthread.h>
+#include <sched.h>
 #if defined(PLASMA_USE_LUA)
 #include <lua.h>
 #include <lauxlib.h>
@@ -33,15 +39,48 @@ typedef struct {
     int nb;                         ///< PlasmaNb
     int ib;                         ///< PlasmaIb
     plasma_enum_t inplace_outplace; ///< PlasmaInplaceOutplace
-    int max_threads;                ///< the value of OMP_NUM_THREADS
+    int max_threads;                ///< PlasmaNumThreads, team size of all
+                                    ///< parallel regions
     int max_panel_threads;          ///< max threads for panel factorization
+    int team_wait;                  ///< PlasmaTeamWait
     plasma_barrier_t barrier;       ///< thread barrier for multithreaded tasks
     plasma_enum_t householder_mode; ///< PlasmaHouseholderMode
+    plasma_enum_t layout;           ///< PlasmaLayout
+    plasma_cache_t cache;           ///< translation cache, PlasmaCacheSize
+    plasma_allocator_t allocator;   ///< plasma_allocator_set()
+    plasma_pool_t pool;             ///< memory pool, PlasmaPoolSize
+    plasma_arena_t arena;           ///< per-thread workspace arena
+    plasma_enum_t runtime;          ///< PlasmaRuntime
+    plasma_enum_t replay;           ///< PlasmaReplay
+    plasma_graph_t *graphs;         ///< task graphs recorded for replay
+    int lookahead;                  ///< PlasmaLookahead
+    plasma_enum_t pivoting;         ///< PlasmaPivoting
+    plasma_enum_t update;           ///< PlasmaTrailingUpdate
+    int granularity;                ///< PlasmaGranularity
+    plasma_enum_t placement;        ///< PlasmaPlacement
+    plasma_enum_t hugepages;        ///< PlasmaHugePages
     int ss_ld;                  // static scheduler progress table leading dimension
     volatile int ss_abort;      // static scheduler abort flag
     volatile int *ss_progress;  // static scheduler progress table
 } plasma_context_t;
 
+/******************************************************************************/
+// Synchronization on the static scheduler progress table
+// of the context plasma.
+#define ss_cond_set(m, n, val)                                  \
+    {                                                           \
+        __sync_synchronize();                                   \
+        plasma->ss_progress[(m)+plasma->ss_ld*(n)] = (val);     \
+    }
+
+#define ss_cond_wait(m, n, val)                                 \
+    {                                                           \
+        while (plasma->ss_progress[(m)+plasma->ss_ld*(n)] != (val) && \
+               ! plasma->ss_abort)                              \
+            sched_yield();                                      \
+        __sync_synchronize();                                   \
+    }
+
 typedef struct {
     pthread_t thread_id;       ///< thread id
     plasma_context_t *context; ///< pointer to associated context
@@ -15,6 +15,7 @@
 #include "plasma_async.h"
 #include "plasma_barrier.h"
 #include "plasma_descriptor.h"
+#include "plasma_runtime.h"
 #include "plasma_types.h"
 #include "plasma_workspace.h"
 #include "plasma_descriptor.h"
@@ -62,6 +63,15 @@ int plasma_core_zgelqt(int m, int n, int ib,
                 plasma_complex64_t *tau,
                 plasma_complex64_t *work);
 
+void plasma_core_zgemdm(int m, int n, int k,
+                plasma_complex64_t alpha,
+                const plasma_complex64_t *A, int lda,
+                const plasma_complex64_t *D, int incd,
+                const plasma_complex64_t *B, int ldb,
+                plasma_complex64_t beta,
+                      plasma_complex64_t *C, int ldc,
+                      plasma_complex64_t *work);
+
 void plasma_core_zgemm(plasma_enum_t transa, plasma_enum_t transb,
                 int m, int n, int k,
                 plasma_complex64_t alpha, const plasma_complex64_t *A, int lda,
@@ -74,14 +84,30 @@ int plasma_core_zgeqrt(int m, int n, int ib,
                 plasma_complex64_t *tau,
                 plasma_complex64_t *work);
 
+void plasma_core_zgerbt(plasma_enum_t side, plasma_enum_t trans, int depth,
+                 const double *u, plasma_desc_t A);
+
+int plasma_core_zgessm(int m, int n, int k,
+                const int *ipiv,
+                const plasma_complex64_t *L, int ldl,
+                      plasma_complex64_t *A, int lda);
+
 void plasma_core_zgessq(int m, int n,
                  const plasma_complex64_t *A, int lda,
                  double *scale, double *sumsq);
 
 void plasma_core_zgetrf(plasma_desc_t A, int *ipiv, int ib, int rank, int size,
-                 volatile int *max_idx, volatile plasma_complex64_t *max_val,
+                 plasma_pivot_t *pivot,
                  volatile int *info, plasma_barrier_t *barrier);
 
+int plasma_core_zgetrf_incpiv(int m, int n,
+                plasma_complex64_t *A, int lda, int *ipiv);
+
+int plasma_core_zgetrf_nopiv(int m, int n, int ib,
+                plasma_complex64_t *A, int lda);
+
+int plasma_core_izamax(int n, const plasma_complex64_t *x, double *amax);
+
 int plasma_core_zhegst(int itype, plasma_enum_t uplo,
                 int n,
                 plasma_complex64_t *A, int lda,
@@ -93,6 +119,9 @@ void plasma_core_zhemm(plasma_enum_t side, plasma_enum_t uplo,
                                           const plasma_complex64_t *B, int ldb,
                 plasma_complex64_t beta,        plasma_complex64_t *C, int ldc);
 
+int plasma_core_zhetrf_nopiv(plasma_enum_t uplo, int n,
+                plasma_complex64_t *A, int lda);
+
 void plasma_core_zher2k(plasma_enum_t uplo, plasma_enum_t trans,
                  int n, int k,
                  plasma_complex64_t alpha, const plasma_complex64_t *A, int lda,
@@ -158,6 +187,10 @@ int plasma_core_zlarfb_gemm(plasma_enum_t side, plasma_enum_t trans, int direct,
                      plasma_complex64_t *C, int LDC,
                      plasma_complex64_t *WORK, int LDWORK);
 
+void plasma_core_zlascl_diag(plasma_enum_t side, int m, int n,
+                 const plasma_complex64_t *D, int incd,
+                       plasma_complex64_t *A, int lda);
+
 void plasma_core_zlascl(plasma_enum_t uplo,
                  double cfrom, double cto,
                  int m, int n,
@@ -208,6 +241,13 @@ int plasma_core_zpotrf(plasma_enum_t uplo,
                 int n,
                 plasma_complex64_t *A, int lda);
 
+int plasma_core_zssssm(int m1, int n1, int m2, int n2, int k, int ib,
+                      plasma_complex64_t *A1, int lda1,
+                      plasma_complex64_t *A2, int lda2,
+                const plasma_complex64_t *L1, int ldl1,
+                const plasma_complex64_t *L2, int ldl2,
+                const int *ipiv);
+
 void plasma_core_zsymm(plasma_enum_t side, plasma_enum_t uplo,
                 int m, int n,
                 plasma_complex64_t alpha, const plasma_complex64_t *A, int lda,
@@ -282,6 +322,13 @@ int plasma_core_ztsqrt(int m, int n, int ib,
                 plasma_complex64_t *tau,
                 plasma_complex64_t *work);
 
+int plasma_core_ztstrf(int m, int n, int ib, int nb,
+                plasma_complex64_t *U, int ldu,
+                plasma_complex64_t *A, int lda,
+                plasma_complex64_t *L, int ldl,
+                int *ipiv,
+                plasma_complex64_t *work, int ldwork);
+
 int plasma_core_zttlqt(int m, int n, int ib,
                 plasma_complex64_t *A1, int lda1,
                 plasma_complex64_t *A2, int lda2,
@@ -344,6 +391,16 @@ void plasma_core_omp_zgelqt(int m, int n, int ib,
                      plasma_workspace_t work,
                      plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_core_omp_zgemdm(int m, int n, int k,
+    plasma_complex64_t alpha,
+    const plasma_complex64_t *A, int lda,
+    const plasma_complex64_t *D, int incd,
+    const plasma_complex64_t *B, int ldb,
+    plasma_complex64_t beta,
+          plasma_complex64_t *C, int ldc,
+    plasma_workspace_t work,
+    plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_core_omp_zgemm(
     plasma_enum_t transa, plasma_enum_t transb,
     int m, int n, int k,
@@ -358,6 +415,12 @@ void plasma_core_omp_zgeqrt(int m, int n, int ib,
                      plasma_workspace_t work,
                      plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_core_omp_zgessm(int m, int n, int k,
+                     const int *ipiv,
+                     const plasma_complex64_t *L, int ldl,
+                           plasma_complex64_t *A, int lda,
+                     plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_core_omp_zgessq(int m, int n,
                      const plasma_complex64_t *A, int lda,
                      double *scale, double *sumsq,
@@ -369,12 +432,26 @@ void plasma_core_omp_zgessq_aux(int n,
                          plasma_sequence_t *sequence,
                          plasma_request_t *request);
 
+void plasma_core_omp_zgetrf_incpiv(int m, int n,
+                     plasma_complex64_t *A, int lda, int *ipiv,
+                     plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_core_omp_zgetrf_nopiv(int m, int n, int ib,
+                     plasma_complex64_t *A, int lda,
+                     int iinfo,
+                     plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_core_omp_zhegst(int itype, plasma_enum_t uplo,
                      int n,
                      plasma_complex64_t *A, int lda,
                      plasma_complex64_t *B, int ldb,
                      plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_core_omp_zhetrf_nopiv(plasma_enum_t uplo, int n,
+                     plasma_complex64_t *A, int lda,
+                     int iinfo,
+                     plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_core_omp_zhemm(
     plasma_enum_t side, plasma_enum_t uplo,
     int m, int n,
@@ -486,6 +563,11 @@ void plasma_core_omp_zlantr_aux(plasma_enum_t norm, plasma_enum_t uplo,
                          plasma_sequence_t *sequence,
                          plasma_request_t *request);
 
+void plasma_core_omp_zlascl_diag(plasma_enum_t side, int m, int n,
+                     const plasma_complex64_t *D, int incd,
+                           plasma_complex64_t *A, int lda,
+                     plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_core_omp_zlascl(plasma_enum_t uplo,
                      double cfrom, double cto,
                      int m, int n,
@@ -510,6 +592,14 @@ void plasma_core_omp_zpotrf(plasma_enum_t uplo,
                      int iinfo,
                      plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_core_omp_zssssm(int m1, int n1, int m2, int n2, int k, int ib,
+                           plasma_complex64_t *A1, int lda1,
+                           plasma_complex64_t *A2, int lda2,
+                     const plasma_complex64_t *L1, int ldl1,
+                     const plasma_complex64_t *L2, int ldl2,
+                     const int *ipiv,
+                     plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_core_omp_zsymm(
     plasma_enum_t side, plasma_enum_t uplo,
     int m, int n,
@@ -600,6 +690,14 @@ void plasma_core_omp_ztsqrt(int m, int n, int ib,
                      plasma_workspace_t work,
                      plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_core_omp_ztstrf(int m, int n, int ib, int nb,
+                     plasma_complex64_t *U, int ldu,
+                     plasma_complex64_t *A, int lda,
+                     plasma_complex64_t *L, int ldl,
+                     int *ipiv,
+                     plasma_workspace_t work,
+                     plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_core_omp_zttlqt(int m, int n, int ib,
                      plasma_complex64_t *A1, int lda1,
                      plasma_complex64_t *A2, int lda2,
@@ -648,6 +746,81 @@ void plasma_core_omp_zunmqr(plasma_enum_t side, plasma_enum_t trans,
                      plasma_workspace_t work,
                      plasma_sequence_t *sequence, plasma_request_t *request);
 
+/******************************************************************************/
+void plasma_core_rt_zgemm(
+    plasma_dag_t *dag,
+    plasma_enum_t transa, plasma_enum_t transb,
+    int m, int n, int k,
+    plasma_complex64_t alpha, const plasma_complex64_t *A, int lda,
+                              const plasma_complex64_t *B, int ldb,
+    plasma_complex64_t beta,        plasma_complex64_t *C, int ldc,
+    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_core_rt_zgeqrt(plasma_dag_t *dag,
+                    int m, int n, int ib,
+                    plasma_complex64_t *A, int lda,
+                    plasma_complex64_t *T, int ldt,
+                    plasma_workspace_t work,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_core_rt_zherk(plasma_dag_t *dag,
+                   plasma_enum_t uplo, plasma_enum_t trans,
+                   int n, int k,
+                   double alpha, const plasma_complex64_t *A, int lda,
+                   double beta,        plasma_complex64_t *C, int ldc,
+                   plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_core_rt_zpotrf(plasma_dag_t *dag,
+                    plasma_enum_t uplo,
+                    int n,
+                    plasma_complex64_t *A, int lda,
+                    int iinfo,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_core_rt_zsyrk(
+    plasma_dag_t *dag,
+    plasma_enum_t uplo, plasma_enum_t trans,
+    int n, int k,
+    plasma_complex64_t alpha, const plasma_complex64_t *A, int lda,
+    plasma_complex64_t beta,        plasma_complex64_t *C, int ldc,
+    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_core_rt_ztrsm(
+    plasma_dag_t *dag,
+    plasma_enum_t side, plasma_enum_t uplo,
+    plasma_enum_t transa, plasma_enum_t diag,
+    int m, int n,
+    plasma_complex64_t alpha, const plasma_complex64_t *A, int lda,
+                                    plasma_complex64_t *B, int ldb,
+    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_core_rt_ztsmqr(plasma_dag_t *dag,
+                    plasma_enum_t side, plasma_enum_t trans,
+                    int m1, int n1, int m2, int n2, int k, int ib,
+                          plasma_complex64_t *A1, int lda1,
+                          plasma_complex64_t *A2, int lda2,
+                    const plasma_complex64_t *V,  int ldv,
+                    const plasma_complex64_t *T,  int ldt,
+                    plasma_workspace_t work,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_core_rt_ztsqrt(plasma_dag_t *dag,
+                    int m, int n, int ib,
+                    plasma_complex64_t *A1, int lda1,
+                    plasma_complex64_t *A2, int lda2,
+                    plasma_complex64_t *T,  int ldt,
+                    plasma_workspace_t work,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_core_rt_zunmqr(plasma_dag_t *dag,
+                    plasma_enum_t side, plasma_enum_t trans,
+                    int m, int n, int k, int ib,
+                    const plasma_complex64_t *A, int lda,
+                    const plasma_complex64_t *T, int ldt,
+                          plasma_complex64_t *C, int ldc,
+                    plasma_workspace_t work,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+
 #undef COMPLEX
 
 #ifdef __cplusplus
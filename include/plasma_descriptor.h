@@ -45,6 +45,8 @@ typedef struct {
 
     // pointer and offsets
     void *matrix; ///< pointer to the beginning of the matrix
+    size_t mapped; ///< bytes mapped by plasma_numa_alloc(), 0 if malloc'ed
+    int inplace;   ///< 1 if matrix is the user's array translated in place
     size_t A21;   ///< pointer to the beginning of A21
     size_t A12;   ///< pointer to the beginning of A12
     size_t A22;   ///< pointer to the beginning of A22
@@ -73,6 +75,9 @@ typedef struct {
     int klt; ///< number of tile rows below the diagonal tile
     int kut; ///< number of tile rows above the diagonal tile
              ///  includes the space for potential fills, i.e., kl+ku
+
+    // leading dimension of a matrix in LAPACK layout
+    int ld; ///< column stride of the user's array (PlasmaGeneralLapack)
 } plasma_desc_t;
 
 /******************************************************************************/
@@ -156,12 +161,32 @@ static inline void *plasma_tile_addr_general_band(plasma_desc_t A, int m, int n)
     return plasma_tile_addr_general(A, (A.kut-1)+m-n, n);
 }
 
+/***************************************************************************//**
+ *
+ *  Returns the address of tile (m, n) of a matrix stored in LAPACK layout.
+ *  The tile is a strided block of the user's array with leading dimension A.ld.
+ *
+ */
+static inline void *plasma_tile_addr_general_lapack(plasma_desc_t A,
+                                                    int m, int n)
+{
+    int mm = m + A.i/A.mb;
+    int nn = n + A.j/A.nb;
+    size_t eltsize = plasma_element_size(A.precision);
+    size_t offset = (size_t)A.ld*A.nb*nn + (size_t)A.mb*mm;
+
+    return (void*)((char*)A.matrix + (offset*eltsize));
+}
+
 /******************************************************************************/
 static inline void *plasma_tile_addr(plasma_desc_t A, int m, int n)
 {
     if (A.type == PlasmaGeneral) {
         return plasma_tile_addr_general(A, m, n);
     }
+    else if (A.type == PlasmaGeneralLapack) {
+        return plasma_tile_addr_general_lapack(A, m, n);
+    }
     else if (A.type == PlasmaGeneralBand) {
         return plasma_tile_addr_general_band(A, m, n);
     }
@@ -177,6 +202,8 @@ static inline void *plasma_tile_addr(plasma_desc_t A, int m, int n)
 /***************************************************************************//**
  *
  *  Returns the height of the tile with vertical position k.
+ *  For a matrix in LAPACK layout, returns the leading dimension of the array,
+ *  which is what the kernels need as the leading dimension of the tile.
  *
  */
 static inline int plasma_tile_mmain(plasma_desc_t A, int k)
@@ -184,6 +211,9 @@ static inline int plasma_tile_mmain(plasma_desc_t A, int k)
     if (A.type == PlasmaGeneralBand) {
         return A.mb;
     }
+    else if (A.type == PlasmaGeneralLapack) {
+        return A.ld;
+    }
     else {
         if (A.i/A.mb+k < A.gm/A.mb)
             return A.mb;
@@ -261,6 +291,8 @@ int plasma_desc_triangular_create(plasma_enum_t dtyp, plasma_enum_t uplo, int mb
 
 int plasma_desc_destroy(plasma_desc_t *A);
 
+size_t plasma_desc_matrix_size(plasma_desc_t A);
+
 int plasma_desc_general_init(plasma_enum_t precision, void *matrix,
                              int mb, int nb, int lm, int ln, int i, int j,
                              int m, int n, plasma_desc_t *A);
@@ -274,12 +306,25 @@ int plasma_desc_triangular_init(plasma_enum_t precision, plasma_enum_t uplo, voi
                                 int mb, int nb, int lm, int ln, int i, int j,
                                 int m, int n, plasma_desc_t *A);
 
+int plasma_desc_general_lapack_init(plasma_enum_t precision, void *matrix,
+                                    int mb, int nb, int ld, int lm, int ln,
+                                    int i, int j, int m, int n,
+                                    plasma_desc_t *A);
+
+int plasma_desc_general_inplace_init(plasma_enum_t precision, void *matrix,
+                                     int mb, int nb, int ld, int ln,
+                                     int i, int j, int m, int n,
+                                     plasma_desc_t *A);
+
 int plasma_desc_check(plasma_desc_t A);
 int plasma_desc_general_check(plasma_desc_t A);
 int plasma_desc_general_band_check(plasma_desc_t A);
+int plasma_desc_general_lapack_check(plasma_desc_t A);
 
 plasma_desc_t plasma_desc_view(plasma_desc_t A, int i, int j, int m, int n);
 
+int plasma_descT_init(plasma_desc_t A, int ib, plasma_enum_t householder_mode,
+                      plasma_desc_t *T);
 int plasma_descT_create(plasma_desc_t A, int ib, plasma_enum_t householder_mode,
                         plasma_desc_t *T);
 
@@ -0,0 +1,43 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+#ifndef PLASMA_FACTOR_H
+#define PLASMA_FACTOR_H
+
+#include "plasma_types.h"
+#include "plasma_descriptor.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************************//**
+ * @ingroup plasma_factor
+ *
+ * Factorization handle.
+ * Keeps the factors of a matrix in tile layout between the factorization,
+ * e.g., plasma_zgetrf_handle(), and any number of solves, e.g.,
+ * plasma_zgetrs_handle(), so that the factors are translated only once.
+ * The contents are owned by PLASMA and released by plasma_factor_destroy().
+ *
+ **/
+typedef struct {
+    plasma_desc_t A;    ///< factors in tile layout
+    int *ipiv;          ///< pivot indices of LU, NULL for Cholesky
+    plasma_enum_t uplo; ///< PlasmaGeneral for LU, triangle for Cholesky
+} plasma_factor_t;
+
+/******************************************************************************/
+int plasma_factor_destroy(plasma_factor_t *F);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif // PLASMA_FACTOR_H
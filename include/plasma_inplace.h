@@ -0,0 +1,29 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+#ifndef PLASMA_INPLACE_H
+#define PLASMA_INPLACE_H
+
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************/
+void plasma_inplace_ge2desc(plasma_desc_t A, plasma_context_t *plasma);
+void plasma_inplace_desc2ge(plasma_desc_t A, plasma_context_t *plasma);
+size_t plasma_inplace_bytes(plasma_desc_t A);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif // PLASMA_INPLACE_H
@@ -14,6 +14,12 @@
   #define priority(p)
 #endif
 
+// Affinity clauses hinting the runtime to run a task near the tile
+// it updates, where the placement of the descriptor put it.
+#if !defined(PLASMA_USE_OMP_AFFINITY)
+  #define affinity(...)
+#endif
+
 #include <stdio.h>
 #include <stdlib.h>
 
@@ -39,6 +45,32 @@ static inline int imax(int a, int b)
         return b;
 }
 
+/***************************************************************************//**
+ *  Returns the task priority of step k of a factorization in column
+ *  (or row) n >= k, which becomes the panel n-k steps later. The panel
+ *  (n == k) is on the critical path and gets lookahead+1; the updates of
+ *  the lookahead columns next to it get less the farther they are from
+ *  the critical path, and the other updates get 0. OpenMP clamps the
+ *  priorities to omp_get_max_task_priority(), i.e., OMP_MAX_TASK_PRIORITY.
+ ******************************************************************************/
+static inline int plasma_priority(int lookahead, int k, int n)
+{
+    return imax(0, lookahead+1-(n-k));
+}
+
+/***************************************************************************//**
+ *  Returns the number of consecutive tile operations of the given flops
+ *  each that one task groups to reach the granularity of the context,
+ *  i.e., its minimum number of flops per task. A granularity of 0
+ *  disables the grouping.
+ ******************************************************************************/
+static inline int plasma_chunk(int granularity, double flops)
+{
+    if (granularity <= 0 || flops <= 0.0)
+        return 1;
+    return imax(1, (int)((granularity+flops-1.0)/flops));
+}
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
@@ -13,6 +13,7 @@
 #define PLASMA_INTERNAL_Z_H
 
 #include "plasma_async.h"
+#include "plasma_context.h"
 #include "plasma_descriptor.h"
 #include "plasma_types.h"
 #include "plasma_workspace.h"
@@ -80,12 +81,23 @@ void plasma_pzgemm(plasma_enum_t transa, plasma_enum_t transb,
                    plasma_complex64_t alpha, plasma_desc_t A,
                                              plasma_desc_t B,
                    plasma_complex64_t beta,  plasma_desc_t C,
+                   plasma_context_t *plasma,
                    plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_pzgerbt(plasma_enum_t side, plasma_enum_t trans, int depth,
+                    const double *u, plasma_desc_t A,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_pzgeqrf(plasma_desc_t A, plasma_desc_t T,
                     plasma_workspace_t work,
                     plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_pzgeqrf_static(plasma_desc_t A, plasma_desc_t T,
+                           plasma_workspace_t work,
+                           plasma_context_t *plasma,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request);
+
 void plasma_pzgeqrf_tree(plasma_desc_t A, plasma_desc_t T,
                          plasma_workspace_t work,
                          plasma_sequence_t *sequence,
@@ -97,6 +109,24 @@ void plasma_pzgetri_aux(plasma_desc_t A, plasma_desc_t W,
 void plasma_pzgetrf(plasma_desc_t A, int *ipiv,
                     plasma_sequence_t *sequence, plasma_request_t *request);
 
+size_t plasma_pzgetrf_arena_bytes(plasma_desc_t A, plasma_context_t *plasma);
+
+size_t plasma_pzgetrf_pool_bytes(plasma_desc_t A, plasma_context_t *plasma);
+
+void plasma_pzgetrf_static(plasma_desc_t A, int *ipiv,
+                           plasma_context_t *plasma,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request);
+
+void plasma_pzgetrf_incpiv(plasma_desc_t A, plasma_desc_t L, int *ipiv,
+                           plasma_workspace_t work,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request);
+
+void plasma_pzgetrf_nopiv(plasma_desc_t A,
+                          plasma_sequence_t *sequence,
+                          plasma_request_t *request);
+
 void plasma_pzge2gb(plasma_desc_t A, plasma_desc_t T,
                     plasma_workspace_t work,
                     plasma_sequence_t *sequence, plasma_request_t *request);    
@@ -132,6 +162,16 @@ void plasma_pzhetrf_aasen(plasma_enum_t uplo,
                           plasma_desc_t W,
                           plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_pzhetrf_nopiv(plasma_enum_t uplo, plasma_desc_t A,
+                          plasma_workspace_t work,
+                          plasma_sequence_t *sequence,
+                          plasma_request_t *request);
+
+void plasma_pzhetrs_nopiv(plasma_enum_t uplo, plasma_desc_t A,
+                          plasma_desc_t B,
+                          plasma_sequence_t *sequence,
+                          plasma_request_t *request);
+
 void plasma_pzlacpy(plasma_enum_t uplo, plasma_enum_t transa,
                     plasma_desc_t A, plasma_desc_t B,
                     plasma_sequence_t *sequence, plasma_request_t *request);
@@ -195,6 +235,11 @@ void plasma_pzpbtrf(plasma_enum_t uplo, plasma_desc_t A,
 void plasma_pzpotrf(plasma_enum_t uplo, plasma_desc_t A,
                     plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_pzpotrf_static(plasma_enum_t uplo, plasma_desc_t A,
+                           plasma_context_t *plasma,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request);
+
 void plasma_pzsymm(plasma_enum_t side, plasma_enum_t uplo,
                    plasma_complex64_t alpha, plasma_desc_t A,
                                              plasma_desc_t B,
@@ -241,6 +286,10 @@ void plasma_pztrsm(plasma_enum_t side, plasma_enum_t uplo,
                                              plasma_desc_t B,
                    plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_pztrsmpl(plasma_desc_t A, plasma_desc_t B,
+                     plasma_desc_t L, int *ipiv,
+                     plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_pztrtri(plasma_enum_t uplo, plasma_enum_t diag,
                     plasma_desc_t A,
                     plasma_sequence_t *sequence, plasma_request_t *request);
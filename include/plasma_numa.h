@@ -0,0 +1,33 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+#ifndef PLASMA_NUMA_H
+#define PLASMA_NUMA_H
+
+#include "plasma_types.h"
+#include "plasma_descriptor.h"
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************/
+int plasma_numa_alloc(plasma_desc_t *A, size_t size,
+                      plasma_enum_t placement, plasma_enum_t hugepages,
+                      int num_threads);
+void plasma_numa_free(plasma_desc_t *A);
+int plasma_numa_node(plasma_desc_t A, int m, int n);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif // PLASMA_NUMA_H
@@ -0,0 +1,75 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+#ifndef PLASMA_POOL_H
+#define PLASMA_POOL_H
+
+#include "plasma_allocator.h"
+
+#include <stddef.h>
+
+#include <omp.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************************//**
+ * @ingroup plasma_pool
+ *
+ * Header of a block of the pool, preceding the memory handed out.
+ *
+ **/
+typedef struct plasma_pool_block_s {
+    size_t size;                      ///< bytes of the size class
+    struct plasma_pool_block_s *next; ///< next idle block, released earlier
+    struct plasma_pool_block_s *prev; ///< previous idle block
+    int external;                     ///< carved out of a caller buffer,
+                                      ///< never released
+} plasma_pool_block_t;
+
+/***************************************************************************//**
+ * @ingroup plasma_pool
+ *
+ * Memory pool of the tile matrices, keeping the blocks released by
+ * finished calls for the next ones. Disabled while the limit is zero.
+ * While a caller buffer is set, the blocks are carved out of it instead.
+ *
+ **/
+typedef struct {
+    plasma_pool_block_t *head; ///< idle blocks, most recently released first
+    plasma_pool_block_t *tail; ///< least recently released idle block
+    size_t size;               ///< bytes held by the idle blocks
+    size_t limit;              ///< cap in bytes, zero disables the pool
+    const plasma_allocator_t *allocator; ///< source of the blocks
+    char *buffer;              ///< caller buffer of the running call, or NULL
+    size_t lbuffer;            ///< bytes of the caller buffer
+    size_t used;               ///< bytes carved out of the caller buffer
+    omp_lock_t lock;           ///< guards the idle blocks and the buffer
+} plasma_pool_t;
+
+/******************************************************************************/
+int plasma_pool_trim(void);
+
+void plasma_pool_init(plasma_pool_t *pool,
+                      const plasma_allocator_t *allocator);
+void plasma_pool_finalize(plasma_pool_t *pool);
+void plasma_pool_shrink(plasma_pool_t *pool, size_t limit);
+
+void *plasma_pool_alloc(plasma_pool_t *pool, size_t size);
+void plasma_pool_free(plasma_pool_t *pool, void *ptr);
+
+void plasma_pool_buffer(plasma_pool_t *pool, void *buffer, size_t size);
+size_t plasma_pool_bytes(size_t size);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif // PLASMA_POOL_H
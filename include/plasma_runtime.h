@@ -0,0 +1,165 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+#ifndef PLASMA_RUNTIME_H
+#define PLASMA_RUNTIME_H
+
+#include "plasma_async.h"
+#include "plasma_descriptor.h"
+#include "plasma_types.h"
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************************//**
+ * @ingroup plasma_runtime
+ *
+ * Access modes of task dependencies.
+ *
+ **/
+enum {
+    PlasmaDepNone  = 0,
+    PlasmaDepIn    = 1,
+    PlasmaDepOut   = 2,
+    PlasmaDepInout = 3
+};
+
+// offset of a tile handle not stored in the arguments of its task
+#define PLASMA_DEP_NOARG ((size_t)-1)
+
+// maximum number of memory regions the pointers of a graph refer to
+#define PLASMA_DAG_MAX_BASES 4
+
+/******************************************************************************/
+typedef void (*plasma_task_func_t)(void *args,
+                                   plasma_sequence_t *sequence,
+                                   plasma_request_t *request);
+
+/***************************************************************************//**
+ * @ingroup plasma_runtime
+ *
+ * Task dependency on a tile handle, i.e., the base address of a tile.
+ * The tile pointer is also stored in the task's arguments at offset,
+ * where it is updated when a recorded graph is replayed on another matrix,
+ * unless offset is PLASMA_DEP_NOARG.
+ * With mode PlasmaDepNone, ptr is not a dependency, only a pointer into
+ * one of the regions of the graph to be updated, e.g., the pivot vector.
+ *
+ **/
+typedef struct {
+    const void *ptr;    ///< tile handle
+    int mode;           ///< PlasmaDepIn, PlasmaDepOut or PlasmaDepInout
+    size_t offset;      ///< offset of the tile pointer in the arguments
+} plasma_dep_t;
+
+/***************************************************************************//**
+ * @ingroup plasma_runtime
+ *
+ * Pointer in the arguments of a task, moved with its region on replay.
+ *
+ **/
+typedef struct {
+    size_t offset;      ///< offset of the pointer in the arguments
+    int base;           ///< region of the graph the pointer refers to
+} plasma_reloc_t;
+
+/***************************************************************************//**
+ * @ingroup plasma_runtime
+ *
+ * Task of the native runtime.
+ *
+ **/
+typedef struct {
+    plasma_task_func_t func; ///< kernel wrapper
+    void *args;              ///< private copy of the arguments
+    plasma_reloc_t *reloc;   ///< pointers in args
+    int nreloc;              ///< number of pointers
+    int ndeps_init;          ///< number of predecessors
+    volatile int ndeps;      ///< predecessors not completed yet
+    int *succ;               ///< successors
+    int nsucc;               ///< number of successors
+    int capsucc;             ///< capacity of succ
+} plasma_task_t;
+
+/***************************************************************************//**
+ * @ingroup plasma_runtime
+ *
+ * Last accesses to a tile handle, used while inserting tasks.
+ *
+ **/
+typedef struct {
+    const void *ptr;    ///< tile handle, NULL for an empty slot
+    int writer;         ///< last task writing the tile, -1 if none
+    int *readers;       ///< tasks reading the tile since the last write
+    int nreaders;       ///< number of readers
+    int capreaders;     ///< capacity of readers
+} plasma_handle_t;
+
+/***************************************************************************//**
+ * @ingroup plasma_runtime
+ *
+ * Task graph of the native runtime.
+ * Tasks are inserted by a single thread and executed by plasma_dag_run()
+ * on per-thread work-stealing deques.
+ *
+ **/
+typedef struct {
+    plasma_task_t *tasks;       ///< tasks in insertion order
+    int num_tasks;              ///< number of tasks
+    int cap_tasks;              ///< capacity of tasks
+    plasma_handle_t *handles;   ///< hash table of tile handles
+    int cap_handles;            ///< capacity of handles, a power of two
+    int num_handles;            ///< number of used slots in handles
+    volatile int completed;     ///< number of completed tasks while running
+    const void *base[PLASMA_DAG_MAX_BASES]; ///< regions, e.g., matrices
+    int num_bases;              ///< number of regions, 0 if never replayed
+    int status;                 ///< PlasmaSuccess or first insertion error
+} plasma_dag_t;
+
+/***************************************************************************//**
+ * @ingroup plasma_runtime
+ *
+ * Recorded task graph of a routine, replayed on matrices of the same shape.
+ *
+ **/
+typedef struct plasma_graph_s {
+    const char *name;            ///< routine
+    int param;                   ///< routine's parameter, e.g., uplo
+    plasma_desc_t A;             ///< shape of the matrix
+    plasma_dag_t dag;            ///< task graph
+    struct plasma_graph_s *next; ///< next graph, less recently used
+} plasma_graph_t;
+
+/******************************************************************************/
+void plasma_dag_init(plasma_dag_t *dag);
+void plasma_dag_destroy(plasma_dag_t *dag);
+int  plasma_dag_insert(plasma_dag_t *dag, plasma_task_func_t func,
+                       const void *args, size_t size,
+                       int ndeps, const plasma_dep_t *deps);
+void plasma_dag_run(plasma_dag_t *dag,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+void plasma_dag_relocate(plasma_dag_t *dag, const void *const *base);
+
+plasma_dag_t *plasma_graph_lookup(plasma_graph_t **graphs, const char *name,
+                                  int param, plasma_desc_t A,
+                                  int num_bases, const void *const *base);
+plasma_dag_t *plasma_graph_record(plasma_graph_t **graphs, const char *name,
+                                  int param, plasma_desc_t A,
+                                  int num_bases, const void *const *base);
+void plasma_graph_remove(plasma_graph_t **graphs, plasma_dag_t *dag);
+void plasma_graph_destroy(plasma_graph_t **graphs);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif // PLASMA_RUNTIME_H
@@ -10,6 +10,8 @@
 #ifndef PLASMA_TREE_H
 #define PLASMA_TREE_H
 
+#include <stddef.h>
+
 enum {
     PlasmaGeKernel = 1,
     PlasmaTtKernel = 2,
@@ -69,4 +71,8 @@ void plasma_tree_operations(int mt, int nt,
                             plasma_sequence_t *sequence,
                             plasma_request_t *request);
 
+void plasma_tree_free(int *operations);
+
+size_t plasma_tree_bytes(int mt, int nt);
+
 #endif // PLASMA_TREE_H
@@ -78,6 +78,7 @@ enum {
     PlasmaLower         = 122,
     PlasmaGeneral       = 123,
     PlasmaGeneralBand   = 124,
+    PlasmaGeneralLapack = 125,
 
     PlasmaNonUnit       = 131,
     PlasmaUnit          = 132,
@@ -142,6 +143,34 @@ enum {
     PlasmaTreeHouseholder
 };
 
+enum {
+    PlasmaTileLayout,
+    PlasmaLapackLayout
+};
+
+enum {
+    PlasmaRuntimeOpenMP,
+    PlasmaRuntimeNative,
+    PlasmaRuntimeStatic
+};
+
+enum {
+    PlasmaPartialPivoting,
+    PlasmaTournamentPivoting
+};
+
+enum {
+    PlasmaColumnUpdate,
+    PlasmaTileUpdate
+};
+
+enum {
+    PlasmaPlacementDefault,
+    PlasmaPlacementInterleave,
+    PlasmaPlacementCyclic,
+    PlasmaPlacementFirstTouch
+};
+
 enum {
     PlasmaDisabled = 0,
     PlasmaEnabled = 1
@@ -153,7 +182,20 @@ enum {
     PlasmaIb,
     PlasmaInplaceOutplace,
     PlasmaNumPanelThreads,
-    PlasmaHouseholderMode
+    PlasmaHouseholderMode,
+    PlasmaLayout,
+    PlasmaCacheSize,
+    PlasmaNumThreads,
+    PlasmaRuntime,
+    PlasmaReplay,
+    PlasmaLookahead,
+    PlasmaPivoting,
+    PlasmaTrailingUpdate,
+    PlasmaGranularity,
+    PlasmaPlacement,
+    PlasmaHugePages,
+    PlasmaPoolSize,
+    PlasmaTeamWait
 };
 
 /******************************************************************************/
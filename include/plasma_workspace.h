@@ -32,6 +32,8 @@ int plasma_workspace_create(plasma_workspace_t *workspace, size_t lworkspace,
 
 int plasma_workspace_destroy(plasma_workspace_t *workspace);
 
+size_t plasma_workspace_bytes(size_t lworkspace, plasma_enum_t dtyp);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
@@ -16,6 +16,7 @@
 #include "plasma_async.h"
 #include "plasma_barrier.h"
 #include "plasma_descriptor.h"
+#include "plasma_factor.h"
 #include "plasma_workspace.h"
 
 #ifdef __cplusplus
@@ -69,6 +70,17 @@ int plasma_zgels(plasma_enum_t trans,
                  plasma_desc_t *T,
                  plasma_complex64_t *pB, int ldb);
 
+int plasma_zgels_buffer(plasma_enum_t trans,
+                        int m, int n, int nrhs,
+                        plasma_complex64_t *pA, int lda,
+                        plasma_desc_t *T,
+                        plasma_complex64_t *pB, int ldb,
+                        void *buffer, size_t size);
+
+int plasma_zgels_workspace_query(plasma_enum_t trans,
+                                 int m, int n, int nrhs,
+                                 size_t *size);
+
 int plasma_zgemm(plasma_enum_t transa, plasma_enum_t transb,
                  int m, int n, int k,
                  plasma_complex64_t alpha, plasma_complex64_t *pA, int lda,
@@ -79,6 +91,13 @@ int plasma_zgeqrf(int m, int n,
                   plasma_complex64_t *pA, int lda,
                   plasma_desc_t *T);
 
+int plasma_zgeqrf_buffer(int m, int n,
+                         plasma_complex64_t *pA, int lda,
+                         plasma_desc_t *T,
+                         void *buffer, size_t size);
+
+int plasma_zgeqrf_workspace_query(int m, int n, size_t *size);
+
 int plasma_zgeqrs(int m, int n, int nrhs,
                   plasma_complex64_t *pA, int lda,
                   plasma_desc_t T,
@@ -88,6 +107,19 @@ int plasma_zgesv(int n, int nrhs,
                  plasma_complex64_t *pA, int lda, int *ipiv,
                  plasma_complex64_t *pB, int ldb);
 
+int plasma_zgesv_buffer(int n, int nrhs,
+                        plasma_complex64_t *pA, int lda, int *ipiv,
+                        plasma_complex64_t *pB, int ldb,
+                        void *buffer, size_t size);
+
+int plasma_zgesv_workspace_query(int n, int nrhs, size_t *size);
+
+int plasma_zgesv_rbt(int n, int nrhs,
+                     plasma_complex64_t *pA, int lda,
+                     plasma_complex64_t *pB, int ldb,
+                     plasma_complex64_t *pX, int ldx,
+                     int itermax, int *iter);
+
 void plasma_omp_zgesdd(plasma_enum_t jobu, plasma_enum_t jobvt,
                        plasma_desc_t A, plasma_desc_t T,
                        double *S,
@@ -107,6 +139,14 @@ int plasma_zgesdd(plasma_enum_t jobu, plasma_enum_t jobvt,
 int plasma_zgetrf(int m, int n,
                   plasma_complex64_t *pA, int lda, int *ipiv);
 
+int plasma_zgetrf_handle(int m, int n,
+                         plasma_complex64_t *pA, int lda,
+                         plasma_factor_t *F);
+
+int plasma_zgetrf_incpiv(int m, int n,
+                         plasma_complex64_t *pA, int lda,
+                         plasma_desc_t *L, int **ipiv);
+
 int plasma_zgetri(int n, plasma_complex64_t *pA, int lda, int *ipiv);
 
 int plasma_zgetri_aux(int n, plasma_complex64_t *pA, int lda);
@@ -115,6 +155,14 @@ int plasma_zgetrs(plasma_enum_t trans, int n, int nrhs,
                   plasma_complex64_t *pA, int lda, int *ipiv,
                   plasma_complex64_t *pB, int ldb);
 
+int plasma_zgetrs_handle(plasma_enum_t trans, plasma_factor_t *F,
+                         int nrhs, plasma_complex64_t *pB, int ldb);
+
+int plasma_zgetrs_incpiv(int n, int nrhs,
+                         plasma_complex64_t *pA, int lda,
+                         plasma_desc_t L, int *ipiv,
+                         plasma_complex64_t *pB, int ldb);
+
 int plasma_zhemm(plasma_enum_t side, plasma_enum_t uplo,
                  int m, int n,
                  plasma_complex64_t alpha, plasma_complex64_t *pA, int lda,
@@ -144,6 +192,12 @@ int plasma_zhesv(plasma_enum_t uplo, int n, int nrhs,
                  int *ipiv2,
                  plasma_complex64_t *pB,  int ldb);
 
+int plasma_zhesv_rbt(plasma_enum_t uplo, int n, int nrhs,
+                     plasma_complex64_t *pA, int lda,
+                     plasma_complex64_t *pB, int ldb,
+                     plasma_complex64_t *pX, int ldx,
+                     int itermax, int *iter);
+
 int plasma_zhetrs(plasma_enum_t uplo, int n, int nrhs,
                   plasma_complex64_t *pA, int lda,
                   int *ipiv,
@@ -221,10 +275,23 @@ int plasma_zposv(plasma_enum_t uplo,
                  plasma_complex64_t *pA, int lda,
                  plasma_complex64_t *pB, int ldb);
 
+int plasma_zposv_buffer(plasma_enum_t uplo,
+                        int n, int nrhs,
+                        plasma_complex64_t *pA, int lda,
+                        plasma_complex64_t *pB, int ldb,
+                        void *buffer, size_t size);
+
+int plasma_zposv_workspace_query(plasma_enum_t uplo, int n, int nrhs,
+                                 size_t *size);
+
 int plasma_zpotrf(plasma_enum_t uplo,
                   int n,
                   plasma_complex64_t *pA, int lda);
 
+int plasma_zpotrf_handle(plasma_enum_t uplo, int n,
+                         plasma_complex64_t *pA, int lda,
+                         plasma_factor_t *F);
+
 int plasma_zpotri(plasma_enum_t uplo,
                   int n,
                   plasma_complex64_t *pA, int lda);
@@ -234,6 +301,9 @@ int plasma_zpotrs(plasma_enum_t uplo,
                   plasma_complex64_t *pA, int lda,
                   plasma_complex64_t *pB, int ldb);
 
+int plasma_zpotrs_handle(plasma_factor_t *F,
+                         int nrhs, plasma_complex64_t *pB, int ldb);
+
 int plasma_zsymm(plasma_enum_t side, plasma_enum_t uplo,
                  int m, int n,
                  plasma_complex64_t alpha, plasma_complex64_t *pA, int lda,
@@ -383,9 +453,23 @@ void plasma_omp_zgesv(plasma_desc_t A, int *ipiv,
                       plasma_desc_t B,
                       plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_omp_zgesv_rbt(plasma_desc_t A, plasma_desc_t B, plasma_desc_t X,
+                          plasma_desc_t Ar, plasma_desc_t R,
+                          int depth, const double *u, const double *v,
+                          int itermax,
+                          double *work, double *Rnorm, double *Xnorm,
+                          int *iter,
+                          plasma_sequence_t *sequence,
+                          plasma_request_t *request);
+
 void plasma_omp_zgetrf(plasma_desc_t A, int *ipiv,
                        plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_omp_zgetrf_incpiv(plasma_desc_t A, plasma_desc_t L, int *ipiv,
+                              plasma_workspace_t work,
+                              plasma_sequence_t *sequence,
+                              plasma_request_t *request);
+
 void plasma_omp_zgetri(plasma_desc_t A, int *ipiv, plasma_desc_t W,
                        plasma_sequence_t *sequence, plasma_request_t *request);
 
@@ -396,6 +480,11 @@ void plasma_omp_zgetrs(plasma_enum_t trans, plasma_desc_t A, int *ipiv,
                        plasma_desc_t B,
                        plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_omp_zgetrs_incpiv(plasma_desc_t A, plasma_desc_t L, int *ipiv,
+                              plasma_desc_t B,
+                              plasma_sequence_t *sequence,
+                              plasma_request_t *request);
+
 void plasma_omp_zhemm(plasma_enum_t side, plasma_enum_t uplo,
                       plasma_complex64_t alpha, plasma_desc_t A,
                                                 plasma_desc_t B,
@@ -428,6 +517,16 @@ void plasma_omp_zhesv(plasma_enum_t uplo,
                       plasma_sequence_t *sequence,
                       plasma_request_t *request);
 
+void plasma_omp_zhesv_rbt(plasma_enum_t uplo,
+                          plasma_desc_t A, plasma_desc_t B, plasma_desc_t X,
+                          plasma_desc_t Ar, plasma_desc_t R,
+                          int depth, const double *u,
+                          int itermax, plasma_workspace_t hwork,
+                          double *work, double *Rnorm, double *Xnorm,
+                          int *iter,
+                          plasma_sequence_t *sequence,
+                          plasma_request_t *request);
+
 void plasma_omp_zhetrs(plasma_enum_t uplo,
                        plasma_desc_t A, int *ipiv,
                        plasma_desc_t T, int *ipiv2,
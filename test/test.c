@@ -113,11 +113,31 @@ struct routines_t routines[] =
     { "cgesv", test_cgesv },
     { "sgesv", test_sgesv },
 
+    { "zgesv_rbt", test_zgesv_rbt },
+    { "dgesv_rbt", test_dgesv_rbt },
+    { "cgesv_rbt", test_cgesv_rbt },
+    { "sgesv_rbt", test_sgesv_rbt },
+
     { "zgetrf", test_zgetrf },
     { "dgetrf", test_dgetrf },
     { "cgetrf", test_cgetrf },
     { "sgetrf", test_sgetrf },
 
+    { "zge2desc", test_zge2desc },
+    { "dge2desc", test_dge2desc },
+    { "cge2desc", test_cge2desc },
+    { "sge2desc", test_sge2desc },
+
+    { "zgetrf_panel", test_zgetrf_panel },
+    { "dgetrf_panel", test_dgetrf_panel },
+    { "cgetrf_panel", test_cgetrf_panel },
+    { "sgetrf_panel", test_sgetrf_panel },
+
+    { "zgetrf_incpiv", test_zgetrf_incpiv },
+    { "dgetrf_incpiv", test_dgetrf_incpiv },
+    { "cgetrf_incpiv", test_cgetrf_incpiv },
+    { "sgetrf_incpiv", test_sgetrf_incpiv },
+
     { "zgetri", test_zgetri },
     { "dgetri", test_dgetri },
     { "cgetri", test_cgetri },
@@ -133,6 +153,11 @@ struct routines_t routines[] =
     { "cgetrs", test_cgetrs },
     { "sgetrs", test_sgetrs },
 
+    { "zgetrs_handle", test_zgetrs_handle },
+    { "dgetrs_handle", test_dgetrs_handle },
+    { "cgetrs_handle", test_cgetrs_handle },
+    { "sgetrs_handle", test_sgetrs_handle },
+
     { "zhemm", test_zhemm },
     { "", NULL },
     { "chemm", test_chemm },
@@ -158,6 +183,11 @@ struct routines_t routines[] =
     { "chesv", test_chesv },
     { "ssysv", test_ssysv },
 
+    { "zhesv_rbt", test_zhesv_rbt },
+    { "dsysv_rbt", test_dsysv_rbt },
+    { "chesv_rbt", test_chesv_rbt },
+    { "ssysv_rbt", test_ssysv_rbt },
+
     { "zlacpy", test_zlacpy },
     { "dlacpy", test_dlacpy },
     { "clacpy", test_clacpy },
@@ -248,6 +278,11 @@ struct routines_t routines[] =
     { "cpotrs", test_cpotrs },
     { "spotrs", test_spotrs },
 
+    { "zpotrs_handle", test_zpotrs_handle },
+    { "dpotrs_handle", test_dpotrs_handle },
+    { "cpotrs_handle", test_cpotrs_handle },
+    { "spotrs_handle", test_spotrs_handle },
+
     { "zsymm", test_zsymm },
     { "dsymm", test_dsymm },
     { "csymm", test_csymm },
@@ -340,6 +375,9 @@ static param_desc_t ParamDesc[] = {
     {"gflops",             "Gflop/s",      9,     false,
      "GFLOPS rate"},
 
+    {"gbytes",             "GB/s",         9,     false,
+     "bandwidth"},
+
     {"itersv",             "IterSv",       9,     false,
      "iterations to solution"},
 
@@ -393,6 +431,35 @@ static param_desc_t ParamDesc[] = {
     {"--hmode=[f|t]",      "House. mode",  11,    true,
      "Householder mode for QR/LQ - flat or tree [default: f]"},
 
+    {"--layout=[t|l]",     "layout",       6,     true,
+     "computational layout - tile (translated) or LAPACK (in place) [default: t]"},
+
+    {"--runtime=[o|n|s]",  "runtime",      7,     true,
+     "task runtime - OpenMP, native work stealing or static [default: o]"},
+
+    {"--replay=[n|y]",     "replay",       6,     true,
+     "replay task graphs recorded by the native runtime [default: n]"},
+
+    {"--pivot=[p|t]",      "pivot",        5,     true,
+     "LU pivoting - partial or tournament (CALU) [default: p]"},
+
+    {"--update=[c|t]",     "update",       6,     true,
+     "LU trailing update - by columns or by tiles [default: c]"},
+
+    {"--place=[d|i|c|f]",  "place",        5,     true,
+     "placement of the tiles on the NUMA nodes - default, interleaved,\n"
+     INDENT "block-cyclic or first touch [default: d]"},
+
+    {"--huge=[y|n]",       "huge",         4,     true,
+     "hugepages for the tiles [default: n]"},
+
+    {"--buffer=[y|n]",     "buffer",       6,     true,
+     "caller buffer of LAPACK-style routines [default: n]"},
+
+    {"--inplace=[i|o]",    "inplace",      7,     true,
+     "translation to tile layout of LAPACK-style routines - in place or\n"
+     INDENT "out of place [default: o]"},
+
     {"--eigt=[v|w]",       "eigt",         6,     true,
      "type of eigv. calc. v - vectors or w - vectors, values [default: v]"},
 
@@ -453,12 +520,24 @@ static param_desc_t ParamDesc[] = {
     {"--mtpf=",            "mtpf",         4,     true,
      "maximum number of threads for panel factorization [default: 1]"},
 
+    {"--lookahead=",       "lookahead",    9,     true,
+     "lookahead depth of the panels [default: 1]"},
+
     {"--zerocol=",         "zerocol",      7,     true,
      "if positive, a column of zeros inserted at that index [default: -1]"},
 
     {"--incx=",            "incx",         4,     true,
      "1 to pivot forward, -1 to pivot backward [default: 1]"},
 
+    {"--cache=",           "cache",        5,     true,
+     "translation cache size in MB, 0 disables the cache [default: 0]"},
+
+    {"--granularity=",     "granularity", 11,     true,
+     "minimum flops per task, 0 disables the grouping [default: 0]"},
+
+    {"--pool=",            "pool",         4,     true,
+     "memory pool size in MB, 0 disables the pool [default: 0]"},
+
     { NULL }  // last entry
 };
 
@@ -595,6 +674,7 @@ void print_routine_usage(const char *program_name, const char *name, param_value
             case PARAM_ORTHO:
             case PARAM_TIME:
             case PARAM_GFLOPS:
+            case PARAM_GBYTES:
             case PARAM_ITERSV:
                 break;
 
@@ -704,6 +784,15 @@ int test_routine(const char *name, param_value_t pval[], bool test)
             case PARAM_COLROW:
             case PARAM_NORM:
             case PARAM_HMODE:
+            case PARAM_LAYOUT:
+            case PARAM_RUNTIME:
+            case PARAM_REPLAY:
+            case PARAM_PIVOT:
+            case PARAM_UPDATE:
+            case PARAM_PLACE:
+            case PARAM_HUGE:
+            case PARAM_BUFFER:
+            case PARAM_INPLACE:
             case PARAM_EIGT:
             case PARAM_JOB:
             case PARAM_RANGE:
@@ -732,8 +821,12 @@ int test_routine(const char *name, param_value_t pval[], bool test)
             case PARAM_PADB:
             case PARAM_PADC:
             case PARAM_MTPF:
+            case PARAM_LOOKAHEAD:
             case PARAM_ZEROCOL:
             case PARAM_INCX:
+            case PARAM_CACHE:
+            case PARAM_GRAN:
+            case PARAM_POOL:
             case PARAM_ITERSV:
                 printf("  %*d", ParamDesc[i].width, pval[i].i);
                 break;
@@ -743,6 +836,7 @@ int test_routine(const char *name, param_value_t pval[], bool test)
             case PARAM_VU:
             case PARAM_TIME:
             case PARAM_GFLOPS:
+            case PARAM_GBYTES:
                 printf("  %*.4f", ParamDesc[i].width, pval[i].d);
                 break;
 
@@ -880,6 +974,25 @@ void param_read(int argc, char **argv, param_t param[])
         else if (param_starts_with(argv[i], "--hmode="))
             err = param_scan_char(strchr(argv[i], '=')+1, &param[PARAM_HMODE]);
 
+        else if (param_starts_with(argv[i], "--layout="))
+            err = param_scan_char(strchr(argv[i], '=')+1, &param[PARAM_LAYOUT]);
+        else if (param_starts_with(argv[i], "--runtime="))
+            err = param_scan_char(strchr(argv[i], '=')+1, &param[PARAM_RUNTIME]);
+        else if (param_starts_with(argv[i], "--replay="))
+            err = param_scan_char(strchr(argv[i], '=')+1, &param[PARAM_REPLAY]);
+        else if (param_starts_with(argv[i], "--pivot="))
+            err = param_scan_char(strchr(argv[i], '=')+1, &param[PARAM_PIVOT]);
+        else if (param_starts_with(argv[i], "--update="))
+            err = param_scan_char(strchr(argv[i], '=')+1, &param[PARAM_UPDATE]);
+        else if (param_starts_with(argv[i], "--place="))
+            err = param_scan_char(strchr(argv[i], '=')+1, &param[PARAM_PLACE]);
+        else if (param_starts_with(argv[i], "--huge="))
+            err = param_scan_char(strchr(argv[i], '=')+1, &param[PARAM_HUGE]);
+        else if (param_starts_with(argv[i], "--buffer="))
+            err = param_scan_char(strchr(argv[i], '=')+1, &param[PARAM_BUFFER]);
+        else if (param_starts_with(argv[i], "--inplace="))
+            err = param_scan_char(strchr(argv[i], '=')+1, &param[PARAM_INPLACE]);
+
         else if (param_starts_with(argv[i], "--eigt="))
             err = param_scan_char(strchr(argv[i], '=')+1, &param[PARAM_EIGT]);
 
@@ -926,10 +1039,18 @@ void param_read(int argc, char **argv, param_t param[])
 
         else if (param_starts_with(argv[i], "--mtpf="))
             err = param_scan_int(strchr(argv[i], '=')+1, &param[PARAM_MTPF]);
+        else if (param_starts_with(argv[i], "--lookahead="))
+            err = param_scan_int(strchr(argv[i], '=')+1, &param[PARAM_LOOKAHEAD]);
         else if (param_starts_with(argv[i], "--zerocol="))
             err = param_scan_int(strchr(argv[i], '=')+1, &param[PARAM_ZEROCOL]);
         else if (param_starts_with(argv[i], "--incx="))
             err = param_scan_int(strchr(argv[i], '=')+1, &param[PARAM_INCX]);
+        else if (param_starts_with(argv[i], "--cache="))
+            err = param_scan_int(strchr(argv[i], '=')+1, &param[PARAM_CACHE]);
+        else if (param_starts_with(argv[i], "--granularity="))
+            err = param_scan_int(strchr(argv[i], '=')+1, &param[PARAM_GRAN]);
+        else if (param_starts_with(argv[i], "--pool="))
+            err = param_scan_int(strchr(argv[i], '=')+1, &param[PARAM_POOL]);
 
         //--------------------------------------------------
         // Scan double precision parameters.
@@ -997,6 +1118,24 @@ void param_read(int argc, char **argv, param_t param[])
         param_add_char('o', &param[PARAM_NORM]);
     if (param[PARAM_HMODE].num == 0)
         param_add_char('f', &param[PARAM_HMODE]);
+    if (param[PARAM_LAYOUT].num == 0)
+        param_add_char('t', &param[PARAM_LAYOUT]);
+    if (param[PARAM_RUNTIME].num == 0)
+        param_add_char('o', &param[PARAM_RUNTIME]);
+    if (param[PARAM_REPLAY].num == 0)
+        param_add_char('n', &param[PARAM_REPLAY]);
+    if (param[PARAM_PIVOT].num == 0)
+        param_add_char('p', &param[PARAM_PIVOT]);
+    if (param[PARAM_UPDATE].num == 0)
+        param_add_char('c', &param[PARAM_UPDATE]);
+    if (param[PARAM_PLACE].num == 0)
+        param_add_char('d', &param[PARAM_PLACE]);
+    if (param[PARAM_HUGE].num == 0)
+        param_add_char('n', &param[PARAM_HUGE]);
+    if (param[PARAM_BUFFER].num == 0)
+        param_add_char('n', &param[PARAM_BUFFER]);
+    if (param[PARAM_INPLACE].num == 0)
+        param_add_char('o', &param[PARAM_INPLACE]);
 
     //--------------------------------------------------
     // Set integer parameters.
@@ -1026,10 +1165,18 @@ void param_read(int argc, char **argv, param_t param[])
 
     if (param[PARAM_MTPF].num == 0)
         param_add_int(1, &param[PARAM_MTPF]);
+    if (param[PARAM_LOOKAHEAD].num == 0)
+        param_add_int(1, &param[PARAM_LOOKAHEAD]);
     if (param[PARAM_ZEROCOL].num == 0)
         param_add_int(-1, &param[PARAM_ZEROCOL]);
     if (param[PARAM_INCX].num == 0)
         param_add_int(1, &param[PARAM_INCX]);
+    if (param[PARAM_CACHE].num == 0)
+        param_add_int(0, &param[PARAM_CACHE]);
+    if (param[PARAM_GRAN].num == 0)
+        param_add_int(0, &param[PARAM_GRAN]);
+    if (param[PARAM_POOL].num == 0)
+        param_add_int(0, &param[PARAM_POOL]);
 
     //--------------------------------------------------
     // Set double precision parameters.
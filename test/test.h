@@ -30,6 +30,7 @@ typedef enum {
     PARAM_ORTHO_V, // orthogonality of V error (SVD)
     PARAM_TIME,    // time to solution
     PARAM_GFLOPS,  // GFLOPS rate
+    PARAM_GBYTES,  // bandwidth in GB/s
     PARAM_ITERSV,  // iterations to solution
 
     //------------------------------------------------------
@@ -54,6 +55,15 @@ typedef enum {
     PARAM_UPLO,    // general rectangular or upper or lower triangular
     PARAM_DIAG,    // non-unit or unit diagonal
     PARAM_HMODE,   // Householder mode - tree or flat
+    PARAM_LAYOUT,  // matrix layout of LAPACK-style routines - tile or LAPACK
+    PARAM_RUNTIME, // task runtime - OpenMP, native or static
+    PARAM_REPLAY,  // replay of recorded task graphs - yes or no
+    PARAM_PIVOT,   // LU pivoting - partial or tournament
+    PARAM_UPDATE,  // LU trailing update - by columns or by tiles
+    PARAM_PLACE,   // placement of the tiles on the NUMA nodes
+    PARAM_HUGE,    // hugepages for the tiles
+    PARAM_BUFFER,  // caller buffer of LAPACK-style routines - yes or no
+    PARAM_INPLACE, // translation to tile layout - in place or out of place
     PARAM_EIGT,    // type of eigenvalue calculation:
                    //   eigenvalues only or eigenvalues and eigenvectors
     PARAM_JOB,     // type of eigenvalue / singular value calculation
@@ -76,8 +86,12 @@ typedef enum {
     PARAM_PADB,    // padding of B
     PARAM_PADC,    // padding of C
     PARAM_MTPF,    // maximum number of threads for panel factorization
+    PARAM_LOOKAHEAD, // lookahead depth of the panels
     PARAM_ZEROCOL, // if positive, a column of zeros inserted at that index
     PARAM_INCX,    // 1 to pivot forward, -1 to pivot backward
+    PARAM_CACHE,   // translation cache size in MB, 0 disables the cache
+    PARAM_GRAN,    // minimum flops per task, 0 disables the grouping
+    PARAM_POOL,    // memory pool size in MB, 0 disables the pool
 
     //------------------------------------------------------
     // Keep at the end!
@@ -21,6 +21,7 @@ void test_dzamax(param_value_t param[], bool run);
 void test_zgbmm(param_value_t param[], bool run);
 void test_zgbsv(param_value_t param[], bool run);
 void test_zgbtrf(param_value_t param[], bool run);
+void test_zge2desc(param_value_t param[], bool run);
 void test_zgeadd(param_value_t param[], bool run);
 void test_zgeinv(param_value_t param[], bool run);
 void test_zgelqf(param_value_t param[], bool run);
@@ -31,15 +32,20 @@ void test_zgeqrf(param_value_t param[], bool run);
 void test_zgeqrs(param_value_t param[], bool run);
 void test_zgesdd(param_value_t param[], bool run);
 void test_zgesv(param_value_t param[], bool run);
+void test_zgesv_rbt(param_value_t param[], bool run);
 void test_zgetrf(param_value_t param[], bool run);
+void test_zgetrf_panel(param_value_t param[], bool run);
+void test_zgetrf_incpiv(param_value_t param[], bool run);
 void test_zgetri(param_value_t param[], bool run);
 void test_zgetri_aux(param_value_t param[], bool run);
 void test_zgetrs(param_value_t param[], bool run);
+void test_zgetrs_handle(param_value_t param[], bool run);
 void test_zhemm(param_value_t param[], bool run);
 void test_zher2k(param_value_t param[], bool run);
 void test_zherk(param_value_t param[], bool run);
 void test_zhetrf(param_value_t param[], bool run);
 void test_zhesv(param_value_t param[], bool run);
+void test_zhesv_rbt(param_value_t param[], bool run);
 void test_zlacpy(param_value_t param[], bool run);
 void test_zlag2c(param_value_t param[], bool run);
 void test_zlange(param_value_t param[], bool run);
@@ -58,6 +64,7 @@ void test_zposv(param_value_t param[], bool run);
 void test_zpotrf(param_value_t param[], bool run);
 void test_zpotri(param_value_t param[], bool run);
 void test_zpotrs(param_value_t param[], bool run);
+void test_zpotrs_handle(param_value_t param[], bool run);
 void test_zsymm(param_value_t param[], bool run);
 void test_zsyr2k(param_value_t param[], bool run);
 void test_zsyrk(param_value_t param[], bool run);
@@ -51,6 +51,7 @@ void test_zgbtrf(param_value_t param[], bool run)
     param[PARAM_NB     ].used = true;
     param[PARAM_IB     ].used = true;
     param[PARAM_MTPF   ].used = true;
+    param[PARAM_LOOKAHEAD].used = true;
     param[PARAM_ZEROCOL].used = true;
     if (! run)
         return;
@@ -77,6 +78,7 @@ void test_zgbtrf(param_value_t param[], bool run)
     plasma_set(PlasmaNb, param[PARAM_NB].i);
     plasma_set(PlasmaIb, param[PARAM_IB].i);
     plasma_set(PlasmaNumPanelThreads, param[PARAM_MTPF].i);
+    plasma_set(PlasmaLookahead, param[PARAM_LOOKAHEAD].i);
 
     //================================================================
     // Allocate and initialize arrays.
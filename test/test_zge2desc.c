@@ -0,0 +1,169 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+#include "test.h"
+#include "plasma.h"
+#include "core_lapack.h"
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <omp.h>
+
+/***************************************************************************//**
+ *
+ * @brief Tests the translation between LAPACK and tile layout,
+ *        plasma_omp_zge2desc and plasma_omp_zdesc2ge.
+ *
+ * Translates an m-by-n matrix to tile layout and back, into tiles of its
+ * own (--inplace=o) or in place in the array (--inplace=i), and reports
+ * the bandwidth of the round trip, counting the matrix read and written
+ * once each way, to compare the two. The test checks the tiles against
+ * the array, and the array, padding included, against its copy.
+ *
+ * @param[in,out] param - array of parameters
+ * @param[in]     run - whether to run test
+ *
+ * Sets flags in param indicating which parameters are used.
+ * If run is true, also runs test and stores output parameters.
+ ******************************************************************************/
+void test_zge2desc(param_value_t param[], bool run)
+{
+    //================================================================
+    // Mark which parameters are used.
+    //================================================================
+    param[PARAM_DIM    ].used = PARAM_USE_M | PARAM_USE_N;
+    param[PARAM_PADA   ].used = true;
+    param[PARAM_NB     ].used = true;
+    param[PARAM_INPLACE].used = true;
+    param[PARAM_GBYTES ].used = true;
+    if (! run)
+        return;
+
+    //================================================================
+    // Set parameters.
+    //================================================================
+    int m = param[PARAM_DIM].dim.m;
+    int n = param[PARAM_DIM].dim.n;
+    int nb = param[PARAM_NB].i;
+
+    int lda = imax(1, m + param[PARAM_PADA].i);
+
+    int test = param[PARAM_TEST].c == 'y';
+
+    //================================================================
+    // Allocate and initialize arrays.
+    //================================================================
+    plasma_complex64_t *A =
+        (plasma_complex64_t*)malloc((size_t)lda*n*sizeof(plasma_complex64_t));
+    assert(A != NULL);
+
+    int seed[] = {0, 0, 0, 1};
+    lapack_int retval;
+    retval = LAPACKE_zlarnv(1, seed, (size_t)lda*n, A);
+    assert(retval == 0);
+
+    plasma_complex64_t *Aref = NULL;
+    if (test) {
+        Aref = (plasma_complex64_t*)malloc(
+            (size_t)lda*n*sizeof(plasma_complex64_t));
+        assert(Aref != NULL);
+
+        memcpy(Aref, A, (size_t)lda*n*sizeof(plasma_complex64_t));
+    }
+
+    plasma_desc_t T;
+    if (param[PARAM_INPLACE].c == 'i')
+        retval = plasma_desc_general_inplace_init(PlasmaComplexDouble, A,
+                                                  nb, nb, lda, n,
+                                                  0, 0, m, n, &T);
+    else
+        retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
+                                            m, n, 0, 0, m, n, &T);
+    assert(retval == PlasmaSuccess);
+
+    plasma_sequence_t sequence;
+    plasma_sequence_init(&sequence);
+    plasma_request_t request;
+    plasma_request_init(&request);
+
+    //================================================================
+    // Run and time the translation to tile layout.
+    //================================================================
+    plasma_time_t start = omp_get_wtime();
+    #pragma omp parallel
+    #pragma omp master
+    {
+        plasma_omp_zge2desc(A, lda, T, &sequence, &request);
+    }
+    plasma_time_t stop = omp_get_wtime();
+    plasma_time_t time = stop-start;
+
+    // Count the elements of the tiles differing from the array.
+    size_t errors = 0;
+    if (test) {
+        for (int tm = 0; tm < T.mt; tm++) {
+            int mvtm = plasma_tile_mview(T, tm);
+            int ldt = plasma_tile_mmain(T, tm);
+            for (int tn = 0; tn < T.nt; tn++) {
+                int nvtn = plasma_tile_nview(T, tn);
+                plasma_complex64_t *tile =
+                    (plasma_complex64_t*)plasma_tile_addr(T, tm, tn);
+                for (int j = 0; j < nvtn; j++)
+                    for (int i = 0; i < mvtm; i++)
+                        if (tile[i+(size_t)ldt*j] !=
+                            Aref[tm*nb+i+(size_t)lda*(tn*nb+j)])
+                            errors++;
+            }
+        }
+    }
+
+    //================================================================
+    // Run and time the translation back to LAPACK layout.
+    //================================================================
+    start = omp_get_wtime();
+    #pragma omp parallel
+    #pragma omp master
+    {
+        plasma_omp_zdesc2ge(T, A, lda, &sequence, &request);
+    }
+    stop = omp_get_wtime();
+    time += stop-start;
+
+    param[PARAM_TIME].d = time;
+    param[PARAM_GFLOPS].d = 0.0;
+    param[PARAM_GBYTES].d =
+        4.0*m*n*sizeof(plasma_complex64_t) / time / 1e9;
+
+    //================================================================
+    // Test results by comparing to the copy of the array.
+    //================================================================
+    if (test) {
+        for (size_t k = 0; k < (size_t)lda*n; k++)
+            if (A[k] != Aref[k])
+                errors++;
+
+        param[PARAM_ERROR].d = (double)errors;
+        param[PARAM_SUCCESS].i = errors == 0 &&
+                                 sequence.status == PlasmaSuccess;
+    }
+
+    //================================================================
+    // Free arrays.
+    //================================================================
+    plasma_desc_destroy(&T);
+    free(A);
+    if (test)
+        free(Aref);
+}
@@ -151,7 +151,10 @@ void test_zgeinv(param_value_t param[], bool run)
             param[PARAM_SUCCESS].i = error < tol;
         }
         else {
-            if (plainfo == lapinfo) {
+            // A singular A keeps its factors, with no inverse computed.
+            double Amax = LAPACKE_zlange_work(
+                              LAPACK_COL_MAJOR, 'M', m, n, A, lda, &temp);
+            if (plainfo == lapinfo && isfinite(Amax)) {
                 param[PARAM_ERROR].d = 0.0;
                 param[PARAM_SUCCESS].i = 1;
             }
@@ -48,6 +48,8 @@ void test_zgels(param_value_t param[], bool run)
     param[PARAM_NB     ].used = true;
     param[PARAM_IB     ].used = true;
     param[PARAM_HMODE  ].used = true;
+    param[PARAM_BUFFER ].used = true;
+    param[PARAM_INPLACE].used = true;
     if (! run)
         return;
 
@@ -78,6 +80,10 @@ void test_zgels(param_value_t param[], bool run)
     else {
         plasma_set(PlasmaHouseholderMode, PlasmaFlatHouseholder);
     }
+    if (param[PARAM_INPLACE].c == 'i')
+        plasma_set(PlasmaInplaceOutplace, PlasmaInplace);
+    else
+        plasma_set(PlasmaInplaceOutplace, PlasmaOutplace);
 
     //================================================================
     // Allocate and initialize arrays.
@@ -121,14 +127,32 @@ void test_zgels(param_value_t param[], bool run)
     //================================================================
     plasma_desc_t T;
 
+    // Carve the tile matrices, T and the workspaces out of a buffer of
+    // the tester.
+    void *buffer = NULL;
+    size_t lbuffer = 0;
+    if (param[PARAM_BUFFER].c == 'y') {
+        retval = plasma_zgels_workspace_query(trans, m, n, nrhs, &lbuffer);
+        assert(retval == PlasmaSuccess);
+        retval = posix_memalign(&buffer, PLASMA_ALLOCATOR_ALIGN, lbuffer);
+        assert(retval == 0);
+    }
+
     //================================================================
     // Run and time PLASMA.
     //================================================================
     plasma_time_t start = omp_get_wtime();
-    plasma_zgels(trans, m, n, nrhs,
-                 A, lda,
-                 &T,
-                 B, ldb);
+    if (param[PARAM_BUFFER].c == 'y')
+        plasma_zgels_buffer(trans, m, n, nrhs,
+                            A, lda,
+                            &T,
+                            B, ldb,
+                            buffer, lbuffer);
+    else
+        plasma_zgels(trans, m, n, nrhs,
+                     A, lda,
+                     &T,
+                     B, ldb);
     plasma_time_t stop = omp_get_wtime();
     plasma_time_t time = stop-start;
 
@@ -226,6 +250,7 @@ void test_zgels(param_value_t param[], bool run)
     // Free arrays.
     //================================================================
     plasma_desc_destroy(&T);
+    free(buffer);
     free(A);
     free(B);
     if (test) {
@@ -49,6 +49,12 @@ void test_zgemm(param_value_t param[], bool run)
     param[PARAM_PADB   ].used = true;
     param[PARAM_PADC   ].used = true;
     param[PARAM_NB     ].used = true;
+    param[PARAM_LAYOUT ].used = true;
+    param[PARAM_CACHE  ].used = true;
+    param[PARAM_GRAN   ].used = true;
+    param[PARAM_PLACE  ].used = true;
+    param[PARAM_HUGE   ].used = true;
+    param[PARAM_POOL   ].used = true;
     if (! run)
         return;
 
@@ -105,6 +111,25 @@ void test_zgemm(param_value_t param[], bool run)
     //================================================================
     plasma_set(PlasmaTuning, PlasmaDisabled);
     plasma_set(PlasmaNb, param[PARAM_NB].i);
+    if (param[PARAM_LAYOUT].c == 'l')
+        plasma_set(PlasmaLayout, PlasmaLapackLayout);
+    else
+        plasma_set(PlasmaLayout, PlasmaTileLayout);
+    plasma_set(PlasmaCacheSize, param[PARAM_CACHE].i);
+    plasma_set(PlasmaGranularity, param[PARAM_GRAN].i);
+    plasma_set(PlasmaPoolSize, param[PARAM_POOL].i);
+    if (param[PARAM_PLACE].c == 'i')
+        plasma_set(PlasmaPlacement, PlasmaPlacementInterleave);
+    else if (param[PARAM_PLACE].c == 'c')
+        plasma_set(PlasmaPlacement, PlasmaPlacementCyclic);
+    else if (param[PARAM_PLACE].c == 'f')
+        plasma_set(PlasmaPlacement, PlasmaPlacementFirstTouch);
+    else
+        plasma_set(PlasmaPlacement, PlasmaPlacementDefault);
+    if (param[PARAM_HUGE].c == 'y')
+        plasma_set(PlasmaHugePages, PlasmaEnabled);
+    else
+        plasma_set(PlasmaHugePages, PlasmaDisabled);
 
     //================================================================
     // Allocate and initialize arrays.
@@ -141,6 +166,24 @@ void test_zgemm(param_value_t param[], bool run)
         memcpy(Cref, C, (size_t)ldc*Cn*sizeof(plasma_complex64_t));
     }
 
+    // With the cache on, a first call fills it and the timed call reuses it.
+    if (param[PARAM_CACHE].i > 0) {
+        plasma_complex64_t *Cw =
+            (plasma_complex64_t*)malloc(
+                (size_t)ldc*Cn*sizeof(plasma_complex64_t));
+        assert(Cw != NULL);
+        memcpy(Cw, C, (size_t)ldc*Cn*sizeof(plasma_complex64_t));
+
+        plasma_zgemm(
+            transa, transb,
+            m, n, k,
+            alpha, A, lda,
+                   B, ldb,
+             beta, Cw, ldc);
+
+        free(Cw);
+    }
+
     //================================================================
     // Run and time PLASMA.
     //================================================================
@@ -201,8 +244,9 @@ void test_zgemm(param_value_t param[], bool run)
     }
 
     //================================================================
-    // Free arrays.
+    // Free arrays, dropping their cached copies first.
     //================================================================
+    plasma_cache_invalidate(NULL);
     free(A);
     free(B);
     free(C);
@@ -45,6 +45,11 @@ void test_zgeqrf(param_value_t param[], bool run)
     param[PARAM_NB     ].used = true;
     param[PARAM_IB     ].used = true;
     param[PARAM_HMODE  ].used = true;
+    param[PARAM_BUFFER ].used = true;
+    param[PARAM_INPLACE].used = true;
+    param[PARAM_RUNTIME].used = true;
+    param[PARAM_REPLAY ].used = true;
+    param[PARAM_LOOKAHEAD].used = true;
     if (! run)
         return;
 
@@ -69,6 +74,21 @@ void test_zgeqrf(param_value_t param[], bool run)
         plasma_set(PlasmaHouseholderMode, PlasmaTreeHouseholder);
     else
         plasma_set(PlasmaHouseholderMode, PlasmaFlatHouseholder);
+    if (param[PARAM_INPLACE].c == 'i')
+        plasma_set(PlasmaInplaceOutplace, PlasmaInplace);
+    else
+        plasma_set(PlasmaInplaceOutplace, PlasmaOutplace);
+    if (param[PARAM_RUNTIME].c == 'n')
+        plasma_set(PlasmaRuntime, PlasmaRuntimeNative);
+    else if (param[PARAM_RUNTIME].c == 's')
+        plasma_set(PlasmaRuntime, PlasmaRuntimeStatic);
+    else
+        plasma_set(PlasmaRuntime, PlasmaRuntimeOpenMP);
+    if (param[PARAM_REPLAY].c == 'y')
+        plasma_set(PlasmaReplay, PlasmaEnabled);
+    else
+        plasma_set(PlasmaReplay, PlasmaDisabled);
+    plasma_set(PlasmaLookahead, param[PARAM_LOOKAHEAD].i);
 
     //================================================================
     // Allocate and initialize arrays.
@@ -96,11 +116,25 @@ void test_zgeqrf(param_value_t param[], bool run)
     //================================================================
     plasma_desc_t T;
 
+    // Carve the tile matrix, T and the workspaces out of a buffer of
+    // the tester.
+    void *buffer = NULL;
+    size_t lbuffer = 0;
+    if (param[PARAM_BUFFER].c == 'y') {
+        retval = plasma_zgeqrf_workspace_query(m, n, &lbuffer);
+        assert(retval == PlasmaSuccess);
+        retval = posix_memalign(&buffer, PLASMA_ALLOCATOR_ALIGN, lbuffer);
+        assert(retval == 0);
+    }
+
     //================================================================
     // Run and time PLASMA.
     //================================================================
     plasma_time_t start = omp_get_wtime();
-    plasma_zgeqrf(m, n, A, lda, &T);
+    if (param[PARAM_BUFFER].c == 'y')
+        plasma_zgeqrf_buffer(m, n, A, lda, &T, buffer, lbuffer);
+    else
+        plasma_zgeqrf(m, n, A, lda, &T);
     plasma_time_t stop = omp_get_wtime();
     plasma_time_t time = stop-start;
 
@@ -193,6 +227,7 @@ void test_zgeqrf(param_value_t param[], bool run)
     // Free arrays.
     //================================================================
     plasma_desc_destroy(&T);
+    free(buffer);
     free(A);
     if (test)
         free(Aref);
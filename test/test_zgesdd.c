@@ -47,6 +47,7 @@ void test_zgesdd(param_value_t param[], bool run)
     param[PARAM_NB    ].used = true;
     param[PARAM_IB    ].used = true;
     param[PARAM_HMODE ].used = true;
+    param[PARAM_POOL  ].used = true;
     param[PARAM_ERROR2].used = true;
     param[PARAM_ORTHO_U].used = true;
     param[PARAM_ORTHO_V].used = true;
@@ -73,6 +74,7 @@ void test_zgesdd(param_value_t param[], bool run)
     // Set tuning parameters.
     //================================================================
     plasma_set(PlasmaNb, param[PARAM_NB].i);
+    plasma_set(PlasmaPoolSize, param[PARAM_POOL].i);
     plasma_set(PlasmaIb, param[PARAM_IB].i);
 
     if (param[PARAM_HMODE].c == 't') {
@@ -17,6 +17,7 @@
 #include "core_lapack.h"
 
 #include <assert.h>
+#include <math.h>
 #include <stddef.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -50,6 +51,14 @@ void test_zgesv(param_value_t param[], bool run)
     param[PARAM_NB     ].used = true;
     param[PARAM_IB     ].used = true;
     param[PARAM_MTPF   ].used = true;
+    param[PARAM_RUNTIME].used = true;
+    param[PARAM_REPLAY ].used = true;
+    param[PARAM_PIVOT  ].used = true;
+    param[PARAM_UPDATE ].used = true;
+    param[PARAM_ZEROCOL].used = true;
+    param[PARAM_LAYOUT ].used = true;
+    param[PARAM_BUFFER ].used = true;
+    param[PARAM_INPLACE].used = true;
     if (! run)
         return;
 
@@ -72,6 +81,32 @@ void test_zgesv(param_value_t param[], bool run)
     plasma_set(PlasmaNb, param[PARAM_NB].i);
     plasma_set(PlasmaIb, param[PARAM_IB].i);
     plasma_set(PlasmaNumPanelThreads, param[PARAM_MTPF].i);
+    if (param[PARAM_LAYOUT].c == 'l')
+        plasma_set(PlasmaLayout, PlasmaLapackLayout);
+    else
+        plasma_set(PlasmaLayout, PlasmaTileLayout);
+    if (param[PARAM_INPLACE].c == 'i')
+        plasma_set(PlasmaInplaceOutplace, PlasmaInplace);
+    else
+        plasma_set(PlasmaInplaceOutplace, PlasmaOutplace);
+    if (param[PARAM_RUNTIME].c == 'n')
+        plasma_set(PlasmaRuntime, PlasmaRuntimeNative);
+    else if (param[PARAM_RUNTIME].c == 's')
+        plasma_set(PlasmaRuntime, PlasmaRuntimeStatic);
+    else
+        plasma_set(PlasmaRuntime, PlasmaRuntimeOpenMP);
+    if (param[PARAM_REPLAY].c == 'y')
+        plasma_set(PlasmaReplay, PlasmaEnabled);
+    else
+        plasma_set(PlasmaReplay, PlasmaDisabled);
+    if (param[PARAM_PIVOT].c == 't')
+        plasma_set(PlasmaPivoting, PlasmaTournamentPivoting);
+    else
+        plasma_set(PlasmaPivoting, PlasmaPartialPivoting);
+    if (param[PARAM_UPDATE].c == 't')
+        plasma_set(PlasmaTrailingUpdate, PlasmaTileUpdate);
+    else
+        plasma_set(PlasmaTrailingUpdate, PlasmaColumnUpdate);
 
     //================================================================
     // Allocate and initialize arrays.
@@ -96,6 +131,10 @@ void test_zgesv(param_value_t param[], bool run)
     retval = LAPACKE_zlarnv(1, seed, (size_t)ldb*nrhs, B);
     assert(retval == 0);
 
+    int zerocol = param[PARAM_ZEROCOL].i;
+    if (zerocol >= 0 && zerocol < n)
+        memset(&A[zerocol*lda], 0, n*sizeof(plasma_complex64_t));
+
     plasma_complex64_t *Aref = NULL;
     plasma_complex64_t *Bref = NULL;
     double *work = NULL;
@@ -112,11 +151,26 @@ void test_zgesv(param_value_t param[], bool run)
         memcpy(Bref, B, (size_t)ldb*nrhs*sizeof(plasma_complex64_t));
     }
 
+    // Carve the tile matrices out of a buffer of the tester.
+    void *buffer = NULL;
+    size_t lbuffer = 0;
+    if (param[PARAM_BUFFER].c == 'y') {
+        retval = plasma_zgesv_workspace_query(n, nrhs, &lbuffer);
+        assert(retval == PlasmaSuccess);
+        retval = posix_memalign(&buffer, PLASMA_ALLOCATOR_ALIGN, lbuffer);
+        assert(retval == 0);
+    }
+
     //================================================================
     // Run and time PLASMA.
     //================================================================
     plasma_time_t start = omp_get_wtime();
-    plasma_zgesv(n, nrhs, A, lda, ipiv, B, ldb);
+    int plainfo;
+    if (param[PARAM_BUFFER].c == 'y')
+        plainfo = plasma_zgesv_buffer(n, nrhs, A, lda, ipiv, B, ldb,
+                                      buffer, lbuffer);
+    else
+        plainfo = plasma_zgesv(n, nrhs, A, lda, ipiv, B, ldb);
     plasma_time_t stop = omp_get_wtime();
     plasma_time_t time = stop-start;
 
@@ -132,7 +186,25 @@ void test_zgesv(param_value_t param[], bool run)
     //                 || A ||_I * || X ||_I * N
     //
     //================================================================
-    if (test) {
+    if (test && zerocol >= 0 && zerocol < n) {
+        // A is singular: check the index of the first zero pivot,
+        // and that B is left untouched, as in LAPACK.
+        int lapinfo = LAPACKE_zgetrf(LAPACK_COL_MAJOR, n, n, Aref, lda, ipiv);
+        bool untouched = true;
+        for (int j = 0; j < nrhs && untouched; j++)
+            untouched = memcmp(&B[(size_t)ldb*j], &Bref[(size_t)ldb*j],
+                               n*sizeof(plasma_complex64_t)) == 0;
+
+        if (plainfo == lapinfo && untouched) {
+            param[PARAM_ERROR].d = 0.0;
+            param[PARAM_SUCCESS].i = 1;
+        }
+        else {
+            param[PARAM_ERROR].d = INFINITY;
+            param[PARAM_SUCCESS].i = 0;
+        }
+    }
+    else if (test) {
         plasma_complex64_t zone  =  1.0;
         plasma_complex64_t zmone = -1.0;
 
@@ -164,6 +236,7 @@ void test_zgesv(param_value_t param[], bool run)
     free(A);
     free(B);
     free(ipiv);
+    free(buffer);
     if (test) {
         free(Aref);
         free(Bref);
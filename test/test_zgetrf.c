@@ -46,7 +46,14 @@ void test_zgetrf(param_value_t param[], bool run)
     param[PARAM_NB     ].used = true;
     param[PARAM_IB     ].used = true;
     param[PARAM_MTPF   ].used = true;
+    param[PARAM_RUNTIME].used = true;
+    param[PARAM_REPLAY ].used = true;
+    param[PARAM_LOOKAHEAD].used = true;
+    param[PARAM_PIVOT  ].used = true;
+    param[PARAM_UPDATE ].used = true;
     param[PARAM_ZEROCOL].used = true;
+    param[PARAM_LAYOUT ].used = true;
+    param[PARAM_INPLACE].used = true;
     if (! run)
         return;
 
@@ -68,6 +75,33 @@ void test_zgetrf(param_value_t param[], bool run)
     plasma_set(PlasmaNb, param[PARAM_NB].i);
     plasma_set(PlasmaIb, param[PARAM_IB].i);
     plasma_set(PlasmaNumPanelThreads, param[PARAM_MTPF].i);
+    if (param[PARAM_LAYOUT].c == 'l')
+        plasma_set(PlasmaLayout, PlasmaLapackLayout);
+    else
+        plasma_set(PlasmaLayout, PlasmaTileLayout);
+    if (param[PARAM_INPLACE].c == 'i')
+        plasma_set(PlasmaInplaceOutplace, PlasmaInplace);
+    else
+        plasma_set(PlasmaInplaceOutplace, PlasmaOutplace);
+    if (param[PARAM_RUNTIME].c == 'n')
+        plasma_set(PlasmaRuntime, PlasmaRuntimeNative);
+    else if (param[PARAM_RUNTIME].c == 's')
+        plasma_set(PlasmaRuntime, PlasmaRuntimeStatic);
+    else
+        plasma_set(PlasmaRuntime, PlasmaRuntimeOpenMP);
+    if (param[PARAM_REPLAY].c == 'y')
+        plasma_set(PlasmaReplay, PlasmaEnabled);
+    else
+        plasma_set(PlasmaReplay, PlasmaDisabled);
+    plasma_set(PlasmaLookahead, param[PARAM_LOOKAHEAD].i);
+    if (param[PARAM_PIVOT].c == 't')
+        plasma_set(PlasmaPivoting, PlasmaTournamentPivoting);
+    else
+        plasma_set(PlasmaPivoting, PlasmaPartialPivoting);
+    if (param[PARAM_UPDATE].c == 't')
+        plasma_set(PlasmaTrailingUpdate, PlasmaTileUpdate);
+    else
+        plasma_set(PlasmaTrailingUpdate, PlasmaColumnUpdate);
 
     //================================================================
     // Allocate and initialize arrays.
@@ -112,8 +146,52 @@ void test_zgetrf(param_value_t param[], bool run)
     // Test results by comparing to a reference implementation.
     // This will give spurious failures if LAPACK picks different pivots
     // than PLASMA. Should test solve or ||PA - LU||.
+    // Tournament pivoting picks different pivots by design, so it is
+    // tested by ||PA - LU|| / (n ||A||).
     //================================================================
-    if (test) {
+    if (test && param[PARAM_PIVOT].c == 't' && plainfo == 0) {
+        int minmn = imin(m, n);
+        plasma_complex64_t *L = (plasma_complex64_t*)malloc(
+            (size_t)m*minmn*sizeof(plasma_complex64_t));
+        assert(L != NULL);
+        plasma_complex64_t *U = (plasma_complex64_t*)malloc(
+            (size_t)minmn*n*sizeof(plasma_complex64_t));
+        assert(U != NULL);
+
+        LAPACKE_zlacpy_work(LAPACK_COL_MAJOR, 'L', m, minmn, A, lda, L, m);
+        LAPACKE_zlaset_work(LAPACK_COL_MAJOR, 'U', m, minmn, 0.0, 1.0, L, m);
+        LAPACKE_zlaset_work(LAPACK_COL_MAJOR, 'L', minmn, n, 0.0, 0.0,
+                            U, minmn);
+        LAPACKE_zlacpy_work(LAPACK_COL_MAJOR, 'U', minmn, n, A, lda,
+                            U, minmn);
+
+        double work[1];
+        double Anorm = LAPACKE_zlange_work(
+            LAPACK_COL_MAJOR, 'F', m, n, Aref, lda, work);
+
+        // PA - LU
+        LAPACKE_zlaswp_work(LAPACK_COL_MAJOR, n, Aref, lda, 1, minmn, ipiv, 1);
+        plasma_complex64_t zone = 1.0;
+        plasma_complex64_t zmone = -1.0;
+        cblas_zgemm(CblasColMajor, CblasNoTrans, CblasNoTrans,
+                    m, n, minmn,
+                    CBLAS_SADDR(zmone), L, m,
+                                        U, minmn,
+                    CBLAS_SADDR(zone),  Aref, lda);
+
+        double error = LAPACKE_zlange_work(
+            LAPACK_COL_MAJOR, 'F', m, n, Aref, lda, work);
+        if (Anorm != 0.0)
+            error /= Anorm;
+        error /= imax(1, n);
+
+        param[PARAM_ERROR].d = error;
+        param[PARAM_SUCCESS].i = error < tol;
+
+        free(L);
+        free(U);
+    }
+    else if (test) {
         int lapinfo = LAPACKE_zgetrf(
             LAPACK_COL_MAJOR,
             m, n,
@@ -0,0 +1,168 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+#include "test.h"
+#include "flops.h"
+#include "plasma.h"
+#include <plasma_core_blas.h>
+#include "core_lapack.h"
+
+#include <assert.h>
+#include <math.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <omp.h>
+
+#define COMPLEX
+
+/***************************************************************************//**
+ *
+ * @brief Tests the multithreaded LU panel factorization plasma_core_zgetrf.
+ *
+ * Factors an m-by-n panel in tiles of nb rows with mtpf threads,
+ * which synchronize through plasma_barrier_wait. Timing the panel for
+ * an increasing number of threads, e.g., --mtpf=1,2,4,8, measures the
+ * scalability of the panel and the overhead of the barrier.
+ *
+ * @param[in,out] param - array of parameters
+ * @param[in]     run - whether to run test
+ *
+ * Sets flags in param indicating which parameters are used.
+ * If run is true, also runs test and stores output parameters.
+ ******************************************************************************/
+void test_zgetrf_panel(param_value_t param[], bool run)
+{
+    //================================================================
+    // Mark which parameters are used.
+    //================================================================
+    param[PARAM_DIM    ].used = PARAM_USE_M | PARAM_USE_N;
+    param[PARAM_NB     ].used = true;
+    param[PARAM_IB     ].used = true;
+    param[PARAM_MTPF   ].used = true;
+    if (! run)
+        return;
+
+    //================================================================
+    // Set parameters.
+    //================================================================
+    int m = param[PARAM_DIM].dim.m;
+    int n = param[PARAM_DIM].dim.n;
+    int nb = param[PARAM_NB].i;
+    int ib = param[PARAM_IB].i;
+    int num_panel_threads = param[PARAM_MTPF].i;
+
+    int lda = imax(1, m);
+
+    int    test = param[PARAM_TEST].c == 'y';
+    double tol  = param[PARAM_TOL].d * LAPACKE_dlamch('E');
+
+    //================================================================
+    // Allocate and initialize arrays.
+    //================================================================
+    plasma_complex64_t *A =
+        (plasma_complex64_t*)malloc((size_t)lda*n*sizeof(plasma_complex64_t));
+    assert(A != NULL);
+
+    int *ipiv = (int*)malloc((size_t)imin(m, n)*sizeof(int));
+    assert(ipiv != NULL);
+
+    int seed[] = {0, 0, 0, 1};
+    lapack_int retval;
+    retval = LAPACKE_zlarnv(1, seed, (size_t)lda*n, A);
+    assert(retval == 0);
+
+    plasma_complex64_t *Aref = NULL;
+    if (test) {
+        Aref = (plasma_complex64_t*)malloc(
+            (size_t)lda*n*sizeof(plasma_complex64_t));
+        assert(Aref != NULL);
+
+        memcpy(Aref, A, (size_t)lda*n*sizeof(plasma_complex64_t));
+    }
+
+    // The panel is a column of tiles in place in the array.
+    // Its width cannot exceed the height of the tiles.
+    nb = imax(nb, n);
+    plasma_desc_t panel;
+    retval = plasma_desc_general_lapack_init(PlasmaComplexDouble, A, nb, n,
+                                             lda, m, n, 0, 0, m, n, &panel);
+    assert(retval == PlasmaSuccess);
+
+    plasma_pivot_t *pivot = NULL;
+    retval = posix_memalign((void**)&pivot, sizeof(plasma_pivot_t),
+                            num_panel_threads*sizeof(*pivot));
+    assert(retval == 0);
+
+    volatile int info = 0;
+    plasma_barrier_t barrier;
+    plasma_barrier_init(&barrier);
+
+    //================================================================
+    // Run and time the panel.
+    //================================================================
+    plasma_time_t start = omp_get_wtime();
+    #pragma omp parallel num_threads(num_panel_threads)
+    {
+        plasma_core_zgetrf(panel, ipiv, ib,
+                           omp_get_thread_num(), num_panel_threads,
+                           pivot, &info, &barrier);
+    }
+    plasma_time_t stop = omp_get_wtime();
+    plasma_time_t time = stop-start;
+
+    param[PARAM_TIME].d = time;
+    param[PARAM_GFLOPS].d = flops_zgetrf(m, n) / time / 1e9;
+
+    //================================================================
+    // Test results by comparing to a reference implementation.
+    //================================================================
+    if (test) {
+        int lapinfo = LAPACKE_zgetrf(
+            LAPACK_COL_MAJOR,
+            m, n,
+            Aref, lda, ipiv);
+
+        if (lapinfo == 0) {
+            plasma_complex64_t zmone = -1.0;
+            cblas_zaxpy((size_t)lda*n, CBLAS_SADDR(zmone), Aref, 1, A, 1);
+
+            double work[1];
+            double Anorm = LAPACKE_zlange_work(
+                LAPACK_COL_MAJOR, 'F', m, n, Aref, lda, work);
+
+            double error = LAPACKE_zlange_work(
+                LAPACK_COL_MAJOR, 'F', m, n, A, lda, work);
+
+            if (Anorm != 0.0)
+                error /= Anorm;
+            error /= sqrt((double)m*n);
+
+            param[PARAM_ERROR].d = error;
+            param[PARAM_SUCCESS].i = error < tol;
+        }
+        else {
+            param[PARAM_ERROR].d = 0.0;
+            param[PARAM_SUCCESS].i = lapinfo == info;
+        }
+    }
+
+    //================================================================
+    // Free arrays.
+    //================================================================
+    free(A);
+    free(ipiv);
+    free(pivot);
+    if (test)
+        free(Aref);
+}
@@ -51,6 +51,7 @@ void test_zgetrs(param_value_t param[], bool run)
     param[PARAM_NB     ].used = true;
     param[PARAM_IB     ].used = true;
     param[PARAM_MTPF   ].used = true;
+    param[PARAM_LAYOUT ].used = true;
     if (! run)
         return;
 
@@ -75,6 +76,10 @@ void test_zgetrs(param_value_t param[], bool run)
     plasma_set(PlasmaNb, param[PARAM_NB].i);
     plasma_set(PlasmaIb, param[PARAM_IB].i);
     plasma_set(PlasmaNumPanelThreads, param[PARAM_MTPF].i);
+    if (param[PARAM_LAYOUT].c == 'l')
+        plasma_set(PlasmaLayout, PlasmaLapackLayout);
+    else
+        plasma_set(PlasmaLayout, PlasmaTileLayout);
 
     //================================================================
     // Allocate and initialize arrays.
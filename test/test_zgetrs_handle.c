@@ -0,0 +1,201 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+
+#include "test.h"
+#include "flops.h"
+#include "plasma.h"
+#include <plasma_core_blas.h>
+#include "core_lapack.h"
+
+#include <assert.h>
+#include <math.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <omp.h>
+
+#define COMPLEX
+
+#define A(i_, j_) A[(i_) + (size_t)lda*(j_)]
+
+/***************************************************************************//**
+ *
+ * @brief Tests ZGETRS_HANDLE.
+ *
+ * @param[in,out] param - array of parameters
+ * @param[in]     run - whether to run test
+ *
+ * Sets flags in param indicating which parameters are used.
+ * If run is true, also runs test and stores output parameters.
+ ******************************************************************************/
+void test_zgetrs_handle(param_value_t param[], bool run)
+{
+    //================================================================
+    // Mark which parameters are used.
+    //================================================================
+    param[PARAM_TRANS  ].used = true;
+    param[PARAM_DIM    ].used = PARAM_USE_N;
+    param[PARAM_NRHS   ].used = true;
+    param[PARAM_PADA   ].used = true;
+    param[PARAM_PADB   ].used = true;
+    param[PARAM_NB     ].used = true;
+    param[PARAM_IB     ].used = true;
+    param[PARAM_MTPF   ].used = true;
+    param[PARAM_LAYOUT ].used = true;
+    if (! run)
+        return;
+
+    //================================================================
+    // Set parameters.
+    //================================================================
+    plasma_enum_t trans = plasma_trans_const(param[PARAM_TRANS].c);
+
+    int n = param[PARAM_DIM].dim.n;
+    int nrhs = param[PARAM_NRHS].i;
+
+    int lda = imax(1, n+param[PARAM_PADA].i);
+    int ldb = imax(1, n+param[PARAM_PADB].i);
+
+    int test = param[PARAM_TEST].c == 'y';
+    double tol = param[PARAM_TOL].d * LAPACKE_dlamch('E');
+
+    //================================================================
+    // Set tuning parameters.
+    //================================================================
+    plasma_set(PlasmaTuning, PlasmaDisabled);
+    plasma_set(PlasmaNb, param[PARAM_NB].i);
+    plasma_set(PlasmaIb, param[PARAM_IB].i);
+    plasma_set(PlasmaNumPanelThreads, param[PARAM_MTPF].i);
+    if (param[PARAM_LAYOUT].c == 'l')
+        plasma_set(PlasmaLayout, PlasmaLapackLayout);
+    else
+        plasma_set(PlasmaLayout, PlasmaTileLayout);
+
+    //================================================================
+    // Allocate and initialize arrays.
+    //================================================================
+    plasma_complex64_t *A =
+        (plasma_complex64_t*)malloc((size_t)lda*n*sizeof(plasma_complex64_t));
+    assert(A != NULL);
+
+    plasma_complex64_t *B =
+        (plasma_complex64_t*)malloc(
+            (size_t)ldb*nrhs*sizeof(plasma_complex64_t));
+    assert(B != NULL);
+
+    int seed[] = {0, 0, 0, 1};
+    lapack_int retval;
+    retval = LAPACKE_zlarnv(1, seed, (size_t)lda*n, A);
+    assert(retval == 0);
+
+    retval = LAPACKE_zlarnv(1, seed, (size_t)ldb*nrhs, B);
+    assert(retval == 0);
+
+    plasma_complex64_t *Aref = NULL;
+    plasma_complex64_t *Bref = NULL;
+    double *work = NULL;
+    if (test) {
+        Aref = (plasma_complex64_t*)malloc(
+            (size_t)lda*n*sizeof(plasma_complex64_t));
+        assert(Aref != NULL);
+
+        Bref = (plasma_complex64_t*)malloc(
+            (size_t)ldb*nrhs*sizeof(plasma_complex64_t));
+        assert(Bref != NULL);
+
+        memcpy(Aref, A, (size_t)lda*n*sizeof(plasma_complex64_t));
+        memcpy(Bref, B, (size_t)ldb*nrhs*sizeof(plasma_complex64_t));
+    }
+
+    //================================================================
+    // Run GETRF into a handle.
+    //================================================================
+    plasma_factor_t F;
+    plasma_zgetrf_handle(n, n, A, lda, &F);
+
+    //================================================================
+    // Run and time PLASMA: solve twice with the same handle,
+    // with different right-hand sides, and test both solutions
+    // by checking the residual
+    //
+    //                      || B - AX ||_I
+    //                --------------------------- < epsilon
+    //                 || A ||_I * || X ||_I * N
+    //
+    //================================================================
+    plasma_complex64_t zone  =  1.0;
+    plasma_complex64_t zmone = -1.0;
+
+    double Anorm = 0.0;
+    if (test) {
+        work = (double*)malloc((size_t)n*sizeof(double));
+        assert(work != NULL);
+
+        Anorm = LAPACKE_zlange_work(
+            LAPACK_COL_MAJOR, 'I', n, n, Aref, lda, work);
+    }
+
+    plasma_time_t time = 0.0;
+    double residual = 0.0;
+    for (int solve = 0; solve < 2; solve++) {
+        if (solve > 0) {
+            retval = LAPACKE_zlarnv(1, seed, (size_t)ldb*nrhs, B);
+            assert(retval == 0);
+
+            if (test)
+                memcpy(Bref, B, (size_t)ldb*nrhs*sizeof(plasma_complex64_t));
+        }
+
+        plasma_time_t start = omp_get_wtime();
+        plasma_zgetrs_handle(trans, &F, nrhs, B, ldb);
+        plasma_time_t stop = omp_get_wtime();
+        time += stop-start;
+
+        if (test) {
+            double Xnorm = LAPACKE_zlange_work(
+                LAPACK_COL_MAJOR, 'I', n, nrhs, B, ldb, work);
+
+            // Bref -= op(Aref)*B
+            cblas_zgemm(CblasColMajor, (CBLAS_TRANSPOSE)trans, CblasNoTrans,
+                        n, nrhs, n,
+                        CBLAS_SADDR(zmone), Aref, lda,
+                                            B,    ldb,
+                        CBLAS_SADDR(zone),  Bref, ldb);
+
+            double Rnorm = LAPACKE_zlange_work(
+                LAPACK_COL_MAJOR, 'I', n, nrhs, Bref, ldb, work);
+            residual = fmax(residual, Rnorm/(n*Anorm*Xnorm));
+        }
+    }
+
+    param[PARAM_TIME].d = time;
+    param[PARAM_GFLOPS].d = 2*flops_zgetrs(n, nrhs) / time / 1e9;
+
+    if (test) {
+        param[PARAM_ERROR].d = residual;
+        param[PARAM_SUCCESS].i = residual < tol;
+    }
+
+    //================================================================
+    // Free arrays.
+    //================================================================
+    plasma_factor_destroy(&F);
+    free(A);
+    free(B);
+    if (test) {
+        free(Aref);
+        free(Bref);
+        free(work);
+    }
+}
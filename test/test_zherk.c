@@ -48,6 +48,7 @@ void test_zherk(param_value_t param[], bool run)
     param[PARAM_PADA   ].used = true;
     param[PARAM_PADC   ].used = true;
     param[PARAM_NB     ].used = true;
+    param[PARAM_GRAN   ].used = true;
     if (! run)
         return;
 
@@ -88,6 +89,7 @@ void test_zherk(param_value_t param[], bool run)
     //================================================================
     plasma_set(PlasmaTuning, PlasmaDisabled);
     plasma_set(PlasmaNb, param[PARAM_NB].i);
+    plasma_set(PlasmaGranularity, param[PARAM_GRAN].i);
 
     //================================================================
     // Allocate and initialize arrays.
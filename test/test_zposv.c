@@ -48,6 +48,11 @@ void test_zposv(param_value_t param[], bool run)
     param[PARAM_PADA   ].used = true;
     param[PARAM_PADB   ].used = true;
     param[PARAM_NB     ].used = true;
+    param[PARAM_LAYOUT ].used = true;
+    param[PARAM_BUFFER ].used = true;
+    param[PARAM_RUNTIME].used = true;
+    param[PARAM_REPLAY ].used = true;
+    param[PARAM_LOOKAHEAD].used = true;
     if (! run)
         return;
 
@@ -70,6 +75,21 @@ void test_zposv(param_value_t param[], bool run)
     //================================================================
     plasma_set(PlasmaTuning, PlasmaDisabled);
     plasma_set(PlasmaNb, param[PARAM_NB].i);
+    if (param[PARAM_LAYOUT].c == 'l')
+        plasma_set(PlasmaLayout, PlasmaLapackLayout);
+    else
+        plasma_set(PlasmaLayout, PlasmaTileLayout);
+    if (param[PARAM_RUNTIME].c == 'n')
+        plasma_set(PlasmaRuntime, PlasmaRuntimeNative);
+    else if (param[PARAM_RUNTIME].c == 's')
+        plasma_set(PlasmaRuntime, PlasmaRuntimeStatic);
+    else
+        plasma_set(PlasmaRuntime, PlasmaRuntimeOpenMP);
+    plasma_set(PlasmaLookahead, param[PARAM_LOOKAHEAD].i);
+    if (param[PARAM_REPLAY].c == 'y')
+        plasma_set(PlasmaReplay, PlasmaEnabled);
+    else
+        plasma_set(PlasmaReplay, PlasmaDisabled);
 
     //================================================================
     // Allocate and initialize arrays.
@@ -121,11 +141,24 @@ void test_zposv(param_value_t param[], bool run)
         memcpy(Bref, B, (size_t)ldb*nrhs*sizeof(plasma_complex64_t));
     }
 
+    // Carve the tile matrices out of a buffer of the tester.
+    void *buffer = NULL;
+    size_t lbuffer = 0;
+    if (param[PARAM_BUFFER].c == 'y') {
+        retval = plasma_zposv_workspace_query(uplo, n, nrhs, &lbuffer);
+        assert(retval == PlasmaSuccess);
+        retval = posix_memalign(&buffer, PLASMA_ALLOCATOR_ALIGN, lbuffer);
+        assert(retval == 0);
+    }
+
     //================================================================
     // Run and time PLASMA.
     //================================================================
     plasma_time_t start = omp_get_wtime();
-    plasma_zposv(uplo, n, nrhs, A, lda, B, ldb);
+    if (param[PARAM_BUFFER].c == 'y')
+        plasma_zposv_buffer(uplo, n, nrhs, A, lda, B, ldb, buffer, lbuffer);
+    else
+        plasma_zposv(uplo, n, nrhs, A, lda, B, ldb);
     plasma_time_t stop = omp_get_wtime();
     plasma_time_t time = stop-start;
 
@@ -172,6 +205,7 @@ void test_zposv(param_value_t param[], bool run)
     //================================================================
     free(A);
     free(B);
+    free(buffer);
     if (test) {
         free(Aref);
         free(Bref);
@@ -48,6 +48,11 @@ void test_zpotrf(param_value_t param[], bool run)
     param[PARAM_PADA   ].used = true;
     param[PARAM_NB     ].used = true;
     param[PARAM_ZEROCOL].used = true;
+    param[PARAM_LAYOUT ].used = true;
+    param[PARAM_RUNTIME].used = true;
+    param[PARAM_REPLAY ].used = true;
+    param[PARAM_LOOKAHEAD].used = true;
+    param[PARAM_GRAN   ].used = true;
     if (! run)
         return;
 
@@ -68,6 +73,22 @@ void test_zpotrf(param_value_t param[], bool run)
     //================================================================
     plasma_set(PlasmaTuning, PlasmaDisabled);
     plasma_set(PlasmaNb, param[PARAM_NB].i);
+    if (param[PARAM_LAYOUT].c == 'l')
+        plasma_set(PlasmaLayout, PlasmaLapackLayout);
+    else
+        plasma_set(PlasmaLayout, PlasmaTileLayout);
+    if (param[PARAM_RUNTIME].c == 'n')
+        plasma_set(PlasmaRuntime, PlasmaRuntimeNative);
+    else if (param[PARAM_RUNTIME].c == 's')
+        plasma_set(PlasmaRuntime, PlasmaRuntimeStatic);
+    else
+        plasma_set(PlasmaRuntime, PlasmaRuntimeOpenMP);
+    plasma_set(PlasmaLookahead, param[PARAM_LOOKAHEAD].i);
+    plasma_set(PlasmaGranularity, param[PARAM_GRAN].i);
+    if (param[PARAM_REPLAY].c == 'y')
+        plasma_set(PlasmaReplay, PlasmaEnabled);
+    else
+        plasma_set(PlasmaReplay, PlasmaDisabled);
 
     //================================================================
     // Allocate and initialize arrays.
@@ -0,0 +1,98 @@
+#!/usr/bin/env python3
+
+###############################################################################
+# Compares the task throughput of the native work-stealing runtime with that
+# of the OpenMP runtime on the tile factorizations it runs.
+#
+# Throughput is the number of tile kernels of a factorization divided by its
+# time, the best of --iter runs. The kernel count does not depend on the
+# runtime, so that the rates compare the overheads of the runtimes.
+# Passing testers built with GCC (libgomp) and Clang (libomp) compares the
+# native runtime with both OpenMP runtimes.
+#
+# Example:
+#     tools/runtime_bench.py --tester gcc/plasmatest --tester clang/plasmatest \
+#         --dim 2000 --nb 64,128,256
+###############################################################################
+
+import argparse
+import os
+import subprocess
+
+
+def num_kernels(routine, mt, nt):
+    """Returns the number of tile kernels of the factorization of
+    an mt-by-nt tile matrix."""
+    count = 0
+    for k in range(min(mt, nt)):
+        m = mt-k-1
+        n = nt-k-1
+        if routine == 'potrf':
+            # potrf, trsm, herk and gemm
+            count += 1 + m + m + m*(m-1)//2
+        elif routine == 'getrf':
+            # panel, geswp, trsm and gemm, plus the pivoting to the left
+            count += 1 + n + n + m*n + (1 if k < min(mt, nt)-1 else 0)
+        elif routine == 'geqrf':
+            # geqrt, unmqr, tsqrt and tsmqr
+            count += 1 + n + m + m*n
+    return count
+
+
+def best_time(tester, routine, runtime, dim, nb, iters, threads):
+    """Runs the tester and returns the best time of the iterations."""
+    cmd = [tester, 'd' + routine, '--dim=%d' % dim, '--nb=%d' % nb,
+           '--runtime=' + runtime, '--test=n', '--iter=%d' % iters]
+    env = None
+    if threads:
+        env = dict(os.environ, OMP_NUM_THREADS=str(threads))
+    out = subprocess.run(cmd, stdout=subprocess.PIPE, stderr=subprocess.STDOUT,
+                         universal_newlines=True, env=env).stdout
+    # The rows start with the status, the error and the time.
+    times = []
+    for line in out.splitlines():
+        words = line.split()
+        if len(words) > 2 and words[0] in ('pass', 'FAILED', '--'):
+            times.append(float(words[2]))
+    if not times:
+        raise RuntimeError('no timing in the output of ' + ' '.join(cmd) +
+                           ':\n' + out)
+    return min(times)
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Compare the task throughput of the PLASMA runtimes.')
+    parser.add_argument('--tester', action='append', required=True,
+                        help='plasmatest executable, may be repeated')
+    parser.add_argument('--routine', default='potrf,getrf,geqrf',
+                        help='factorizations [default: potrf,getrf,geqrf]')
+    parser.add_argument('--dim', type=int, default=2000,
+                        help='matrix order [default: 2000]')
+    parser.add_argument('--nb', default='64,128,256',
+                        help='tile sizes [default: 64,128,256]')
+    parser.add_argument('--iter', type=int, default=5,
+                        help='runs per measurement [default: 5]')
+    parser.add_argument('--threads', type=int, default=0,
+                        help='OMP_NUM_THREADS [default: inherited]')
+    args = parser.parse_args()
+
+    print('%-24s %6s %5s %8s %12s %12s %12s %12s %8s' %
+          ('tester', 'routine', 'nb', 'kernels', 'OpenMP (s)', 'native (s)',
+           'OpenMP (k/s)', 'native (k/s)', 'speedup'))
+    for tester in args.tester:
+        for routine in args.routine.split(','):
+            for nb in [int(nb) for nb in args.nb.split(',')]:
+                nt = (args.dim+nb-1)//nb
+                kernels = num_kernels(routine, nt, nt)
+                omp = best_time(tester, routine, 'o', args.dim, nb,
+                                args.iter, args.threads)
+                native = best_time(tester, routine, 'n', args.dim, nb,
+                                   args.iter, args.threads)
+                print('%-24s %6s %5d %8d %12.4f %12.4f %12.0f %12.0f %8.2f' %
+                      (tester[-24:], routine, nb, kernels, omp, native,
+                       kernels/omp, kernels/native, omp/native))
+
+
+if __name__ == '__main__':
+    main()
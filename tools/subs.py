@@ -197,6 +197,7 @@ lapack = [
     ('sgelqf',               'dgelqf',               'cgelqf',               'zgelqf'              ),
     ('sgelqs',               'dgelqs',               'cgelqs',               'zgelqs'              ),
     ('sgelqt',               'dgelqt',               'cgelqt',               'zgelqt'              ),
+    ('sgemdm',               'dgemdm',               'cgemdm',               'zgemdm'              ),
     ('sgels',                'dgels',                'cgels',                'zgels'               ),
     ('sgeqlf',               'dgeqlf',               'cgeqlf',               'zgeqlf'              ),
     ('sgeqp3',               'dgeqp3',               'cgeqp3',               'zgeqp3'              ),
@@ -204,6 +205,7 @@ lapack = [
     ('sgeqrf',               'dgeqrf',               'cgeqrf',               'zgeqrf'              ),
     ('sgeqrs',               'dgeqrs',               'cgeqrs',               'zgeqrs'              ),
     ('sgeqrt',               'dgeqrt',               'cgeqrt',               'zgeqrt'              ),
+    ('sgerbt',               'dgerbt',               'cgerbt',               'zgerbt'              ),
     ('sgerfs',               'dgerfs',               'cgerfs',               'zgerfs'              ),
     ('sgesdd',               'dgesdd',               'cgesdd',               'zgesdd'              ),
     ('sgessm',               'dgessm',               'cgessm',               'zgessm'              ),
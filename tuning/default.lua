@@ -13,6 +13,10 @@ function gbtrf_max_panel_threads (type, num_threads, n, bw)
         return 1
 end
 
+function gbtrf_lookahead (type, num_threads, n, bw)
+        return 1
+end
+
 --------------------------------------------------------------------------------
 function geadd_nb (type, num_threads, m, n)
         return 256
@@ -71,6 +75,10 @@ function getrf_max_panel_threads (type, num_threads, m, n)
 	return 1
 end
 
+function getrf_lookahead (type, num_threads, m, n)
+	return 1
+end
+
 --------------------------------------------------------------------------------
 function hetrf_nb (type, num_threads, n)
         return 256
@@ -126,6 +134,10 @@ function potrf_nb (type, num_threads, n)
         return 256
 end
 
+function potrf_lookahead (type, num_threads, n)
+        return 1
+end
+
 --------------------------------------------------------------------------------
 function poinv_nb (type, num_threads, n)
         return 256